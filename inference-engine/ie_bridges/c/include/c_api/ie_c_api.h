@@ -288,6 +288,16 @@ typedef struct ie_complete_call_back {
     void *args;
 }ie_complete_call_back_t;
 
+/**
+ * @struct ie_infer_request_complete_call_back
+ * @brief Completion callback receiving the finished request and the status of its inference. The callback is called
+ * on the callback executor of the plugin.
+ */
+typedef struct ie_infer_request_complete_call_back {
+    void (*completeCallBackFunc)(ie_infer_request_t *infer_request, IEStatusCode status, void *args);
+    void *args;
+}ie_infer_request_complete_call_back_t;
+
 /**
  * @struct ie_available_devices
  * @brief Represent all available devices.
@@ -538,6 +548,46 @@ INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_exec_network_set_config(ie_
 INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_exec_network_get_config(const ie_executable_network_t *ie_exec_network, \
         const char *metric_config, ie_param_t *param_result);
 
+/**
+ * @brief Gets number of inputs for the executable network.
+ * @ingroup ExecutableNetwork
+ * @param ie_exec_network A pointer to ie_executable_network_t instance.
+ * @param size_result A number of the executable network's input information.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_exec_network_get_inputs_number(const ie_executable_network_t *ie_exec_network, size_t *size_result);
+
+/**
+ * @brief Gets name corresponding to the "number". The number is the input index used by the index based
+ * infer request functions. Use the ie_network_name_free() method to free memory.
+ * @ingroup ExecutableNetwork
+ * @param ie_exec_network A pointer to ie_executable_network_t instance.
+ * @param number An id of input information.
+ * @param name Input name corresponding to the number.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_exec_network_get_input_name(const ie_executable_network_t *ie_exec_network, size_t number, char **name);
+
+/**
+ * @brief Gets number of outputs for the executable network.
+ * @ingroup ExecutableNetwork
+ * @param ie_exec_network A pointer to ie_executable_network_t instance.
+ * @param size_result A number of the executable network's output information.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_exec_network_get_outputs_number(const ie_executable_network_t *ie_exec_network, size_t *size_result);
+
+/**
+ * @brief Gets name corresponding to the "number". The number is the output index used by the index based
+ * infer request functions. Use the ie_network_name_free() method to free memory.
+ * @ingroup ExecutableNetwork
+ * @param ie_exec_network A pointer to ie_executable_network_t instance.
+ * @param number An id of output information.
+ * @param name Output name corresponding to the number.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_exec_network_get_output_name(const ie_executable_network_t *ie_exec_network, const size_t number, char **name);
+
 /** @} */ // end of ExecutableNetwork
 
 // InferRequest
@@ -622,6 +672,83 @@ INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_request_wait(ie_infer
  */
 INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_request_set_batch(ie_infer_request_t *infer_request, const size_t size);
 
+/**
+ * @brief Gets the data of the input by its index without allocating a blob. The buffer stays valid until the input
+ * blob of the request is changed.
+ * @ingroup InferRequest
+ * @param infer_request A pointer to ie_infer_request_t instance.
+ * @param index Index of the input, see ie_exec_network_get_input_name().
+ * @param blob_buffer A pointer to the input data.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_request_get_input_buffer(ie_infer_request_t *infer_request, const size_t index, ie_blob_buffer_t *blob_buffer);
+
+/**
+ * @brief Gets the data of the output by its index without allocating a blob. The buffer stays valid until the output
+ * blob of the request is changed.
+ * @ingroup InferRequest
+ * @param infer_request A pointer to ie_infer_request_t instance.
+ * @param index Index of the output, see ie_exec_network_get_output_name().
+ * @param blob_cbuffer A pointer to the output data.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_request_get_output_buffer(ie_infer_request_t *infer_request, const size_t index, ie_blob_buffer_t *blob_cbuffer);
+
+/**
+ * @brief Makes the request read the input from the user memory. The memory is not copied, it must stay valid while
+ * the request uses it.
+ * @ingroup InferRequest
+ * @param infer_request A pointer to ie_infer_request_t instance.
+ * @param index Index of the input, see ie_exec_network_get_input_name().
+ * @param ptr Pointer to the memory laid out with the precision, dimensions and layout of the network input.
+ * @param size Length of the memory in elements.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_request_bind_input(ie_infer_request_t *infer_request, const size_t index, void *ptr, size_t size);
+
+/**
+ * @brief Makes the request write the output to the user memory. The memory is not copied, it must stay valid while
+ * the request uses it.
+ * @ingroup InferRequest
+ * @param infer_request A pointer to ie_infer_request_t instance.
+ * @param index Index of the output, see ie_exec_network_get_output_name().
+ * @param ptr Pointer to the memory laid out with the precision, dimensions and layout of the network output.
+ * @param size Length of the memory in elements.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_request_bind_output(ie_infer_request_t *infer_request, const size_t index, void *ptr, size_t size);
+
+/**
+ * @brief Sets a callback function that will be called with the request and the inference status on success or failure
+ * of asynchronous request. The callback structure is copied.
+ * @ingroup InferRequest
+ * @param infer_request A pointer to ie_infer_request_t instance.
+ * @param callback  A function to be called.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_request_set_completion_callback(ie_infer_request_t *infer_request, const ie_infer_request_complete_call_back_t *callback);
+
+/**
+ * @brief Starts asynchronous inference of several infer requests.
+ * @ingroup InferRequest
+ * @param infer_requests An array of pointers to ie_infer_request_t instances.
+ * @param count Number of the requests.
+ * @return Status code of the operation: OK(0) if all the requests are started, otherwise the status of the first
+ * request failed to start. The requests after the failed one are not started.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_requests_infer_async(ie_infer_request_t **infer_requests, const size_t count);
+
+/**
+ * @brief Waits for the results of several infer requests, see ie_infer_request_wait().
+ * @ingroup InferRequest
+ * @param infer_requests An array of pointers to ie_infer_request_t instances.
+ * @param count Number of the requests.
+ * @param timeout Maximum duration in milliseconds to block for each request
+ * @return Status code of the operation: OK(0) if all the requests are finished successfully, otherwise the status of
+ * the first request that is not.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_requests_wait(ie_infer_request_t **infer_requests, const size_t count, const int64_t timeout);
+
 /** @} */ // end of InferRequest
 
 // Network
@@ -44,6 +44,10 @@ struct ie_executable {
  */
 struct ie_infer_request {
     IE::InferRequest object;
+    // Network inputs and outputs in the order of the executable network info maps, resolved at creation
+    std::vector<std::pair<std::string, IE::TensorDesc>> inputs;
+    std::vector<std::pair<std::string, IE::TensorDesc>> outputs;
+    ie_infer_request_complete_call_back_t callback;
 };
 
 /**
@@ -131,6 +135,41 @@ std::map<std::string, std::string> config2Map(const ie_config_t *config) {
     return m;
 }
 
+/**
+ *@brief wrap the pre-allocated memory into a blob of the tensor precision.
+ */
+IE::Blob::Ptr make_preallocated_blob(const IE::TensorDesc &tensor, void *ptr, size_t size) {
+    const IE::Precision prec = tensor.getPrecision();
+    if (prec == IE::Precision::U8) {
+        uint8_t *p = reinterpret_cast<uint8_t *>(ptr);
+        return IE::make_shared_blob(tensor, p, size);
+    } else if (prec == IE::Precision::U16) {
+        uint16_t *p = reinterpret_cast<uint16_t *>(ptr);
+        return IE::make_shared_blob(tensor, p, size);
+    } else if (prec == IE::Precision::I8 || prec == IE::Precision::BIN) {
+        int8_t *p = reinterpret_cast<int8_t *>(ptr);
+        return IE::make_shared_blob(tensor, p, size);
+    } else if (prec == IE::Precision::I16 || prec == IE::Precision::FP16 || prec == IE::Precision::Q78) {
+        int16_t *p = reinterpret_cast<int16_t *>(ptr);
+        return IE::make_shared_blob(tensor, p, size);
+    } else if (prec == IE::Precision::I32) {
+        int32_t *p = reinterpret_cast<int32_t *>(ptr);
+        return IE::make_shared_blob(tensor, p, size);
+    } else if (prec == IE::Precision::I64) {
+        int64_t *p = reinterpret_cast<int64_t *>(ptr);
+        return IE::make_shared_blob(tensor, p, size);
+    } else if (prec == IE::Precision::U64) {
+        uint64_t *p = reinterpret_cast<uint64_t *>(ptr);
+        return IE::make_shared_blob(tensor, p, size);
+    } else if  (prec == IE::Precision::FP32) {
+        float *p = reinterpret_cast<float *>(ptr);
+        return IE::make_shared_blob(tensor, p, size);
+    } else {
+        uint8_t *p = reinterpret_cast<uint8_t *>(ptr);
+        return IE::make_shared_blob(tensor, p, size);
+    }
+}
+
 std::map<std::string, IE::Parameter> config2ParamMap(const ie_config_t *config) {
     std::map<std::string, IE::Parameter> param_map;
     const ie_config_t *tmp = config;
@@ -538,6 +577,13 @@ IEStatusCode ie_exec_network_create_infer_request(ie_executable_network_t *ie_ex
     try {
         std::unique_ptr<ie_infer_request_t> req(new ie_infer_request_t);
         req->object = ie_exec_network->object.CreateInferRequest();
+        for (const auto &input : ie_exec_network->object.GetInputsInfo()) {
+            req->inputs.emplace_back(input.first, input.second->getTensorDesc());
+        }
+        for (const auto &output : ie_exec_network->object.GetOutputsInfo()) {
+            req->outputs.emplace_back(output.first, output.second->getTensorDesc());
+        }
+        req->callback = {nullptr, nullptr};
         *request = req.release();
     } catch (const IE::details::InferenceEngineException& e) {
         return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
@@ -608,6 +654,84 @@ IEStatusCode ie_exec_network_get_config(const ie_executable_network_t *ie_exec_n
     return status;
 }
 
+IEStatusCode ie_exec_network_get_inputs_number(const ie_executable_network_t *ie_exec_network, size_t *size_result) {
+    if (ie_exec_network == nullptr || size_result == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    try {
+        *size_result = ie_exec_network->object.GetInputsInfo().size();
+    } catch (const IE::details::InferenceEngineException& e) {
+        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_exec_network_get_input_name(const ie_executable_network_t *ie_exec_network, size_t number, char **name) {
+    if (ie_exec_network == nullptr || name == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    try {
+        IE::ConstInputsDataMap inputs = ie_exec_network->object.GetInputsInfo();
+        if (number >= inputs.size()) {
+            return IEStatusCode::OUT_OF_BOUNDS;
+        }
+        const std::string &inputName = std::next(inputs.begin(), number)->first;
+        std::unique_ptr<char[]> result(new char[inputName.length() + 1]);
+        *name = result.release();
+        memcpy(*name, inputName.c_str(), inputName.length() + 1);
+    } catch (const IE::details::InferenceEngineException& e) {
+        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_exec_network_get_outputs_number(const ie_executable_network_t *ie_exec_network, size_t *size_result) {
+    if (ie_exec_network == nullptr || size_result == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    try {
+        *size_result = ie_exec_network->object.GetOutputsInfo().size();
+    } catch (const IE::details::InferenceEngineException& e) {
+        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_exec_network_get_output_name(const ie_executable_network_t *ie_exec_network, const size_t number, char **name) {
+    if (ie_exec_network == nullptr || name == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    try {
+        IE::ConstOutputsDataMap outputs = ie_exec_network->object.GetOutputsInfo();
+        if (number >= outputs.size()) {
+            return IEStatusCode::OUT_OF_BOUNDS;
+        }
+        const std::string &outputName = std::next(outputs.begin(), number)->first;
+        std::unique_ptr<char[]> result(new char[outputName.length() + 1]);
+        *name = result.release();
+        memcpy(*name, outputName.c_str(), outputName.length() + 1);
+    } catch (const IE::details::InferenceEngineException& e) {
+        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return IEStatusCode::OK;
+}
+
 void ie_network_free(ie_network_t **network) {
     if (network) {
         delete *network;
@@ -1361,6 +1485,157 @@ IEStatusCode ie_infer_request_set_batch(ie_infer_request_t *infer_request, const
     return status;
 }
 
+IEStatusCode ie_infer_request_get_input_buffer(ie_infer_request_t *infer_request, const size_t index, ie_blob_buffer_t *blob_buffer) {
+    if (infer_request == nullptr || blob_buffer == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+    if (index >= infer_request->inputs.size()) {
+        return IEStatusCode::OUT_OF_BOUNDS;
+    }
+
+    try {
+        blob_buffer->buffer = infer_request->object.GetBlob(infer_request->inputs[index].first)->buffer();
+    } catch (const IE::details::InferenceEngineException& e) {
+        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_infer_request_get_output_buffer(ie_infer_request_t *infer_request, const size_t index, ie_blob_buffer_t *blob_cbuffer) {
+    if (infer_request == nullptr || blob_cbuffer == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+    if (index >= infer_request->outputs.size()) {
+        return IEStatusCode::OUT_OF_BOUNDS;
+    }
+
+    try {
+        blob_cbuffer->cbuffer = infer_request->object.GetBlob(infer_request->outputs[index].first)->cbuffer();
+    } catch (const IE::details::InferenceEngineException& e) {
+        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_infer_request_bind_input(ie_infer_request_t *infer_request, const size_t index, void *ptr, size_t size) {
+    if (infer_request == nullptr || ptr == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+    if (index >= infer_request->inputs.size()) {
+        return IEStatusCode::OUT_OF_BOUNDS;
+    }
+
+    try {
+        const auto &input = infer_request->inputs[index];
+        infer_request->object.SetBlob(input.first, make_preallocated_blob(input.second, ptr, size));
+    } catch (const IE::details::InferenceEngineException& e) {
+        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_infer_request_bind_output(ie_infer_request_t *infer_request, const size_t index, void *ptr, size_t size) {
+    if (infer_request == nullptr || ptr == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+    if (index >= infer_request->outputs.size()) {
+        return IEStatusCode::OUT_OF_BOUNDS;
+    }
+
+    try {
+        const auto &output = infer_request->outputs[index];
+        infer_request->object.SetBlob(output.first, make_preallocated_blob(output.second, ptr, size));
+    } catch (const IE::details::InferenceEngineException& e) {
+        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return IEStatusCode::OK;
+}
+
+/**
+ *@brief calls the completion callback of the C API request stored in the user data of the request.
+ */
+void infer_request_completion_callback(IE::IInferRequest::Ptr request, IE::StatusCode code) {
+    ie_infer_request_t *infer_request = nullptr;
+    IE::ResponseDesc resp;
+    if (request->GetUserData(reinterpret_cast<void **>(&infer_request), &resp) != IE::StatusCode::OK ||
+        infer_request == nullptr || infer_request->callback.completeCallBackFunc == nullptr) {
+        return;
+    }
+    auto status = status_map.find(code);
+    infer_request->callback.completeCallBackFunc(infer_request,
+        status != status_map.end() ? status->second : IEStatusCode::UNEXPECTED, infer_request->callback.args);
+}
+
+IEStatusCode ie_infer_request_set_completion_callback(ie_infer_request_t *infer_request, const ie_infer_request_complete_call_back_t *callback) {
+    if (infer_request == nullptr || callback == nullptr || callback->completeCallBackFunc == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    try {
+        infer_request->callback = *callback;
+        // the C++ wrapper can't pass the request and the status to a capturing callback,
+        // so the C API handle is passed through the user data of the request
+        IE::IInferRequest::Ptr &request = infer_request->object;
+        IE::ResponseDesc resp;
+        IE::StatusCode code = request->SetUserData(infer_request, &resp);
+        if (code == IE::StatusCode::OK) {
+            code = request->SetCompletionCallback(infer_request_completion_callback);
+        }
+        if (code != IE::StatusCode::OK) {
+            return status_map[code];
+        }
+    } catch (const IE::details::InferenceEngineException& e) {
+        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_infer_requests_infer_async(ie_infer_request_t **infer_requests, const size_t count) {
+    if (infer_requests == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        IEStatusCode status = ie_infer_request_infer_async(infer_requests[i]);
+        if (status != IEStatusCode::OK) {
+            return status;
+        }
+    }
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_infer_requests_wait(ie_infer_request_t **infer_requests, const size_t count, const int64_t timeout) {
+    if (infer_requests == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    IEStatusCode result = IEStatusCode::OK;
+    for (size_t i = 0; i < count; ++i) {
+        IEStatusCode status = ie_infer_request_wait(infer_requests[i], timeout);
+        if (result == IEStatusCode::OK) {
+            result = status;
+        }
+    }
+
+    return result;
+}
+
 IEStatusCode ie_blob_make_memory(const tensor_desc_t *tensorDesc, ie_blob_t **blob) {
     if (tensorDesc == nullptr || blob == nullptr) {
         return IEStatusCode::GENERAL_ERROR;
@@ -1453,34 +1728,7 @@ IEStatusCode ie_blob_make_memory_from_preallocated(const tensor_desc_t *tensorDe
     try {
         IE::TensorDesc tensor(prec, dims_vector, l);
         std::unique_ptr<ie_blob_t> _blob(new ie_blob_t);
-        if (prec == IE::Precision::U8) {
-            uint8_t *p = reinterpret_cast<uint8_t *>(ptr);
-            _blob->object = IE::make_shared_blob(tensor, p, size);
-        } else if (prec == IE::Precision::U16) {
-            uint16_t *p = reinterpret_cast<uint16_t *>(ptr);
-            _blob->object = IE::make_shared_blob(tensor, p, size);
-        } else if (prec == IE::Precision::I8 || prec == IE::Precision::BIN) {
-            int8_t *p = reinterpret_cast<int8_t *>(ptr);
-            _blob->object = IE::make_shared_blob(tensor, p, size);
-        } else if (prec == IE::Precision::I16 || prec == IE::Precision::FP16 || prec == IE::Precision::Q78) {
-            int16_t *p = reinterpret_cast<int16_t *>(ptr);
-            _blob->object = IE::make_shared_blob(tensor, p, size);
-        } else if (prec == IE::Precision::I32) {
-            int32_t *p = reinterpret_cast<int32_t *>(ptr);
-            _blob->object = IE::make_shared_blob(tensor, p, size);
-        } else if (prec == IE::Precision::I64) {
-            int64_t *p = reinterpret_cast<int64_t *>(ptr);
-            _blob->object = IE::make_shared_blob(tensor, p, size);
-        } else if (prec == IE::Precision::U64) {
-            uint64_t *p = reinterpret_cast<uint64_t *>(ptr);
-            _blob->object = IE::make_shared_blob(tensor, p, size);
-        } else if  (prec == IE::Precision::FP32) {
-            float *p = reinterpret_cast<float *>(ptr);
-            _blob->object = IE::make_shared_blob(tensor, p, size);
-        } else {
-            uint8_t *p = reinterpret_cast<uint8_t *>(ptr);
-            _blob->object = IE::make_shared_blob(tensor, p, size);
-        }
+        _blob->object = make_preallocated_blob(tensor, ptr, size);
         *blob = _blob.release();
     } catch (const IE::details::InferenceEngineException& e) {
         return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
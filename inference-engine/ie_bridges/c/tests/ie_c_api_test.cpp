@@ -8,6 +8,7 @@
 #include <opencv2/opencv.hpp>
 #include <condition_variable>
 #include <mutex>
+#include <vector>
 #include <c_api/ie_c_api.h>
 #include <inference_engine.hpp>
 #include "test_model_repo.hpp"
@@ -1451,6 +1452,121 @@ TEST(ie_infer_set_completion_callback, setCallback) {
     ie_core_free(&core);
 }
 
+TEST(ie_exec_network_get_input_name, getNames) {
+    ie_core_t *core = nullptr;
+    IE_ASSERT_OK(ie_core_create("", &core));
+    ASSERT_NE(nullptr, core);
+
+    ie_network_t *network = nullptr;
+    IE_EXPECT_OK(ie_core_read_network(core, xml, bin, &network));
+    EXPECT_NE(nullptr, network);
+
+    ie_config_t config = {nullptr, nullptr, nullptr};
+    ie_executable_network_t *exe_network = nullptr;
+    IE_EXPECT_OK(ie_core_load_network(core, network, "CPU", &config, &exe_network));
+    EXPECT_NE(nullptr, exe_network);
+
+    size_t inputs_number = 0, outputs_number = 0;
+    IE_EXPECT_OK(ie_exec_network_get_inputs_number(exe_network, &inputs_number));
+    IE_EXPECT_OK(ie_exec_network_get_outputs_number(exe_network, &outputs_number));
+    EXPECT_EQ(1, inputs_number);
+    EXPECT_EQ(1, outputs_number);
+
+    char *input_name = nullptr, *output_name = nullptr;
+    IE_EXPECT_OK(ie_exec_network_get_input_name(exe_network, 0, &input_name));
+    IE_EXPECT_OK(ie_exec_network_get_output_name(exe_network, 0, &output_name));
+    EXPECT_STREQ(input_name, "data");
+    EXPECT_STREQ(output_name, "fc_out");
+    EXPECT_EQ(IEStatusCode::OUT_OF_BOUNDS, ie_exec_network_get_output_name(exe_network, 1, &output_name));
+
+    ie_network_name_free(&input_name);
+    ie_network_name_free(&output_name);
+    ie_exec_network_free(&exe_network);
+    ie_network_free(&network);
+    ie_core_free(&core);
+}
+
+struct requests_done {
+    std::mutex m;
+    std::condition_variable cv;
+    size_t finished = 0;
+    size_t failed = 0;
+};
+
+void request_completion_callback(ie_infer_request_t *infer_request, IEStatusCode status, void *args) {
+    requests_done *done = (requests_done *)args;
+    ie_blob_buffer_t buffer;
+    bool valid = infer_request != nullptr && ie_infer_request_get_output_buffer(infer_request, 0, &buffer) == IEStatusCode::OK;
+
+    std::lock_guard<std::mutex> lock(done->m);
+    done->finished++;
+    if (status != IEStatusCode::OK || !valid)
+        done->failed++;
+    done->cv.notify_one();
+}
+
+TEST(ie_infer_requests_infer_async, inferBoundRequests) {
+    ie_core_t *core = nullptr;
+    IE_ASSERT_OK(ie_core_create("", &core));
+    ASSERT_NE(nullptr, core);
+
+    ie_network_t *network = nullptr;
+    IE_EXPECT_OK(ie_core_read_network(core, xml, bin, &network));
+    EXPECT_NE(nullptr, network);
+
+    IE_EXPECT_OK(ie_network_set_input_precision(network, "data", precision_e::FP32));
+    IE_EXPECT_OK(ie_network_set_output_precision(network, "fc_out", precision_e::FP32));
+
+    dimensions_t input_dims, output_dims;
+    IE_EXPECT_OK(ie_network_get_input_dims(network, "data", &input_dims));
+    IE_EXPECT_OK(ie_network_get_output_dims(network, "fc_out", &output_dims));
+    size_t input_size = 1, output_size = 1;
+    for (size_t i = 0; i < input_dims.ranks; ++i)
+        input_size *= input_dims.dims[i];
+    for (size_t i = 0; i < output_dims.ranks; ++i)
+        output_size *= output_dims.dims[i];
+
+    ie_config_t config = {nullptr, nullptr, nullptr};
+    ie_executable_network_t *exe_network = nullptr;
+    IE_EXPECT_OK(ie_core_load_network(core, network, "CPU", &config, &exe_network));
+    EXPECT_NE(nullptr, exe_network);
+
+    const size_t requests_number = 2;
+    requests_done done;
+    ie_infer_request_complete_call_back_t callback = {request_completion_callback, &done};
+    std::vector<ie_infer_request_t *> infer_requests(requests_number, nullptr);
+    std::vector<std::vector<float>> inputs(requests_number, std::vector<float>(input_size, 0.f));
+    std::vector<std::vector<float>> outputs(requests_number, std::vector<float>(output_size, -1.f));
+    for (size_t i = 0; i < requests_number; ++i) {
+        IE_EXPECT_OK(ie_exec_network_create_infer_request(exe_network, &infer_requests[i]));
+        ASSERT_NE(nullptr, infer_requests[i]);
+        IE_EXPECT_OK(ie_infer_request_bind_input(infer_requests[i], 0, inputs[i].data(), input_size));
+        IE_EXPECT_OK(ie_infer_request_bind_output(infer_requests[i], 0, outputs[i].data(), output_size));
+        IE_EXPECT_OK(ie_infer_request_set_completion_callback(infer_requests[i], &callback));
+    }
+    EXPECT_EQ(IEStatusCode::OUT_OF_BOUNDS, ie_infer_request_bind_input(infer_requests[0], 1, inputs[0].data(), input_size));
+
+    IE_EXPECT_OK(ie_infer_requests_infer_async(infer_requests.data(), requests_number));
+    IE_EXPECT_OK(ie_infer_requests_wait(infer_requests.data(), requests_number, -1));
+    {
+        std::unique_lock<std::mutex> lock(done.m);
+        done.cv.wait(lock, [&] { return done.finished == requests_number; });
+        EXPECT_EQ(0, done.failed);
+    }
+
+    for (size_t i = 0; i < requests_number; ++i) {
+        ie_blob_buffer_t buffer;
+        IE_EXPECT_OK(ie_infer_request_get_output_buffer(infer_requests[i], 0, &buffer));
+        EXPECT_EQ(outputs[i].data(), buffer.cbuffer);
+        EXPECT_NE(std::vector<float>(output_size, -1.f), outputs[i]);
+        ie_infer_request_free(&infer_requests[i]);
+    }
+
+    ie_exec_network_free(&exe_network);
+    ie_network_free(&network);
+    ie_core_free(&core);
+}
+
 TEST(ie_blob_make_memory_nv12, makeNV12Blob) {
     dimensions_t dim_y = {4, {1, 1, 8, 12}}, dim_uv = {4, {1, 2, 4, 6}};
     tensor_desc tensor_y, tensor_uv;
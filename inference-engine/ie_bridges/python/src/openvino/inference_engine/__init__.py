@@ -1,4 +1,4 @@
 from .ie_api import *
-__all__ = ['IENetwork', "IETensorDesc", "IECore", "IEBlob", "get_version"]
+__all__ = ['IENetwork', "IETensorDesc", "IECore", "IEBlob", "AsyncInferQueue", "get_version"]
 __version__ = get_version()
 
@@ -29,13 +29,13 @@ cdef class InferRequest:
 
     cpdef BlobBuffer _get_blob_buffer(self, const string & blob_name)
 
-    cpdef infer(self, inputs = ?)
-    cpdef async_infer(self, inputs = ?)
+    cpdef infer(self, inputs = ?, share_inputs = ?)
+    cpdef async_infer(self, inputs = ?, share_inputs = ?)
     cpdef wait(self, timeout = ?)
     cpdef get_perf_counts(self)
     cdef void user_callback(self, int status) with gil
     cdef public:
-        _inputs_list, _outputs_list, _py_callback, _py_data, _py_callback_used, _py_callback_called, _user_blobs
+        _inputs_list, _outputs_list, _py_callback, _py_data, _py_callback_used, _py_callback_called, _user_blobs, _shared_inputs
 
 cdef class IENetwork:
     cdef C.IENetwork impl
@@ -49,6 +49,12 @@ cdef class ExecutableNetwork:
     cdef public:
         _requests, _infer_requests
 
+cdef class AsyncInferQueue:
+    cdef unique_ptr[C.AsyncInferQueue] impl
+    cdef void _request_idle(self, int index) with gil
+    cdef public:
+        _network, _requests, _callback, _userdata, _futures, _waiters
+
 cdef class IEPlugin:
     cdef C.IEPlugin impl
     cpdef ExecutableNetwork load(self, IENetwork network, int num_requests = ?, config = ?)
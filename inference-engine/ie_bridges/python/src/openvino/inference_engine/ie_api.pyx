@@ -12,10 +12,11 @@ from libc.string cimport memcpy
 
 import os
 from pathlib import Path
+import asyncio
 import threading
 import warnings
 from copy import deepcopy
-from collections import OrderedDict, namedtuple
+from collections import OrderedDict, namedtuple, deque
 
 from .cimport ie_api_impl_defs as C
 from .ie_api_impl_defs cimport SizeVector, Precision
@@ -26,6 +27,7 @@ import numpy as np
 
 cdef extern from "<utility>" namespace "std" nogil:
     cdef unique_ptr[C.IEExecNetwork] move(unique_ptr[C.IEExecNetwork])
+    cdef unique_ptr[C.AsyncInferQueue] move(unique_ptr[C.AsyncInferQueue])
 
 cdef string to_std_string(str py_string):
     return py_string.encode()
@@ -256,6 +258,7 @@ cdef class IECore:
     cpdef IENetwork read_network(self, model: [str, bytes, Path], weights: [str, bytes, Path] = "", init_from_buffer: bool = False):
         cdef char*xml_buffer
         cdef uint8_t*bin_buffer
+        cdef size_t bin_size
         cdef string weights_
         cdef string model_
         cdef IENetwork net = IENetwork()
@@ -265,7 +268,10 @@ cdef class IECore:
             memcpy(xml_buffer, <char*> model, len(model))
             memcpy(bin_buffer, <uint8_t *> weights, len(weights))
             xml_buffer[len(model)] = b'\0'
-            net.impl = self.impl.readNetwork(xml_buffer, bin_buffer, len(weights))
+            model_ = xml_buffer
+            bin_size = len(weights)
+            with nogil:
+                net.impl = self.impl.readNetwork(model_, bin_buffer, bin_size)
             free(xml_buffer)
         else:
             if isinstance(model, Path) and isinstance(weights, Path):
@@ -282,7 +288,8 @@ cdef class IECore:
                     raise Exception("Path to the weights {} doesn't exist or it's a directory".format(weights))
                 model_ = model.encode()
                 weights_ = weights.encode()
-            net.impl =  self.impl.readNetwork(model_, weights_)
+            with nogil:
+                net.impl = self.impl.readNetwork(model_, weights_)
         return net
 
     ## Loads a network that was read from the Intermediate Representation (IR) to the plugin with specified device name
@@ -306,13 +313,16 @@ cdef class IECore:
     cpdef ExecutableNetwork load_network(self, IENetwork network, str device_name, config=None, int num_requests=1):
         cdef ExecutableNetwork exec_net = ExecutableNetwork()
         cdef map[string, string] c_config
+        cdef string c_device_name = device_name.encode()
         if num_requests < 0:
             raise ValueError("Incorrect number of requests specified: {}. Expected positive integer number "
                              "or zero for auto detection".format(num_requests))
         if config:
             c_config = dict_to_c_map(config)
         exec_net.ie_core_impl = self.impl
-        exec_net.impl = move(self.impl.loadNetwork(network.impl, device_name.encode(), c_config, num_requests))
+        # compilation of the network doesn't need the interpreter, so other Python threads may run meanwhile
+        with nogil:
+            exec_net.impl = move(self.impl.loadNetwork(network.impl, c_device_name, c_config, num_requests))
         return exec_net
 
     ## Creates an executable network from a previously exported network
@@ -336,13 +346,16 @@ cdef class IECore:
     cpdef ExecutableNetwork import_network(self, str model_file, str device_name, config=None, int num_requests=1):
         cdef ExecutableNetwork exec_net = ExecutableNetwork()
         cdef map[string, string] c_config
+        cdef string c_model_file = model_file.encode()
+        cdef string c_device_name = device_name.encode()
         if num_requests < 0:
             raise ValueError("Incorrect number of requests specified: {}. Expected positive integer number "
                              "or zero for auto detection".format(num_requests))
         if config:
             c_config = dict_to_c_map(config)
         exec_net.ie_core_impl = self.impl
-        exec_net.impl = move(self.impl.importNetwork(model_file.encode(), device_name.encode(), c_config, num_requests))
+        with nogil:
+            exec_net.impl = move(self.impl.importNetwork(c_model_file, c_device_name, c_config, num_requests))
         return exec_net
 
     ## Queries the plugin with specified device name what network layers are supported in the current configuration.
@@ -585,6 +598,8 @@ cdef class ExecutableNetwork:
     #  Wraps `infer()` method of the `InferRequest` class
     #  @param inputs:  A dictionary that maps input layer names to `numpy.ndarray` objects of proper shape with
     #                  input data for the layer
+    #  @param share_inputs: If `True`, C-contiguous arrays of matching shape and precision are used by the request
+    #                       directly instead of being copied. See `infer()` method of the `InferRequest` class.
     #  @return A dictionary that maps output layer names to `numpy.ndarray` objects with output data of the layer
     #
     #  Usage example:\n
@@ -601,9 +616,9 @@ cdef class ExecutableNetwork:
     #                  ......
     #                 ]])}
     #  ```
-    def infer(self, inputs=None):
+    def infer(self, inputs=None, share_inputs=False):
         current_request = self.requests[0]
-        current_request.infer(inputs)
+        current_request.infer(inputs, share_inputs)
         res = {}
         for out in current_request._outputs_list:
             res[out] = deepcopy(current_request.output_blobs[out].buffer)
@@ -732,11 +747,18 @@ cdef class ExecutableNetwork:
     #                  If not specified, `timeout` value is set to -1 by default.
     #  @return Request status code: OK or RESULT_NOT_READY
     cpdef wait(self, num_requests=None, timeout=None):
+        cdef int status
+        cdef int c_num_requests
+        cdef int64_t c_timeout
         if num_requests is None:
             num_requests = len(self.requests)
         if timeout is None:
             timeout = WaitMode.RESULT_READY
-        return deref(self.impl).wait(<int> num_requests, <int64_t> timeout)
+        c_num_requests = <int> num_requests
+        c_timeout = <int64_t> timeout
+        with nogil:
+            status = deref(self.impl).wait(c_num_requests, c_timeout)
+        return status
 
     ## Get idle request ID
     #  @return Request index
@@ -753,6 +775,7 @@ cdef class InferRequest:
     #  which stores infer requests.
     def __init__(self):
         self._user_blobs = {}
+        self._shared_inputs = {}
         self._inputs_list = []
         self._outputs_list = []
         self._py_callback = lambda *args, **kwargs: None
@@ -823,7 +846,8 @@ cdef class InferRequest:
 
     ## Sets user defined IEBlob for the infer request
     #  @param blob_name: A name of input blob
-    #  @param blob: IEBlob object to set for the infer request
+    #  @param blob: IEBlob object to set for the infer request. A C-contiguous `numpy.ndarray` of the input shape
+    #               and precision is accepted as well, it is wrapped into IEBlob without copying the data.
     #  @return None
     #
     #  Usage example:\n
@@ -836,13 +860,29 @@ cdef class InferRequest:
     #  blob = IEBlob(td, blob_data)
     #  exec_net.requests[0].set_blob(blob_name="input_blob_name", blob=blob),
     #  ```
-    def set_blob(self, blob_name : str, blob : IEBlob):
-        deref(self.impl).setBlob(blob_name.encode(), blob._ptr)
-        self._user_blobs[blob_name] = blob
+    def set_blob(self, blob_name : str, blob : [IEBlob, np.ndarray]):
+        cdef IEBlob ie_blob
+        if isinstance(blob, np.ndarray):
+            ie_blob = self._wrap_array(blob_name, blob)
+            if ie_blob is None:
+                raise ValueError("Array of shape {} and type {} can't be shared with input {}, expected C-contiguous "
+                                 "array of input shape and precision".format(blob.shape, blob.dtype, blob_name))
+        else:
+            ie_blob = blob
+        deref(self.impl).setBlob(blob_name.encode(), ie_blob._ptr)
+        # the blob keeps the array alive, while it is used by the request
+        self._user_blobs[blob_name] = ie_blob
+        self._shared_inputs.pop(blob_name, None)
     ## Starts synchronous inference of the infer request and fill outputs array
     #
+    #  \note The Python interpreter lock is released during inference, so requests may be run from several Python threads
+    #  in parallel.
+    #
     #  @param inputs: A dictionary that maps input layer names to `numpy.ndarray` objects of proper shape with
     #                 input data for the layer
+    #  @param share_inputs: If `True`, C-contiguous arrays of the input shape and precision are set to the request as
+    #                       blobs without copying. The arrays must not be modified until the inference is finished.
+    #                       Other arrays are copied to the request blobs as usual.
     #  @return None
     #
     #  Usage example:\n
@@ -855,15 +895,18 @@ cdef class InferRequest:
     #         5.45198545e-02, 2.44456064e-02, 5.41366823e-03, 3.42589128e-03,
     #         2.26027006e-03, 2.12283316e-03 ...])
     #  ```
-    cpdef infer(self, inputs=None):
+    cpdef infer(self, inputs=None, share_inputs=False):
         if inputs is not None:
-            self._fill_inputs(inputs)
+            self._fill_inputs(inputs, share_inputs)
 
-        deref(self.impl).infer()
+        with nogil:
+            deref(self.impl).infer()
 
     ## Starts asynchronous inference of the infer request and fill outputs array
     #
     #  @param inputs: A dictionary that maps input layer names to `numpy.ndarray` objects of proper shape with input data for the layer
+    #  @param share_inputs: If `True`, C-contiguous arrays of the input shape and precision are used without copying.
+    #                       See `infer()` method.
     #  @return: None
     #
     #  Usage example:\n
@@ -873,12 +916,13 @@ cdef class InferRequest:
     #  request_status = exec_net.requests[0].wait()
     #  res = exec_net.requests[0].output_blobs['prob']
     #  ```
-    cpdef async_infer(self, inputs=None):
+    cpdef async_infer(self, inputs=None, share_inputs=False):
         if inputs is not None:
-            self._fill_inputs(inputs)
+            self._fill_inputs(inputs, share_inputs)
         if self._py_callback_used:
             self._py_callback_called.clear()
-        deref(self.impl).infer_async()
+        with nogil:
+            deref(self.impl).infer_async()
 
     ## Waits for the result to become available. Blocks until specified timeout elapses or the result
     #  becomes available, whichever comes first.
@@ -894,6 +938,8 @@ cdef class InferRequest:
     #
     #  Usage example: See `async_infer()` method of the the `InferRequest` class.
     cpdef wait(self, timeout=None):
+        cdef int status
+        cdef int64_t c_timeout
         if self._py_callback_used:
             # check request status to avoid blocking for idle requests
             status = deref(self.impl).wait(WaitMode.STATUS_ONLY)
@@ -912,7 +958,10 @@ cdef class InferRequest:
         if timeout is None:
             timeout = WaitMode.RESULT_READY
 
-        return deref(self.impl).wait(<int64_t> timeout)
+        c_timeout = <int64_t> timeout
+        with nogil:
+            status = deref(self.impl).wait(c_timeout)
+        return status
 
     ## Queries performance measures per layer to get feedback of what is the most time consuming layer.
     #
@@ -1002,11 +1051,198 @@ cdef class InferRequest:
             raise ValueError("Batch size should be positive integer number but {} specified".format(size))
         deref(self.impl).setBatch(size)
 
-    def _fill_inputs(self, inputs):
+    def _fill_inputs(self, inputs, share_inputs=False):
         for k, v in inputs.items():
             assert k in self._inputs_list, "No input with name {} found in network".format(k)
+            if share_inputs:
+                blob = self._wrap_array(k, v)
+                if blob is not None:
+                    if k not in self._shared_inputs:
+                        self._shared_inputs[k] = self.input_blobs[k]
+                    deref(self.impl).setBlob(k.encode(), (<IEBlob> blob)._ptr)
+                    self._user_blobs[k] = blob
+                    continue
+            if k in self._shared_inputs:
+                # data is copied to the blob used before sharing, not to the previously shared array
+                self.set_blob(k, self._shared_inputs[k])
             self.input_blobs[k].buffer[:] = v
 
+    # Wraps the array into IEBlob without copying if it matches the input blob, otherwise returns None
+    def _wrap_array(self, blob_name, array):
+        if not isinstance(array, np.ndarray) or not array.flags['C_CONTIGUOUS']:
+            return None
+        tensor_desc = self.input_blobs[blob_name].tensor_desc
+        precision = tensor_desc.precision
+        if precision == "FP16" or precision not in format_map or array.dtype != format_map[precision]:
+            return None
+        if list(array.shape) != list(tensor_desc.dims):
+            return None
+        return IEBlob(tensor_desc, array)
+
+
+def _set_future_result(future, result):
+    if not future.done():
+        future.set_result(result)
+
+def _set_future_exception(future, exception):
+    if not future.done():
+        future.set_exception(exception)
+
+## This class provides a pool of infer requests of `ExecutableNetwork`. Each job is started on any idle request
+#  of the pool, a callback set with `set_callback()` is called with the request and the job userdata on completion.
+#  Jobs may be awaited from the `asyncio` event loop with `infer_async()`, so a single Python process is able
+#  to keep all device streams busy without polling.
+cdef class AsyncInferQueue:
+    ## Class constructor
+    #  @param network: `ExecutableNetwork` to create the infer requests of the pool from
+    #  @param jobs: Number of infer requests in the pool. Value `0` indicates that optimal number of infer requests
+    #               will be created.
+    #  @return Instance of AsyncInferQueue class
+    #
+    #  Usage example:\n
+    #  ```python
+    #  ie = IECore()
+    #  net = ie.read_network(model=path_to_xml_file, weights=path_to_bin_file)
+    #  exec_net = ie.load_network(network=net, device_name="CPU")
+    #  infer_queue = AsyncInferQueue(exec_net, jobs=4)
+    #  infer_queue.set_callback(lambda request, userdata: print(userdata, request.output_blobs['prob'].buffer))
+    #  for i, image in enumerate(images):
+    #      infer_queue.start_async({'data': image}, userdata=i)
+    #  infer_queue.wait_all()
+    #  ```
+    def __init__(self, ExecutableNetwork network, int jobs=0):
+        cdef InferRequest request
+        if jobs < 0:
+            raise ValueError("Incorrect number of jobs specified: {}. Expected positive integer number "
+                             "or zero for auto detection".format(jobs))
+        self._network = network
+        self.impl = move(deref(network.impl).createAsyncInferQueue(jobs))
+        self._requests = []
+        self._callback = None
+        self._waiters = deque()
+        inputs_list = list(network.inputs.keys())
+        outputs_list = list(network.outputs.keys())
+        for i in range(deref(self.impl).requests.size()):
+            request = InferRequest()
+            request.impl = &(deref(self.impl).requests[i])
+            request._inputs_list = inputs_list
+            request._outputs_list = outputs_list
+            request.set_completion_callback(self._job_done, i)
+            self._requests.append(request)
+        self._userdata = [None] * len(self._requests)
+        self._futures = [None] * len(self._requests)
+        deref(self.impl).setCyCallback(<cb_type> self._request_idle, <void *> self)
+
+    def __dealloc__(self):
+        # callbacks of running jobs refer to this object
+        if self.impl.get() != NULL:
+            with nogil:
+                deref(self.impl).waitAll()
+
+    def __len__(self):
+        return len(self._requests)
+
+    ## A tuple of `InferRequest` instances of the pool
+    @property
+    def requests(self):
+        return tuple(self._requests)
+
+    ## Sets a function called on completion of each job
+    #  @param callback: A function called with the `InferRequest` which run the job and the job userdata.
+    #                   The request is not reused until the callback returns, so its outputs may be read.
+    #  @return None
+    def set_callback(self, callback):
+        self._callback = callback
+
+    ## Starts the job on an idle infer request of the pool. Blocks while all the requests are busy.
+    #  @param inputs: A dictionary that maps input layer names to `numpy.ndarray` objects of proper shape with
+    #                 input data for the layer
+    #  @param userdata: Any data passed to the callback of the job
+    #  @param share_inputs: If `True`, C-contiguous arrays are used by the request without copying.
+    #                       See `infer()` method of the `InferRequest` class.
+    #  @return Index of the request which runs the job
+    def start_async(self, inputs=None, userdata=None, share_inputs=False):
+        cdef int request_id
+        with nogil:
+            request_id = deref(self.impl).getIdleRequestId(True)
+        self._start(request_id, inputs, userdata, share_inputs, None)
+        return request_id
+
+    ## Coroutine which runs the job on an idle infer request of the pool. Waits for an idle request
+    #  and for the result without blocking the event loop.
+    #  @param inputs: A dictionary that maps input layer names to `numpy.ndarray` objects of proper shape with
+    #                 input data for the layer
+    #  @param userdata: Any data passed to the callback of the job
+    #  @param share_inputs: If `True`, C-contiguous arrays are used by the request without copying.
+    #                       See `infer()` method of the `InferRequest` class.
+    #  @return A dictionary that maps output layer names to `numpy.ndarray` objects with output data of the layer
+    #
+    #  Usage example:\n
+    #  ```python
+    #  infer_queue = AsyncInferQueue(exec_net)
+    #  async def classify(images):
+    #      return await asyncio.gather(*[infer_queue.infer_async({'data': image}) for image in images])
+    #  results = asyncio.get_event_loop().run_until_complete(classify(images))
+    #  ```
+    async def infer_async(self, inputs=None, userdata=None, share_inputs=False):
+        loop = asyncio.get_event_loop()
+        request_id = deref(self.impl).getIdleRequestId(False)
+        while request_id < 0:
+            waiter = loop.create_future()
+            self._waiters.append((loop, waiter))
+            # a request may be released before the waiter is added, so check once again
+            request_id = deref(self.impl).getIdleRequestId(False)
+            if request_id >= 0:
+                waiter.cancel()
+                break
+            await waiter
+            request_id = deref(self.impl).getIdleRequestId(False)
+        future = loop.create_future()
+        self._start(request_id, inputs, userdata, share_inputs, (loop, future))
+        return await future
+
+    ## Waits until all the jobs of the pool are finished
+    #  @return None
+    def wait_all(self):
+        with nogil:
+            deref(self.impl).waitAll()
+
+    def _start(self, request_id, inputs, userdata, share_inputs, future):
+        self._userdata[request_id] = userdata
+        self._futures[request_id] = future
+        try:
+            self._requests[request_id].async_infer(inputs, share_inputs)
+        except:
+            self._userdata[request_id] = None
+            self._futures[request_id] = None
+            deref(self.impl).releaseRequest(request_id)
+            raise
+
+    def _job_done(self, status, request_id):
+        request = self._requests[request_id]
+        userdata = self._userdata[request_id]
+        future = self._futures[request_id]
+        self._userdata[request_id] = None
+        self._futures[request_id] = None
+        if future is not None:
+            loop, future = future
+            if status == StatusCode.OK:
+                # the request is reused by the next job before the awaiting coroutine reads the outputs
+                outputs = {name: deepcopy(blob.buffer) for name, blob in request.output_blobs.items()}
+                loop.call_soon_threadsafe(_set_future_result, future, outputs)
+            else:
+                loop.call_soon_threadsafe(_set_future_exception, future,
+                                          RuntimeError("Async Infer Request failed with status code {}".format(status)))
+        if self._callback is not None:
+            self._callback(request, userdata)
+
+    cdef void _request_idle(self, int index) with gil:
+        # all waiters are woken, since some of them may be cancelled already
+        while self._waiters:
+            loop, waiter = self._waiters.popleft()
+            if not waiter.done():
+                loop.call_soon_threadsafe(_set_future_result, waiter, None)
+
 
 ## Layer calibration statistic container.
 class LayerStats:
@@ -490,6 +490,20 @@ void InferenceEnginePython::InferRequestWrap::setBatch(int size) {
     IE_CHECK_CALL(request_ptr->SetBatch(size, &response));
 }
 
+void pool_callback(InferenceEngine::IInferRequest::Ptr request, InferenceEngine::StatusCode code) {
+    InferenceEnginePython::InferRequestWrap *requestWrap;
+    InferenceEngine::ResponseDesc dsc;
+    request->GetUserData(reinterpret_cast<void **>(&requestWrap), &dsc);
+    auto end_time = Time::now();
+    auto execTime = std::chrono::duration_cast<ns>(end_time - requestWrap->start_time);
+    requestWrap->exec_time = static_cast<double>(execTime.count()) * 0.000001;
+    // the request is returned to the pool after the user callback, so outputs can't be overwritten while it runs
+    if (requestWrap->user_callback) {
+        requestWrap->user_callback(requestWrap->user_data, code);
+    }
+    requestWrap->request_pool_ptr->release(requestWrap->index);
+}
+
 void latency_callback(InferenceEngine::IInferRequest::Ptr request, InferenceEngine::StatusCode code) {
     if (code != InferenceEngine::StatusCode::OK) {
         THROW_IE_EXCEPTION << "Async Infer Request failed with status code " << code;
@@ -522,7 +536,10 @@ void InferenceEnginePython::InferRequestWrap::infer() {
 
 void InferenceEnginePython::InferRequestWrap::infer_async() {
     InferenceEngine::ResponseDesc response;
-    request_queue_ptr->setRequestBusy(index);
+    // requests of the pool are marked busy when acquired
+    if (request_queue_ptr) {
+        request_queue_ptr->setRequestBusy(index);
+    }
     start_time = Time::now();
     IE_CHECK_CALL(request_ptr->StartAsync(&response));
 }
@@ -530,7 +547,7 @@ void InferenceEnginePython::InferRequestWrap::infer_async() {
 int InferenceEnginePython::InferRequestWrap::wait(int64_t timeout) {
     InferenceEngine::ResponseDesc responseDesc;
     InferenceEngine::StatusCode code = request_ptr->Wait(timeout, &responseDesc);
-    if (code != InferenceEngine::RESULT_NOT_READY) {
+    if (code != InferenceEngine::RESULT_NOT_READY && request_queue_ptr) {
         request_queue_ptr->setRequestIdle(index);
     }
     return static_cast<int>(code);
@@ -620,6 +637,110 @@ int InferenceEnginePython::IdleInferRequestQueue::getIdleRequestId() {
     return idle_ids.size() ? idle_ids.front() : -1;
 }
 
+InferenceEnginePython::IdleInferRequestPool::IdleInferRequestPool(size_t size) :
+        size(size), busy(new std::atomic<bool>[size]), idle_count(size), next_index(0), waiters(0) {
+    for (size_t i = 0; i < size; ++i) {
+        busy[i] = false;
+    }
+}
+
+int InferenceEnginePython::IdleInferRequestPool::tryAcquire() {
+    // start from the index after the last acquired one to spread requests over the pool
+    size_t start = next_index.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < size; ++i) {
+        size_t index = (start + i) % size;
+        bool expected = false;
+        if (!busy[index].load(std::memory_order_relaxed) && busy[index].compare_exchange_strong(expected, true)) {
+            next_index.store(index + 1, std::memory_order_relaxed);
+            idle_count--;
+            return static_cast<int>(index);
+        }
+    }
+    return -1;
+}
+
+int InferenceEnginePython::IdleInferRequestPool::acquire() {
+    int index = tryAcquire();
+    if (index >= 0) {
+        return index;
+    }
+    waiters++;
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [&] { return (index = tryAcquire()) >= 0; });
+    }
+    waiters--;
+    return index;
+}
+
+void InferenceEnginePython::IdleInferRequestPool::release(int index) {
+    busy[index] = false;
+    idle_count++;
+    if (waiters > 0) {
+        std::lock_guard<std::mutex> lock(mutex);
+        cv.notify_all();
+    }
+    if (idle_callback) {
+        idle_callback(idle_data, index);
+    }
+}
+
+void InferenceEnginePython::IdleInferRequestPool::waitAll() {
+    if (idle_count == size) {
+        return;
+    }
+    waiters++;
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [&] { return idle_count == size; });
+    }
+    waiters--;
+}
+
+void InferenceEnginePython::IdleInferRequestPool::setCyCallback(cy_callback callback, void *data) {
+    idle_callback = callback;
+    idle_data = data;
+}
+
+InferenceEnginePython::AsyncInferQueue::AsyncInferQueue(const InferenceEngine::IExecutableNetwork::Ptr &network,
+                                                        int jobs) {
+    if (0 == jobs) {
+        jobs = getOptimalNumberOfRequests(network);
+    }
+    requests.resize(jobs);
+    pool = std::make_shared<IdleInferRequestPool>(jobs);
+    InferenceEngine::ResponseDesc response;
+    for (int i = 0; i < jobs; ++i) {
+        InferRequestWrap &infer_request = requests[i];
+        infer_request.index = i;
+        infer_request.request_pool_ptr = pool;
+        IE_CHECK_CALL(network->CreateInferRequest(infer_request.request_ptr, &response))
+        IE_CHECK_CALL(infer_request.request_ptr->SetUserData(&infer_request, &response));
+        infer_request.request_ptr->SetCompletionCallback(pool_callback);
+    }
+}
+
+int InferenceEnginePython::AsyncInferQueue::getIdleRequestId(bool block) {
+    return block ? pool->acquire() : pool->tryAcquire();
+}
+
+void InferenceEnginePython::AsyncInferQueue::releaseRequest(int index) {
+    pool->release(index);
+}
+
+void InferenceEnginePython::AsyncInferQueue::waitAll() {
+    pool->waitAll();
+}
+
+void InferenceEnginePython::AsyncInferQueue::setCyCallback(IdleInferRequestPool::cy_callback callback, void *data) {
+    pool->setCyCallback(callback, data);
+}
+
+std::unique_ptr<InferenceEnginePython::AsyncInferQueue>
+InferenceEnginePython::IEExecNetwork::createAsyncInferQueue(int jobs) {
+    return InferenceEnginePython::make_unique<InferenceEnginePython::AsyncInferQueue>(actual, jobs);
+}
+
 void InferenceEnginePython::IEExecNetwork::createInferRequests(int num_requests) {
     if (0 == num_requests) {
         num_requests = getOptimalNumberOfRequests(actual);
@@ -19,6 +19,8 @@
 #include <queue>
 #include <condition_variable>
 #include <mutex>
+#include <atomic>
+#include <memory>
 
 #include <ie_extension.h>
 #include "inference_engine.hpp"
@@ -91,6 +93,34 @@ struct IdleInferRequestQueue {
     using Ptr = std::shared_ptr<IdleInferRequestQueue>;
 };
 
+/**
+ * Pool of idle infer request indexes. Requests are acquired and released with atomic operations only,
+ * the mutex is taken by the threads which wait while all the requests are busy.
+ */
+struct IdleInferRequestPool {
+    using cy_callback = void (*)(void*, int);
+    using Ptr = std::shared_ptr<IdleInferRequestPool>;
+
+    explicit IdleInferRequestPool(size_t size);
+
+    int tryAcquire();
+    int acquire();
+    void release(int index);
+    void waitAll();
+
+    void setCyCallback(cy_callback callback, void *data);
+
+    size_t size;
+    std::unique_ptr<std::atomic<bool>[]> busy;
+    std::atomic<size_t> idle_count;
+    std::atomic<size_t> next_index;
+    std::atomic<int> waiters;
+    std::mutex mutex;
+    std::condition_variable cv;
+    cy_callback idle_callback = nullptr;
+    void *idle_data = nullptr;
+};
+
 
 struct InferRequestWrap {
     int index;
@@ -102,6 +132,7 @@ struct InferRequestWrap {
     cy_callback user_callback;
     void *user_data;
     IdleInferRequestQueue::Ptr  request_queue_ptr;
+    IdleInferRequestPool::Ptr  request_pool_ptr;
 
     void infer();
 
@@ -121,6 +152,20 @@ struct InferRequestWrap {
 };
 
 
+struct AsyncInferQueue {
+    std::vector<InferRequestWrap> requests;
+    IdleInferRequestPool::Ptr pool;
+
+    AsyncInferQueue(const InferenceEngine::IExecutableNetwork::Ptr &network, int jobs);
+
+    int getIdleRequestId(bool block);
+    void releaseRequest(int index);
+    void waitAll();
+
+    void setCyCallback(IdleInferRequestPool::cy_callback callback, void *data);
+};
+
+
 struct IEExecNetwork {
     InferenceEngine::IExecutableNetwork::Ptr actual;
     std::vector<InferRequestWrap> infer_requests;
@@ -143,6 +188,8 @@ struct IEExecNetwork {
     int wait(int num_requests, int64_t timeout);
     int getIdleRequestId();
 
+    std::unique_ptr<AsyncInferQueue> createAsyncInferQueue(int jobs);
+
     void createInferRequests(int num_requests);
 };
 
@@ -121,8 +121,9 @@ cdef extern from "ie_api_impl.hpp" namespace "InferenceEnginePython":
         void exportNetwork(const string & model_file) except +
         object getMetric(const string & metric_name) except +
         object getConfig(const string & metric_name) except +
-        int wait(int num_requests, int64_t timeout)
+        int wait(int num_requests, int64_t timeout) nogil
         int getIdleRequestId()
+        unique_ptr[AsyncInferQueue] createAsyncInferQueue(int jobs) except +
 
     cdef cppclass IENetwork:
         IENetwork() except +
@@ -164,22 +165,29 @@ cdef extern from "ie_api_impl.hpp" namespace "InferenceEnginePython":
         void getBlobPtr(const string & blob_name, Blob.Ptr & blob_ptr) except +
         void setBlob(const string & blob_name, const Blob.Ptr & blob_ptr) except +
         map[string, ProfileInfo] getPerformanceCounts() except +
-        void infer() except +
-        void infer_async() except +
-        int wait(int64_t timeout) except +
+        void infer() nogil except +
+        void infer_async() nogil except +
+        int wait(int64_t timeout) nogil except +
         void setBatch(int size) except +
         void setCyCallback(void (*)(void*, int), void *) except +
 
+    cdef cppclass AsyncInferQueue:
+        vector[InferRequestWrap] requests
+        int getIdleRequestId(bool block) nogil
+        void releaseRequest(int index) nogil
+        void waitAll() nogil
+        void setCyCallback(void (*)(void*, int), void *)
+
     cdef cppclass IECore:
         IECore() except +
         IECore(const string & xml_config_file) except +
         map[string, Version] getVersions(const string & deviceName) except +
-        IENetwork readNetwork(const string& modelPath, const string& binPath) except +
-        IENetwork readNetwork(const string& modelPath,uint8_t*bin, size_t bin_size) except +
+        IENetwork readNetwork(const string& modelPath, const string& binPath) nogil except +
+        IENetwork readNetwork(const string& modelPath,uint8_t*bin, size_t bin_size) nogil except +
         unique_ptr[IEExecNetwork] loadNetwork(IENetwork network, const string deviceName,
-                                              const map[string, string] & config, int num_requests) except +
+                                              const map[string, string] & config, int num_requests) nogil except +
         unique_ptr[IEExecNetwork] importNetwork(const string & modelFIle, const string & deviceName,
-                                                const map[string, string] & config, int num_requests) except +
+                                                const map[string, string] & config, int num_requests) nogil except +
         map[string, string] queryNetwork(IENetwork network, const string deviceName,
                                          const map[string, string] & config) except +
         void setConfig(const map[string, string] & config, const string & deviceName) except +
@@ -0,0 +1,95 @@
+import asyncio
+import numpy as np
+import os
+import pytest
+
+from openvino.inference_engine import ie_api as ie
+from conftest import model_path, image_path
+
+is_myriad = os.environ.get("TEST_DEVICE") == "MYRIAD"
+test_net_xml, test_net_bin = model_path(is_myriad)
+path_to_img = image_path()
+
+
+def read_image():
+    import cv2
+    n, c, h, w = (1, 3, 32, 32)
+    image = cv2.imread(path_to_img) / 255
+    if image is None:
+        raise FileNotFoundError("Input image not found")
+
+    image = cv2.resize(image, (h, w))
+    image = image.transpose((2, 0, 1)).astype(np.float32)
+    image = image.reshape((n, c, h, w))
+    return image
+
+
+def load_sample_model(device):
+    ie_core = ie.IECore()
+    net = ie_core.read_network(test_net_xml, test_net_bin)
+    return ie_core.load_network(net, device)
+
+
+def test_create_queue(device):
+    exec_net = load_sample_model(device)
+    infer_queue = ie.AsyncInferQueue(exec_net, jobs=3)
+    assert len(infer_queue) == 3
+    assert len(infer_queue.requests) == 3
+    assert list(infer_queue.requests[0].input_blobs.keys()) == ['data']
+
+
+def test_create_queue_negative_jobs(device):
+    exec_net = load_sample_model(device)
+    with pytest.raises(ValueError) as e:
+        ie.AsyncInferQueue(exec_net, jobs=-1)
+    assert "Incorrect number of jobs specified: -1" in str(e.value)
+
+
+def test_start_async_callback(device):
+    exec_net = load_sample_model(device)
+    infer_queue = ie.AsyncInferQueue(exec_net, jobs=2)
+    img = read_image()
+    results = {}
+
+    def callback(request, userdata):
+        results[userdata] = np.argmax(request.output_blobs['fc_out'].buffer)
+
+    infer_queue.set_callback(callback)
+    for i in range(8):
+        request_id = infer_queue.start_async({'data': img}, userdata=i)
+        assert 0 <= request_id < 2
+    infer_queue.wait_all()
+    assert results == {i: 2 for i in range(8)}
+
+
+def test_infer_async_asyncio(device):
+    exec_net = load_sample_model(device)
+    infer_queue = ie.AsyncInferQueue(exec_net, jobs=2)
+    img = read_image()
+    userdatas = []
+    infer_queue.set_callback(lambda request, userdata: userdatas.append(userdata))
+
+    async def run():
+        return await asyncio.gather(*[infer_queue.infer_async({'data': img}, userdata=i) for i in range(6)])
+
+    results = asyncio.get_event_loop().run_until_complete(run())
+    assert len(results) == 6
+    for res in results:
+        assert np.argmax(res['fc_out']) == 2
+    assert sorted(userdatas) == list(range(6))
+
+
+def test_infer_async_results_are_not_overwritten(device):
+    exec_net = load_sample_model(device)
+    infer_queue = ie.AsyncInferQueue(exec_net, jobs=2)
+    img = read_image()
+    inputs = [img * (i + 1) / 8 for i in range(8)]
+    refs = [exec_net.infer({'data': data})['fc_out'] for data in inputs]
+
+    async def run():
+        return await asyncio.gather(*[infer_queue.infer_async({'data': data}) for data in inputs])
+
+    results = asyncio.get_event_loop().run_until_complete(run())
+    assert len(results) == len(refs)
+    for res, ref in zip(results, refs):
+        assert np.allclose(res['fc_out'], ref)
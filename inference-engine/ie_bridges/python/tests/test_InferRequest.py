@@ -451,3 +451,79 @@ def test_blob_setter(device):
     request.infer()
     res_2 = np.sort(request.output_blobs['fc_out'].buffer)
     assert np.allclose(res_1, res_2, atol=1e-2, rtol=1e-2)
+
+
+def test_infer_share_inputs(device):
+    ie_core = ie.IECore()
+    net = ie_core.read_network(test_net_xml, test_net_bin)
+    exec_net = ie_core.load_network(net, device, num_requests=1)
+    img = read_image()
+    request = exec_net.requests[0]
+    request.infer({'data': img}, share_inputs=True)
+    assert np.shares_memory(request.input_blobs['data'].buffer, img)
+    res = request.output_blobs['fc_out'].buffer
+    assert np.argmax(res) == 2
+    # next copy doesn't overwrite previously shared array
+    request.infer({'data': np.zeros_like(img)})
+    assert not np.shares_memory(request.input_blobs['data'].buffer, img)
+    assert np.count_nonzero(img) > 0
+    del exec_net
+    del ie_core
+    del net
+
+
+def test_infer_share_inputs_non_contiguous(device):
+    ie_core = ie.IECore()
+    net = ie_core.read_network(test_net_xml, test_net_bin)
+    exec_net = ie_core.load_network(net, device, num_requests=1)
+    img = np.asfortranarray(read_image())
+    request = exec_net.requests[0]
+    request.infer({'data': img}, share_inputs=True)
+    assert not np.shares_memory(request.input_blobs['data'].buffer, img)
+    res = request.output_blobs['fc_out'].buffer
+    assert np.argmax(res) == 2
+    del exec_net
+    del ie_core
+    del net
+
+
+def test_set_blob_array(device):
+    ie_core = ie.IECore()
+    net = ie_core.read_network(test_net_xml, test_net_bin)
+    exec_net = ie_core.load_network(net, device, num_requests=1)
+    img = read_image()
+    request = exec_net.requests[0]
+    request.set_blob('data', img)
+    request.infer()
+    assert np.argmax(request.output_blobs['fc_out'].buffer) == 2
+    with pytest.raises(ValueError) as e:
+        request.set_blob('data', img.astype(np.float64))
+    assert "can't be shared with input data" in str(e.value)
+    del exec_net
+    del ie_core
+    del net
+
+
+def test_infer_from_threads(device):
+    ie_core = ie.IECore()
+    net = ie_core.read_network(test_net_xml, test_net_bin)
+    exec_net = ie_core.load_network(net, device, num_requests=4)
+    img = read_image()
+    requests = exec_net.requests
+    results = [None] * len(requests)
+
+    def run(idx):
+        request = requests[idx]
+        for _ in range(10):
+            request.infer({'data': img}, share_inputs=True)
+        results[idx] = np.argmax(request.output_blobs['fc_out'].buffer)
+
+    threads = [threading.Thread(target=run, args=(i,)) for i in range(len(requests))]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    assert results == [2] * len(requests)
+    del exec_net
+    del ie_core
+    del net
@@ -0,0 +1,46 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header that defines advanced related properties for Auto-Batching plugin.
+ * These properties should be used in SetConfig() and LoadNetwork() methods
+ *
+ * @file auto_batch_config.hpp
+ */
+
+#pragma once
+
+#include <string>
+#include "ie_plugin_config.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief Auto-Batching plugin configuration
+ */
+namespace AutoBatchConfigParams {
+
+/**
+ * @def AUTO_BATCH_CONFIG_KEY(name)
+ * @brief A macro which provides an AUTO_BATCH-mangled name for configuration key with name `name`
+ */
+#define AUTO_BATCH_CONFIG_KEY(name) InferenceEngine::AutoBatchConfigParams::_CONFIG_KEY(AUTO_BATCH_##name)
+
+#define DECLARE_AUTO_BATCH_CONFIG_KEY(name) DECLARE_CONFIG_KEY(AUTO_BATCH_##name)
+#define DECLARE_AUTO_BATCH_CONFIG_VALUE(name) DECLARE_CONFIG_VALUE(AUTO_BATCH_##name)
+
+/**
+ * @brief Device config option, with the device the batched network is loaded to and the batch size in brackets,
+ * e.g. "CPU(16)". It is set by the Core when the network is loaded to the "BATCH:CPU(16)" device.
+ */
+DECLARE_AUTO_BATCH_CONFIG_KEY(DEVICE);
+
+/**
+ * @brief Timeout in milliseconds to wait for the batch to be collected. When it expires, the collected requests
+ * are inferred with a smaller batch. Default value is "10".
+ */
+DECLARE_AUTO_BATCH_CONFIG_KEY(TIMEOUT);
+
+}  // namespace AutoBatchConfigParams
+}  // namespace InferenceEngine
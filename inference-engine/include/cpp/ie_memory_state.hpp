@@ -10,6 +10,7 @@
 
 #include <string>
 #include <ie_imemory_state.hpp>
+#include "details/ie_exception_conversion.hpp"
 
 namespace InferenceEngine {
 
@@ -0,0 +1,114 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for the post-training calibration API
+ *
+ * @file ie_calibration.hpp
+ */
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+
+#include <ie_core.hpp>
+
+namespace InferenceEngine {
+
+/**
+ * @brief Describes how the ranges of quantized tensors are chosen
+ */
+struct CalibrationConfig {
+    /**
+     * @brief Algorithms choosing the range of an activation tensor from its statistics
+     */
+    enum class RangeAlgorithm {
+        MinMax,      //!< The range covers all values seen on the calibration dataset
+        Percentile,  //!< The range covers the given percentile of absolute values
+        KL,          //!< The range minimizes Kullback-Leibler divergence between original and quantized distributions
+    };
+
+    /**
+     * @brief Algorithm choosing the ranges of activations
+     */
+    RangeAlgorithm algorithm = RangeAlgorithm::MinMax;
+
+    /**
+     * @brief Percentile of absolute values covered by the range, used by RangeAlgorithm::Percentile
+     */
+    float percentile = 99.99f;
+
+    /**
+     * @brief Number of bins of histograms of absolute values, used by RangeAlgorithm::Percentile and RangeAlgorithm::KL
+     */
+    size_t histogramBins = 2048;
+
+    /**
+     * @brief Quantizes convolution weights per output channel, otherwise weights are quantized per tensor
+     */
+    bool perChannelWeights = true;
+
+    /**
+     * @brief Device the float network is inferred on during calibration
+     */
+    std::string device = "CPU";
+
+    /**
+     * @brief Configuration of the device used to load the float network
+     */
+    std::map<std::string, std::string> deviceConfig;
+};
+
+/**
+ * @brief Calibrates a float network on representative data and produces a network with FakeQuantize operations.
+ *
+ * The activations and constant weights of Convolution, GroupConvolution and MatMul operations are quantized. The
+ * statistics of the activations are collected by inferring the network with the activations added as extra outputs.
+ * Activations get 256 quantization levels, weights get 255 symmetric levels. The produced network is consumed by the
+ * low precision transformations of the plugins when it is loaded. The network must be created from an ngraph Function.
+ */
+class INFERENCE_ENGINE_API_CLASS(Calibrator) {
+public:
+    class Impl;
+
+    /**
+     * @brief Loads the float network with its activations instrumented on the device
+     *
+     * @param core Core used to load the network, must outlive the calibrator
+     * @param network The float network
+     * @param config Calibration configuration
+     */
+    Calibrator(Core& core, const CNNNetwork& network, const CalibrationConfig& config = {});
+
+    /**
+     * @brief Releases the instrumented network
+     */
+    ~Calibrator();
+
+    /**
+     * @brief Infers one sample of the dataset and updates the statistics of the activations
+     *
+     * @param inputs Blobs for all inputs of the network
+     */
+    void Collect(const BlobMap& inputs);
+
+    /**
+     * @brief Returns a number of collected samples
+     * @return Number of samples
+     */
+    size_t GetSamplesCount() const;
+
+    /**
+     * @brief Creates a copy of the network with FakeQuantize operations on the calibrated activations and weights
+     *
+     * @return The quantized network, its ngraph Function is available with CNNNetwork::getFunction
+     */
+    CNNNetwork Quantize() const;
+
+private:
+    std::shared_ptr<Impl> _impl;
+};
+
+}  // namespace InferenceEngine
@@ -18,6 +18,7 @@
 #include <string>
 
 #include "ie_common.h"
+#include "ie_imemory_state.hpp"
 #include "ie_preprocess.hpp"
 
 namespace InferenceEngine {
@@ -178,6 +179,21 @@ public:
      * @return Enumeration of the resulted action: InferenceEngine::OK (0) for success
      */
     virtual InferenceEngine::StatusCode SetBatch(int batch_size, ResponseDesc* resp) noexcept = 0;
+
+    /**
+     * @brief Gets state control interface for given infer request.
+     *
+     * Unlike IExecutableNetwork::QueryState, the states returned here are owned by this request only, so
+     * several requests of one stateful network can run in parallel on different streams without mixing
+     * their recurrent states
+     *
+     * @param pState reference to a pointer that receives internal states
+     * @param idx requested index for receiving memory state
+     * @param resp Optional: pointer to an already allocated object to contain information in case of failure
+     * @return Status code of the operation: InferenceEngine::OK (0) for success, OUT_OF_BOUNDS (-6) no memory state for
+     * given index
+     */
+    virtual StatusCode QueryState(IMemoryState::Ptr& pState, size_t idx, ResponseDesc* resp) noexcept = 0;
 };
 
 }  // namespace InferenceEngine
@@ -360,5 +360,38 @@ DECLARE_CONFIG_KEY(DUMP_EXEC_GRAPH_AS_DOT);
  */
 DECLARE_CONFIG_KEY(ENFORCE_BF16);
 
+/**
+ * @brief The key allows input blobs of CPU infer requests to have shapes different from the network ones.
+ *
+ * The executable network compiles a graph for each new set of input shapes on first use and keeps
+ * the given number of the least recently used ones. The paired parameter value should be convertible
+ * to integer number. Acceptable values:
+ * 0 - Input shapes are static (default)
+ * >0 - Number of the cached shape variants
+ */
+DECLARE_CONFIG_KEY(CPU_SHAPE_CACHE_SIZE);
+
+/**
+ * @brief The key rounds up the batch of the input blobs to a multiple of the given value.
+ *
+ * Used together with KEY_CPU_SHAPE_CACHE_SIZE to limit the number of compiled variants. Applies only to
+ * the networks which support KEY_DYN_BATCH_ENABLED, the padded part of the batch is not processed and
+ * outputs have the batch of the inputs. Other dimensions are never rounded. Default value is 1, i.e. no rounding.
+ */
+DECLARE_CONFIG_KEY(CPU_SHAPE_BUCKET);
+
+/**
+ * @brief The key makes the CPU plugin store FP32 weights of FullyConnected layers in a compressed form.
+ *
+ * Weights are decompressed on the fly during inference, it reduces the memory footprint and the memory bandwidth
+ * of bandwidth bound layers without calibration of activations. Acceptable values:
+ * PluginConfigParams::NO - weights are not compressed (default)
+ * PluginConfigParams::I8 - symmetric INT8 weights with a scale per output channel
+ * PluginConfigParams::I4 - symmetric INT4 weights with a scale per group of 32 input channels of each output channel
+ */
+DECLARE_CONFIG_KEY(CPU_WEIGHTS_COMPRESSION);
+DECLARE_CONFIG_VALUE(I8);
+DECLARE_CONFIG_VALUE(I4);
+
 }  // namespace PluginConfigParams
 }  // namespace InferenceEngine
@@ -0,0 +1,132 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for the streaming inference API over stateful networks
+ *
+ * @file ie_streaming_session.hpp
+ */
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <cpp/ie_executable_network.hpp>
+
+namespace InferenceEngine {
+
+/**
+ * @brief Describes how the frames of a stream are fed to the network
+ */
+struct StreamingConfig {
+    /**
+     * @brief Number of frames the network looks back. The first frame of a stream is repeated to fill them.
+     */
+    size_t leftContext = 0;
+
+    /**
+     * @brief Number of frames the network looks ahead. The scores are delayed by the context and the last frame
+     * of a stream is repeated on StreamingSession::Finish to flush them.
+     */
+    size_t rightContext = 0;
+};
+
+/**
+ * @brief A single audio stream inferred frame by frame on a StreamingPool.
+ *
+ * The network must have one FP32 input and one FP32 output, the outermost dimension of both is the number of frames
+ * inferred at once. The memory states of the network are kept per session, so the sessions of a pool are
+ * independent of each other. The methods of a session must not be called concurrently, different sessions can be
+ * used from different threads.
+ */
+class INFERENCE_ENGINE_API_CLASS(StreamingSession) {
+public:
+    class Impl;
+
+    /**
+     * @brief A smart pointer to the StreamingSession object
+     */
+    using Ptr = std::shared_ptr<StreamingSession>;
+
+    /**
+     * @brief Constructs a session from the implementation, use StreamingPool::OpenSession instead
+     * @param impl The session implementation
+     */
+    explicit StreamingSession(const std::shared_ptr<Impl>& impl);
+
+    /**
+     * @brief Closes the session and releases its memory states
+     */
+    ~StreamingSession();
+
+    /**
+     * @brief Feeds the frames of the stream, the frames that do not fill a batch are kept till the next call
+     *
+     * @param frames Frames laid out one after another, GetFrameSize() values each
+     * @param numFrames Number of frames, may be any
+     * @param scores The scores ready after these frames are appended to the vector, GetScoreSize() values each
+     * @return Number of appended score frames
+     */
+    size_t Push(const float* frames, size_t numFrames, std::vector<float>& scores);
+
+    /**
+     * @brief Infers the kept frames and flushes the right context, then resets the session for a new stream
+     *
+     * @param scores The remaining scores of the stream are appended to the vector
+     * @return Number of appended score frames
+     */
+    size_t Finish(std::vector<float>& scores);
+
+    /**
+     * @brief Drops the kept frames and resets the memory states of the session
+     */
+    void Reset();
+
+    /**
+     * @brief Returns a number of values in one input frame
+     * @return Frame size
+     */
+    size_t GetFrameSize() const;
+
+    /**
+     * @brief Returns a number of values in one output frame
+     * @return Score size
+     */
+    size_t GetScoreSize() const;
+
+private:
+    std::shared_ptr<Impl> _impl;
+};
+
+/**
+ * @brief A pool of infer requests of a stateful network shared by streaming sessions.
+ *
+ * Any number of sessions can be opened on a pool. A session borrows an idle request for every inference, if the
+ * request was last used by another session the memory states are swapped out to that session and the states of the
+ * borrowing session are swapped in. A session prefers the request it has used last, so with as many requests as
+ * active sessions no swapping happens. Swapping needs plugins that implement MemoryState::GetLastState.
+ */
+class INFERENCE_ENGINE_API_CLASS(StreamingPool) {
+    class Impl;
+    std::shared_ptr<Impl> _impl;
+    friend class StreamingSession::Impl;
+
+public:
+    /**
+     * @brief Creates infer requests on the executable network
+     *
+     * @param network The executable network of a stateful model
+     * @param numRequests Number of infer requests shared by the sessions, must be positive
+     * @param config Context of the network
+     */
+    StreamingPool(ExecutableNetwork network, size_t numRequests, const StreamingConfig& config = {});
+
+    /**
+     * @brief Opens a new stream on the pool
+     * @return A session with reset memory states
+     */
+    StreamingSession::Ptr OpenSession();
+};
+
+}  // namespace InferenceEngine
@@ -20,4 +20,6 @@
 #include <ie_icnn_network_stats.hpp>
 #include <ie_plugin_config.hpp>
 #include <ie_plugin_dispatcher.hpp>
+#include <ie_streaming_session.hpp>
+#include <ie_calibration.hpp>
 #include <ie_version.hpp>
@@ -0,0 +1,563 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <memory>
+#include <utility>
+#include <map>
+#include <unordered_map>
+
+#include "ie_metric_helpers.hpp"
+#include <ie_api.h>
+#include <cpp_interfaces/base/ie_plugin_base.hpp>
+#include <cpp_interfaces/base/ie_infer_async_request_base.hpp>
+#include <auto-batch/auto_batch_config.hpp>
+#include <ie_plugin_config.hpp>
+#include "auto_batch.hpp"
+
+namespace AutoBatchPlugin {
+    using namespace InferenceEngine;
+
+namespace {
+
+void CopyBlobSlice(const Blob::Ptr& src, size_t srcOffset, const Blob::Ptr& dst, size_t dstOffset, size_t size) {
+    auto srcPtr = src->cbuffer().as<const uint8_t*>();
+    auto dstPtr = dst->buffer().as<uint8_t*>();
+    if (srcPtr == nullptr || dstPtr == nullptr) {
+        THROW_IE_EXCEPTION << "Failed to copy the blobs of the batched request: the blob is not allocated";
+    }
+    std::memcpy(dstPtr + dstOffset, srcPtr + srcOffset, size);
+}
+
+}  // namespace
+
+// ------------------------------AutoBatchInferRequest----------------------------
+AutoBatchInferRequest::AutoBatchInferRequest(const InputsDataMap&   networkInputs,
+                                             const OutputsDataMap&  networkOutputs)
+        : InferRequestInternal(networkInputs, networkOutputs) {
+    // Allocate all input blobs
+    for (const auto &it : networkInputs) {
+        Layout l = it.second->getLayout();
+        Precision p = it.second->getPrecision();
+        SizeVector dims = it.second->getTensorDesc().getDims();
+
+        TensorDesc desc = TensorDesc(p, dims, l);
+        _inputs[it.first] = make_blob_with_precision(desc);
+        _inputs[it.first]->allocate();
+    }
+    // Allocate all output blobs
+    for (const auto &it : networkOutputs) {
+        Layout l = it.second->getLayout();
+        Precision p = it.second->getPrecision();
+        SizeVector dims = it.second->getTensorDesc().getDims();
+
+        TensorDesc desc = TensorDesc(p, dims, l);
+        _outputs[it.first] = make_blob_with_precision(desc);
+        _outputs[it.first]->allocate();
+    }
+}
+
+void AutoBatchInferRequest::CopyInputsToBatchedRequest(InferRequest& req, size_t batchId) {
+    for (const auto &it : _networkInputs) {
+        Blob::Ptr blob;
+        auto &name = it.first;
+        // this request is already in BUSY state, so using the internal functions safely
+        GetBlob(name.c_str(), blob);
+        auto batchedBlob = req.GetBlob(name);
+        // batch is the outermost dimension, so the sample is a contiguous slice of the batched blob
+        CopyBlobSlice(blob, 0, batchedBlob, batchId * blob->byteSize(), blob->byteSize());
+    }
+}
+
+void AutoBatchInferRequest::CopyOutputsFromBatchedRequest(InferRequest& req, size_t batchId) {
+    for (const auto &it : _networkOutputs) {
+        Blob::Ptr blob;
+        auto &name = it.first;
+        // this request is already in BUSY state, so using the internal functions safely
+        GetBlob(name.c_str(), blob);
+        auto batchedBlob = req.GetBlob(name);
+        CopyBlobSlice(batchedBlob, batchId * blob->byteSize(), blob, 0, blob->byteSize());
+    }
+}
+
+AutoBatchAsyncInferRequest::AutoBatchAsyncInferRequest(
+    const AutoBatchInferRequest::Ptr&           inferRequest,
+    const bool                                  needPerfCounters,
+    const AutoBatchExecutableNetwork::Ptr&      autoBatchExecutableNetwork,
+    const ITaskExecutor::Ptr&                   callbackExecutor) :
+    AsyncInferRequestThreadSafeDefault(inferRequest, nullptr, callbackExecutor),
+    _inferRequest{inferRequest},
+    _autoBatchExecutableNetwork{autoBatchExecutableNetwork},
+    _needPerfCounters{needPerfCounters} {
+    struct ThisRequestExecutor : public ITaskExecutor {
+        explicit ThisRequestExecutor(AutoBatchAsyncInferRequest* _this_) : _this{_this_} {}
+        void run(Task task) override {
+            _this->_autoBatchExecutableNetwork->Enqueue(_this, std::move(task));
+        };
+        AutoBatchAsyncInferRequest* _this = nullptr;
+    };
+    _pipeline = {
+        {std::make_shared<ThisRequestExecutor>(this), [this] {
+            if (InferenceEngine::StatusCode::OK != _status) {
+                THROW_IE_EXCEPTION << InferenceEngine::details::as_status << _status;
+            }
+        }}
+    };
+}
+
+void AutoBatchAsyncInferRequest::Infer_ThreadUnsafe() {
+    InferUsingAsync();
+}
+
+void AutoBatchAsyncInferRequest::GetPerformanceCounts_ThreadUnsafe(std::map<std::string, InferenceEngineProfileInfo> &perfMap) const {
+    perfMap = _perfMap;
+}
+
+AutoBatchAsyncInferRequest::~AutoBatchAsyncInferRequest() {
+    StopAndWait();
+}
+
+// ------------------------------AutoBatchExecutableNetwork----------------------------
+
+AutoBatchExecutableNetwork::AutoBatchExecutableNetwork(const InferenceEngine::ExecutableNetwork&                          networkWithBatch,
+                                                       const DeviceInformation&                                           networkDevice,
+                                                       const std::unordered_map<std::string, InferenceEngine::Parameter>& config,
+                                                       const bool                                                         supportsDynBatch,
+                                                       const bool                                                         needPerfCounters) :
+    InferenceEngine::ExecutableNetworkThreadSafeDefault(nullptr, std::make_shared<InferenceEngine::ImmediateExecutor>()),
+    _device{networkDevice},
+    _networkWithBatch{networkWithBatch},
+    _timeout{0},
+    _config{config},
+    _supportsDynBatch{supportsDynBatch},
+    _needPerfCounters{needPerfCounters} {
+    _taskExecutor.reset();
+
+    auto timeout = _config.find(AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT);
+    _timeout = std::chrono::milliseconds{timeout == _config.end() ? 10 : std::stoi(timeout->second.as<std::string>())};
+
+    // several batched requests are kept in flight to overlap collecting of the batch with the inference
+    unsigned int numRequests = 1;
+    try {
+        numRequests = std::max(1u, _networkWithBatch.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
+    } catch (const details::InferenceEngineException &) {
+    }
+    _workerRequests.resize(numRequests);
+    for (auto&& workerRequest : _workerRequests) {
+        workerRequest._inferRequest = _networkWithBatch.CreateInferRequest();
+        auto* workerRequestPtr = &workerRequest;
+        _idleWorkerRequests.push_back(workerRequestPtr);
+        workerRequest._inferRequest.SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
+            [workerRequestPtr, this] (InferRequest , StatusCode status) mutable {
+                std::map<std::string, InferenceEngineProfileInfo> perfMap;
+                if (_needPerfCounters && StatusCode::OK == status) {
+                    perfMap = workerRequestPtr->_inferRequest.GetPerformanceCounts();
+                }
+                auto tasks = std::move(workerRequestPtr->_tasks);
+                workerRequestPtr->_tasks.clear();
+                for (size_t i = 0; i < tasks.size(); i++) {
+                    auto request = tasks[i]._request;
+                    request->_status = status;
+                    if (StatusCode::OK == status) {
+                        try {
+                            request->_inferRequest->CopyOutputsFromBatchedRequest(workerRequestPtr->_inferRequest, i);
+                        } catch (...) {
+                            request->_status = StatusCode::GENERAL_ERROR;
+                        }
+                    }
+                    request->_perfMap = perfMap;
+                }
+                // the batched request is returned before the tasks run, so the next batch can start immediately
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    _idleWorkerRequests.push_back(workerRequestPtr);
+                }
+                if (!_terminate) {
+                    ScheduleToWorkerInferRequest(false);
+                    // incomplete batch which has timed out while all the batched requests were busy
+                    _cv.notify_one();
+                }
+                for (auto&& task : tasks) {
+                    task._task();
+                }
+            });
+    }
+    _timeoutThread = std::thread([this] { TimeoutLoop(); });
+}
+
+void AutoBatchExecutableNetwork::Enqueue(AutoBatchAsyncInferRequest* request, Task task) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _pendingTasks.push_back({request, std::move(task), std::chrono::steady_clock::now()});
+    }
+    ScheduleToWorkerInferRequest(false);
+    _cv.notify_one();
+}
+
+void AutoBatchExecutableNetwork::ScheduleToWorkerInferRequest(bool flush) {
+    const size_t batchSize = static_cast<size_t>(_device.batchForDevice);
+    while (true) {
+        WorkerInferRequest* workerRequestPtr = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_pendingTasks.empty() || _idleWorkerRequests.empty() ||
+                (_pendingTasks.size() < batchSize && !flush)) {
+                return;
+            }
+            workerRequestPtr = _idleWorkerRequests.back();
+            _idleWorkerRequests.pop_back();
+            auto numTasks = std::min(batchSize, _pendingTasks.size());
+            workerRequestPtr->_tasks.assign(std::make_move_iterator(_pendingTasks.begin()),
+                                            std::make_move_iterator(_pendingTasks.begin() + numTasks));
+            _pendingTasks.erase(_pendingTasks.begin(), _pendingTasks.begin() + numTasks);
+        }
+        auto& tasks = workerRequestPtr->_tasks;
+        try {
+            for (size_t i = 0; i < tasks.size(); i++) {
+                tasks[i]._request->_inferRequest->CopyInputsToBatchedRequest(workerRequestPtr->_inferRequest, i);
+            }
+            // incomplete batch is inferred partially when the device supports dynamic batch,
+            // otherwise the rest of the batch is computed in vain
+            if (_supportsDynBatch) {
+                workerRequestPtr->_inferRequest.SetBatch(static_cast<int>(tasks.size()));
+            }
+            workerRequestPtr->_inferRequest.StartAsync();
+        } catch (...) {
+            auto failedTasks = std::move(tasks);
+            tasks.clear();
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _idleWorkerRequests.push_back(workerRequestPtr);
+            }
+            for (auto&& task : failedTasks) {
+                task._request->_status = StatusCode::GENERAL_ERROR;
+                task._task();
+            }
+        }
+        flush = false;
+    }
+}
+
+void AutoBatchExecutableNetwork::TimeoutLoop() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (!_terminate) {
+        if (_pendingTasks.empty() || _idleWorkerRequests.empty()) {
+            _cv.wait(lock);
+            continue;
+        }
+        auto deadline = _pendingTasks.front()._startTime + _timeout;
+        if (deadline <= std::chrono::steady_clock::now()) {
+            lock.unlock();
+            ScheduleToWorkerInferRequest(true);
+            lock.lock();
+        } else {
+            _cv.wait_until(lock, deadline);
+        }
+    }
+}
+
+AutoBatchExecutableNetwork::~AutoBatchExecutableNetwork() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _terminate = true;
+    }
+    _cv.notify_all();
+    if (_timeoutThread.joinable()) {
+        _timeoutThread.join();
+    }
+    /* NOTE: The only threads that use `AutoBatchExecutableNetwork` Context are those that are used by Worker infer requests.
+     *       But AsyncInferRequest destructor should waits for all asynchronous tasks that are used by the request
+     */
+    _workerRequests.clear();
+}
+
+InferenceEngine::InferRequestInternal::Ptr AutoBatchExecutableNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
+                                                                                              InferenceEngine::OutputsDataMap networkOutputs) {
+    return std::make_shared<AutoBatchInferRequest>(networkInputs, networkOutputs);
+}
+
+void AutoBatchExecutableNetwork::CreateInferRequest(IInferRequest::Ptr& asyncRequest) {
+    auto syncRequestImpl = CreateInferRequestImpl(_networkInputs, _networkOutputs);
+    syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
+    auto asyncTreadSafeImpl = std::make_shared<AutoBatchAsyncInferRequest>(std::static_pointer_cast<AutoBatchInferRequest>(syncRequestImpl),
+                                                                           _needPerfCounters,
+                                                                           std::static_pointer_cast<AutoBatchExecutableNetwork>(shared_from_this()),
+                                                                           _callbackExecutor);
+    asyncRequest.reset(new InferRequestBase<AutoBatchAsyncInferRequest>(asyncTreadSafeImpl), [](IInferRequest *p) { p->Release(); });
+    asyncTreadSafeImpl->SetPointerToPublicInterface(asyncRequest);
+}
+
+void AutoBatchExecutableNetwork::GetConfig(const std::string &name, InferenceEngine::Parameter &result,
+        InferenceEngine::ResponseDesc * /* resp */) const {
+    auto res = _config.find(name);
+    if (res != _config.end()) {
+        result =  res->second;
+    } else {
+        THROW_IE_EXCEPTION << NOT_FOUND_str << name <<" not found in the ExecutableNetwork config";
+    }
+}
+
+void AutoBatchExecutableNetwork::GetMetric(const std::string &name, Parameter &result, ResponseDesc *resp) const {
+    if (name == METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)) {
+        // enough requests to fill all the batched requests
+        unsigned int res = static_cast<unsigned int>(_device.batchForDevice * _workerRequests.size());
+        result = IE_SET_METRIC(OPTIMAL_NUMBER_OF_INFER_REQUESTS, res);
+    } else if (name == METRIC_KEY(NETWORK_NAME)) {
+        result = IE_SET_METRIC(NETWORK_NAME, _networkWithBatch.GetMetric(
+            METRIC_KEY(NETWORK_NAME)).as<std::string>());
+    } else if (name == METRIC_KEY(SUPPORTED_METRICS)) {
+        result = IE_SET_METRIC(SUPPORTED_METRICS, {
+            METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
+            METRIC_KEY(SUPPORTED_METRICS),
+            METRIC_KEY(NETWORK_NAME),
+            METRIC_KEY(SUPPORTED_CONFIG_KEYS)
+        });
+    } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
+        std::vector<std::string> configKeys = { AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE,
+                                                AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT };
+        result = IE_SET_METRIC(SUPPORTED_CONFIG_KEYS, configKeys);
+    } else {
+        THROW_IE_EXCEPTION << "Unsupported Network metric: " << name;
+    }
+}
+
+// ------------------------------AutoBatchInferencePlugin----------------------------
+
+namespace {
+
+std::map<std::string, std::string> mergeConfigs(std::map<std::string, std::string> config,
+                                                const std::map<std::string, std::string> & local) {
+    for (auto && kvp : local) {
+        config[kvp.first] = kvp.second;
+    }
+    return config;
+}
+
+}  // namespace
+
+std::map<std::string, std::string> AutoBatchInferencePlugin::GetSupportedConfig(
+    const std::map<std::string, std::string> & config, const std::string & deviceName) const {
+    std::vector<std::string> supportedConfigKeys = GetCore()->GetMetric(deviceName, METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+    std::map<std::string, std::string> supportedConfig;
+    for (auto&& key : supportedConfigKeys) {
+        auto itKey = config.find(key);
+        if (config.end() != itKey) {
+            supportedConfig[key] = itKey->second;
+        }
+    }
+    return supportedConfig;
+}
+
+DeviceInformation AutoBatchInferencePlugin::ParseMetaDevice(const std::string& deviceBatch,
+                                                            const std::map<std::string, std::string> & config) const {
+    auto openingBracket = deviceBatch.find_first_of('(');
+    auto closingBracket = deviceBatch.find_first_of(')', openingBracket);
+    auto deviceName = deviceBatch.substr(0, openingBracket);
+
+    int batch = -1;
+    if (closingBracket != std::string::npos && openingBracket < closingBracket) {
+        batch = std::stol(deviceBatch.substr(openingBracket + 1, closingBracket - openingBracket - 1));
+    }
+    if (batch <= 0) {
+        THROW_IE_EXCEPTION << "Batch value for '" << deviceName << "' must be set in brackets and be > 0, while '"
+            << deviceBatch << "' is passed";
+    }
+
+    DeviceIDParser deviceParser(deviceName);
+    std::map<std::string, std::string> tconfig = mergeConfigs(_config, config);
+    // set device ID if any
+    std::string deviceIDLocal = deviceParser.getDeviceID();
+    if (!deviceIDLocal.empty()) {
+        tconfig[PluginConfigParams::KEY_DEVICE_ID] = deviceIDLocal;
+    }
+
+    return { deviceName, GetSupportedConfig(tconfig, deviceParser.getDeviceName()), batch };
+}
+
+Parameter AutoBatchInferencePlugin::GetConfig(const std::string& name,
+        const std::map<std::string, Parameter> & options) const {
+    if (name == AUTO_BATCH_CONFIG_KEY(DEVICE) || name == AUTO_BATCH_CONFIG_KEY(TIMEOUT)) {
+        auto it = _config.find(name);
+        if (it == _config.end()) {
+            THROW_IE_EXCEPTION << "Value for " << name << " is not set";
+        } else {
+            return { it->second };
+        }
+    } else {
+        THROW_IE_EXCEPTION << "Unsupported config key: " << name;
+    }
+}
+
+void AutoBatchInferencePlugin::SetConfig(const std::map<std::string, std::string> & config) {
+    for (auto && kvp : config) {
+        _config[kvp.first] = kvp.second;
+    }
+}
+
+IE_SUPPRESS_DEPRECATED_START
+
+INFERENCE_PLUGIN_API(InferenceEngine::StatusCode) CreatePluginEngine(
+        InferenceEngine::IInferencePlugin *&plugin,
+        InferenceEngine::ResponseDesc *resp) noexcept {
+    try {
+        plugin = make_ie_compatible_plugin(
+                {{2, 1},
+                 CI_BUILD_NUMBER,
+                 "AutoBatchPlugin"}, std::make_shared<AutoBatchInferencePlugin>());
+        return OK;
+    }
+    catch (std::exception &ex) {
+        return DescriptionBuffer(GENERAL_ERROR, resp) << ex.what();
+    }
+}
+
+IE_SUPPRESS_DEPRECATED_END
+
+AutoBatchInferencePlugin::AutoBatchInferencePlugin() {
+    _pluginName = "BATCH";
+}
+
+InferenceEngine::Parameter AutoBatchInferencePlugin::GetMetric(const std::string& name,
+                                         const std::map<std::string, InferenceEngine::Parameter> & options) const {
+    if (name == METRIC_KEY(SUPPORTED_METRICS)) {
+        std::vector<std::string> metrics;
+        metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
+        metrics.push_back(METRIC_KEY(FULL_DEVICE_NAME));
+        metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+        IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
+    } else if (name == METRIC_KEY(FULL_DEVICE_NAME)) {
+        std::string name = { "BATCH" };
+        IE_SET_METRIC_RETURN(FULL_DEVICE_NAME, name);
+    } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
+        std::vector<std::string> configKeys = { AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE,
+                                                AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT };
+        IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
+    } else {
+        THROW_IE_EXCEPTION << "Unsupported metric key " << name;
+    }
+}
+
+ExecutableNetworkInternal::Ptr AutoBatchInferencePlugin::LoadExeNetworkImpl(const ICNNNetwork &network,
+                                                                            const std::map<std::string, std::string>& config) {
+    if (GetCore() == nullptr) {
+        THROW_IE_EXCEPTION << "Please, work with BATCH device via InferencEngine::Core object";
+    }
+
+    auto fullConfig = mergeConfigs(_config, config);
+    auto device = fullConfig.find(AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE);
+    if (device == fullConfig.end()) {
+        THROW_IE_EXCEPTION << "KEY_AUTO_BATCH_DEVICE key is not set for BATCH device";
+    }
+    auto timeout = fullConfig.find(AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT);
+    if (timeout != fullConfig.end()) {
+        int value = -1;
+        try {
+            value = std::stoi(timeout->second);
+        } catch (const std::exception &) {
+        }
+        if (value < 0) {
+            THROW_IE_EXCEPTION << "Wrong value " << timeout->second << " for property key "
+                               << AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT << ". Expected non negative integer";
+        }
+    }
+
+    auto metaDevice = ParseMetaDevice(device->second, fullConfig);
+    const auto& deviceName = metaDevice.deviceName;
+
+    // the requests are merged along the outermost dimension, so every input and output should have batch 1 there
+    InputsDataMap inputs;
+    OutputsDataMap outputs;
+    network.getInputsInfo(inputs);
+    network.getOutputsInfo(outputs);
+    ICNNNetwork::InputShapes shapes;
+    for (auto&& input : inputs) {
+        auto dims = input.second->getTensorDesc().getDims();
+        auto layout = input.second->getTensorDesc().getLayout();
+        if (dims.empty() || dims[0] != 1 || layout == Layout::CN || layout == Layout::BLOCKED) {
+            THROW_IE_EXCEPTION << "BATCH device supports only networks with batch 1 as the outermost dimension of the inputs, "
+                               << "while the input " << input.first << " doesn't match it";
+        }
+        dims[0] = metaDevice.batchForDevice;
+        shapes[input.first] = dims;
+    }
+    for (auto&& output : outputs) {
+        auto dims = output.second->getTensorDesc().getDims();
+        auto layout = output.second->getTensorDesc().getLayout();
+        if (dims.empty() || dims[0] != 1 || layout == Layout::CN || layout == Layout::BLOCKED) {
+            THROW_IE_EXCEPTION << "BATCH device supports only networks with batch 1 as the outermost dimension of the outputs, "
+                               << "while the output " << output.first << " doesn't match it";
+        }
+    }
+
+    CNNNetwork clonedNetwork{cloneNetwork(network)};
+    clonedNetwork.reshape(shapes);
+    for (auto&& output : clonedNetwork.getOutputsInfo()) {
+        auto dims = output.second->getTensorDesc().getDims();
+        if (dims[0] != static_cast<size_t>(metaDevice.batchForDevice)) {
+            THROW_IE_EXCEPTION << "BATCH device failed to set batch " << metaDevice.batchForDevice << " to the network: "
+                               << "batch of the output " << output.first << " is " << dims[0];
+        }
+    }
+
+    // dynamic batch lets the device infer incomplete batches without computing the unused part
+    auto deviceConfig = metaDevice.config;
+    std::vector<std::string> supportedConfigKeys =
+        GetCore()->GetMetric(DeviceIDParser(deviceName).getDeviceName(), METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+    bool supportsDynBatch = std::find(supportedConfigKeys.begin(), supportedConfigKeys.end(),
+                                      PluginConfigParams::KEY_DYN_BATCH_ENABLED) != supportedConfigKeys.end();
+    ExecutableNetwork networkWithBatch;
+    if (supportsDynBatch) {
+        try {
+            auto dynBatchConfig = deviceConfig;
+            dynBatchConfig[PluginConfigParams::KEY_DYN_BATCH_ENABLED] = PluginConfigParams::YES;
+            networkWithBatch = GetCore()->LoadNetwork(clonedNetwork, deviceName, dynBatchConfig);
+        } catch (const details::InferenceEngineException &) {
+            // the topology may be not supported in the dynamic batch mode
+            supportsDynBatch = false;
+        }
+    }
+    if (!supportsDynBatch) {
+        networkWithBatch = GetCore()->LoadNetwork(clonedNetwork, deviceName, deviceConfig);
+    }
+
+    std::unordered_map<std::string, InferenceEngine::Parameter> batchNetworkConfig;
+    batchNetworkConfig.insert(*device);
+    batchNetworkConfig[AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT] =
+        timeout == fullConfig.end() ? std::string("10") : timeout->second;
+    batchNetworkConfig.insert(deviceConfig.begin(), deviceConfig.end());
+
+    auto perfConfig = fullConfig.find(PluginConfigParams::KEY_PERF_COUNT);
+    bool enablePerfCounters = (fullConfig.end() != perfConfig) && (perfConfig->second == PluginConfigParams::YES);
+
+    return std::make_shared<AutoBatchExecutableNetwork>(networkWithBatch,
+                                                        metaDevice,
+                                                        batchNetworkConfig,
+                                                        supportsDynBatch,
+                                                        enablePerfCounters);
+}
+
+void AutoBatchInferencePlugin::QueryNetwork(const ICNNNetwork&                        network,
+                                            const std::map<std::string, std::string>& config,
+                                            QueryNetworkResult&                       queryResult) const {
+    if (GetCore() == nullptr) {
+        THROW_IE_EXCEPTION << "Please, work with BATCH device via InferencEngine::Core object";
+    }
+
+    auto fullConfig = mergeConfigs(_config, config);
+    auto device = fullConfig.find(AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE);
+    if (device == fullConfig.end()) {
+        THROW_IE_EXCEPTION << "KEY_AUTO_BATCH_DEVICE key is not set for BATCH device";
+    }
+
+    auto metaDevice = ParseMetaDevice(device->second, fullConfig);
+    queryResult = GetCore()->QueryNetwork(network, metaDevice.deviceName, metaDevice.config);
+    for (auto&& layer : queryResult.supportedLayersMap) {
+        layer.second = GetName();
+    }
+}
+}  // namespace AutoBatchPlugin
@@ -0,0 +1,153 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <map>
+#include <vector>
+#include <utility>
+#include <memory>
+#include <string>
+
+#include <cpp/ie_plugin_cpp.hpp>
+#include <cpp_interfaces/impl/ie_plugin_internal.hpp>
+#include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
+#include <cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp>
+#include "ie_iinfer_request.hpp"
+#include "details/ie_exception_conversion.hpp"
+
+namespace AutoBatchPlugin {
+
+using DeviceName = std::string;
+
+struct DeviceInformation {
+    DeviceName deviceName;
+    std::map<std::string, std::string> config;
+    int batchForDevice;
+};
+
+class AutoBatchInferRequest : public InferenceEngine::InferRequestInternal {
+public:
+    using Ptr = std::shared_ptr<AutoBatchInferRequest>;
+    explicit AutoBatchInferRequest(const InferenceEngine::InputsDataMap&  networkInputs,
+                                   const InferenceEngine::OutputsDataMap& networkOutputs);
+    void GetPerformanceCounts(std::map<std::string, InferenceEngineProfileInfo>&) const override {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str;
+    }
+    void InferImpl() override {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str;
+    }
+    // Auto-Batch impl specific: copies the inputs to the `batchId` slice of the batched request blobs
+    void CopyInputsToBatchedRequest(InferenceEngine::InferRequest& req, size_t batchId);
+    // Auto-Batch impl specific: copies the `batchId` slice of the batched request outputs to the request blobs
+    void CopyOutputsFromBatchedRequest(InferenceEngine::InferRequest& req, size_t batchId);
+};
+
+class AutoBatchAsyncInferRequest;
+
+class AutoBatchExecutableNetwork : public InferenceEngine::ExecutableNetworkThreadSafeDefault {
+public:
+    using Ptr = std::shared_ptr<AutoBatchExecutableNetwork>;
+    struct PendingTask {
+        AutoBatchAsyncInferRequest*             _request;
+        Task                                    _task;
+        std::chrono::steady_clock::time_point   _startTime;
+    };
+    struct WorkerInferRequest {
+        InferenceEngine::InferRequest           _inferRequest;
+        std::vector<PendingTask>                _tasks;
+        InferenceEngine::StatusCode             _status = InferenceEngine::StatusCode::OK;
+    };
+
+    explicit AutoBatchExecutableNetwork(const InferenceEngine::ExecutableNetwork&                           networkWithBatch,
+                                        const DeviceInformation&                                            networkDevice,
+                                        const std::unordered_map<std::string, InferenceEngine::Parameter>&  config,
+                                        const bool                                                          supportsDynBatch,
+                                        const bool                                                          needPerfCounters = false);
+
+    void GetConfig(const std::string &name, InferenceEngine::Parameter &result, InferenceEngine::ResponseDesc *resp) const override;
+    void GetMetric(const std::string &name, InferenceEngine::Parameter &result, InferenceEngine::ResponseDesc *resp) const override;
+    void CreateInferRequest(InferenceEngine::IInferRequest::Ptr& asyncRequest) override;
+    InferenceEngine::InferRequestInternal::Ptr CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
+                                                                      InferenceEngine::OutputsDataMap networkOutputs) override;
+    ~AutoBatchExecutableNetwork() override;
+
+    // Adds the request to the batch being collected, the task is called when the batch is inferred
+    void Enqueue(AutoBatchAsyncInferRequest* request, Task task);
+
+protected:
+    // Starts the collected requests on idle batched requests. Incomplete batches are started only if `flush` is set.
+    void ScheduleToWorkerInferRequest(bool flush);
+    void TimeoutLoop();
+
+    std::atomic_bool                                            _terminate = {false};
+    std::mutex                                                  _mutex;
+    std::condition_variable                                     _cv;
+    DeviceInformation                                           _device;
+    InferenceEngine::ExecutableNetwork                          _networkWithBatch;
+    std::vector<WorkerInferRequest>                             _workerRequests;
+    std::vector<WorkerInferRequest*>                            _idleWorkerRequests;
+    std::deque<PendingTask>                                     _pendingTasks;
+    std::chrono::milliseconds                                   _timeout;
+    std::thread                                                 _timeoutThread;
+    std::unordered_map<std::string, InferenceEngine::Parameter> _config;
+    bool                                                        _supportsDynBatch = false;
+    bool                                                        _needPerfCounters = false;
+};
+
+class AutoBatchAsyncInferRequest : public InferenceEngine::AsyncInferRequestThreadSafeDefault {
+public:
+    using Ptr = std::shared_ptr<AutoBatchAsyncInferRequest>;
+
+    explicit AutoBatchAsyncInferRequest(const AutoBatchInferRequest::Ptr&           inferRequest,
+                                        const bool                                  needPerfCounters,
+                                        const AutoBatchExecutableNetwork::Ptr&      autoBatchExecutableNetwork,
+                                        const InferenceEngine::ITaskExecutor::Ptr&  callbackExecutor);
+    void Infer_ThreadUnsafe() override;
+    void GetPerformanceCounts_ThreadUnsafe(std::map<std::string, InferenceEngineProfileInfo> &_perfMap) const override;
+    ~AutoBatchAsyncInferRequest() override;
+
+    AutoBatchInferRequest::Ptr                                          _inferRequest;
+    InferenceEngine::StatusCode                                         _status = InferenceEngine::StatusCode::OK;
+    std::map<std::string, InferenceEngine::InferenceEngineProfileInfo>  _perfMap;
+
+protected:
+    AutoBatchExecutableNetwork::Ptr                                     _autoBatchExecutableNetwork;
+    bool                                                                _needPerfCounters = false;
+};
+
+class AutoBatchInferencePlugin : public InferenceEngine::InferencePluginInternal {
+public:
+    AutoBatchInferencePlugin();
+    ~AutoBatchInferencePlugin() override = default;
+
+    InferenceEngine::ExecutableNetworkInternal::Ptr LoadExeNetworkImpl(const InferenceEngine::ICNNNetwork& network,
+                                                                       const std::map<std::string, std::string>& config) override;
+
+    void SetConfig(const std::map<std::string, std::string>& config) override;
+    Parameter GetConfig(const std::string& name,
+                        const std::map<std::string, Parameter> & options) const override;
+    void QueryNetwork(const InferenceEngine::ICNNNetwork&       network,
+                      const std::map<std::string, std::string>& config,
+                      InferenceEngine::QueryNetworkResult&      res) const override;
+    InferenceEngine::Parameter GetMetric(const std::string& name,
+                                         const std::map<std::string, InferenceEngine::Parameter>& options) const override;
+
+    DeviceInformation ParseMetaDevice(const std::string & deviceBatch,
+                                      const std::map<std::string, std::string> & config) const;
+
+protected:
+    std::map<std::string, std::string> GetSupportedConfig(const std::map<std::string, std::string>& config,
+                                                          const DeviceName & deviceName) const;
+};
+
+}  // namespace AutoBatchPlugin
@@ -227,6 +227,11 @@ public:
 
     void Propagate();
 
+    /**
+     * @brief propagates given copy of components, used to run several requests with own RW pointers concurrently
+     */
+    void Propagate(std::vector<intel_dnn_component_t> &components) const;
+
     float OutputScaleFactor(uint32_t component_index) {
         return OutputScaleFactor(component[component_index]);
     }
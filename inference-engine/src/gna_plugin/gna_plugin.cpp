@@ -35,6 +35,7 @@
 #include "memory/gna_allocator.hpp"
 #include "memory/gna_memory_state.hpp"
 #include "gna_model_serial.hpp"
+#include <threading/ie_cpu_streams_executor.hpp>
 
 #if GNA_LIB_VER == 2
 #include <gna2-model-api.h>
@@ -630,15 +631,26 @@ void GNAPlugin::LoadNetwork(ICNNNetwork &network) {
 #endif
     }
 
+    if (gnaFlags->sw_fp32 && gnaFlags->gna_lib_async_threads_num > 1) {
+        swRequestsComponents.assign(1, dnn->component);
+        swRequestsResults.resize(gnaFlags->gna_lib_async_threads_num);
+        swExecutor = std::make_shared<CPUStreamsExecutor>(
+            IStreamsExecutor::Config{"GNASWExecutor", gnaFlags->gna_lib_async_threads_num, 1});
+    }
+
     // creating same gna RW segment for parallel infer requests
     for (int i = 1; i != gnaFlags->gna_lib_async_threads_num; i++) {
 #if GNA_LIB_VER == 2
         gnaModels.push_back(std::make_tuple(make_shared<CPPWrapper<Gna2Model>>()));
-        // this can be improved by just copy all structures, but we are too lazy
-        dnn->InitGNAStruct(&std::get<0>(gnaModels.back())->obj);
+        if (!gnaFlags->sw_fp32) {
+            // this can be improved by just copy all structures, but we are too lazy
+            dnn->InitGNAStruct(&std::get<0>(gnaModels.back())->obj);
+        }
 #else
         nnets.emplace_back(make_shared<CPPWrapper<intel_nnet_type_t>>(), -1, InferenceEngine::BlobMap());
-        dnn->InitGNAStruct(&std::get<0>(nnets.back())->obj);
+        if (!gnaFlags->sw_fp32) {
+            dnn->InitGNAStruct(&std::get<0>(nnets.back())->obj);
+        }
 #endif
         // relocate rw pointers to new offset
         auto basePtr = reinterpret_cast<uint8_t*>(pParallelExecutionData) + rwSegmentSize * (i - 1);
@@ -674,6 +686,25 @@ void GNAPlugin::LoadNetwork(ICNNNetwork &network) {
             relocate(layer.pOutputsIntermediate, layer.pOutputsIntermediate);
 #endif
         }
+
+        if (gnaFlags->sw_fp32) {
+            // only pointers to RW segment are unique per request, weights and biases are shared
+            auto relocateRW = [&relocate, this](void *& ptr) {
+                auto rwBase = reinterpret_cast<uint8_t *>(gnamem->getBasePtr());
+                auto p = reinterpret_cast<uint8_t *>(ptr);
+                if (p >= rwBase && p < rwBase + rwSegmentSize) {
+                    relocate(ptr, ptr);
+                }
+            };
+            swRequestsComponents.push_back(dnn->component);
+            for (auto &comp : swRequestsComponents.back()) {
+                relocateRW(comp.ptr_inputs);
+                relocateRW(comp.ptr_outputs);
+                if (comp.operation == kDnnRecurrentOp) {
+                    relocateRW(comp.op.recurrent.ptr_feedbacks);
+                }
+            }
+        }
     }
 
     // calculating input orientation without memory layers, since their orientation not changed during infer right now
@@ -747,7 +778,9 @@ void GNAPlugin::LoadNetwork(ICNNNetwork &network) {
 #if GNA_LIB_VER == 2
 void GNAPlugin::createRequestConfigsForGnaModels() {
     if (!gnadevice) {
-        gnaRequestConfigToRequestIdMap.push_back(std::make_tuple(FAKE_REQUEST_CONFIG_ID, -1, InferenceEngine::BlobMap()));
+        for (size_t i = 0; i != gnaModels.size(); i++) {
+            gnaRequestConfigToRequestIdMap.push_back(std::make_tuple(FAKE_REQUEST_CONFIG_ID, -1, InferenceEngine::BlobMap()));
+        }
         return;
     }
     for (auto& model : gnaModels) {
@@ -927,7 +960,16 @@ uint32_t GNAPlugin::QueueInference(const InferenceEngine::BlobMap &inputs, Infer
     }
 
     if (!gnadevice) {
-        dnn->Propagate();
+        if (swExecutor) {
+            // propagation of each request runs on its own stream, so that requests are scored in parallel
+            auto task = std::make_shared<std::packaged_task<void()>>([this, idx] {
+                dnn->Propagate(swRequestsComponents[idx]);
+            });
+            swRequestsResults[idx] = task->get_future();
+            swExecutor->run([task] { (*task)(); });
+        } else {
+            dnn->Propagate();
+        }
         if (freeNnet != nnets.end()) {
             std::get<1>(*freeNnet) = 1;
         }
@@ -967,6 +1009,8 @@ void GNAPlugin::Wait(uint32_t request_idx) {
 
     if (gnadevice) {
         gnadevice->wait(std::get<1>(nnets[request_idx]));
+    } else if (request_idx < swRequestsResults.size() && swRequestsResults[request_idx].valid()) {
+        swRequestsResults[request_idx].get();
     }
 
     std::get<1>(nnets[request_idx]) = -1;
@@ -12,8 +12,10 @@
 #include <memory>
 #include <vector>
 #include <tuple>
+#include <future>
 #include <cpp_interfaces/interface/ie_iplugin_internal.hpp>
 #include <cpp_interfaces/interface/ie_imemory_state_internal.hpp>
+#include <threading/ie_itask_executor.hpp>
 #include "descriptions/gna_flags.hpp"
 #include "descriptions/gna_input_desc.hpp"
 #include "descriptions/gna_output_desc.hpp"
@@ -81,6 +83,17 @@ class GNAPlugin : public InferenceEngine::IInferencePluginInternal, public std::
      */
     uint32_t rwSegmentSize = 0;
 
+    /**
+     * @brief copies of dnn components with RW pointers relocated to the segment of each parallel infer request,
+     * used only in GNA_SW_FP32 mode where no GNA library model is created
+     */
+    std::vector<std::vector<intel_dnn_component_t>> swRequestsComponents;
+    /**
+     * @brief executor for GNA_SW_FP32 propagation of parallel infer requests and their pending results
+     */
+    InferenceEngine::ITaskExecutor::Ptr swExecutor;
+    std::vector<std::future<void>> swRequestsResults;
+
     InferenceEngine::InputsDataMap inputsDataMap;
     InferenceEngine::OutputsDataMap outputsDataMap;
 
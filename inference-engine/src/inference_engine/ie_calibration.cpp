@@ -0,0 +1,369 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_calibration.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <ngraph/graph_util.hpp>
+#include <ngraph/opsets/opset1.hpp>
+
+#include "details/ie_exception.hpp"
+
+namespace InferenceEngine {
+
+namespace {
+
+// Statistics of an activation tensor: the range of values and a histogram of absolute values. The histogram covers
+// [0, range), the range is doubled by merging pairs of bins when bigger values come.
+class TensorStatistics {
+public:
+    explicit TensorStatistics(size_t bins): _histogram(bins, 0) {}
+
+    void Add(const float* data, size_t size) {
+        float absMax = 0.f;
+        for (size_t i = 0; i < size; i++) {
+            _min = std::min(_min, data[i]);
+            _max = std::max(_max, data[i]);
+            absMax = std::max(absMax, std::fabs(data[i]));
+        }
+
+        if (_range == 0.f)
+            _range = absMax > 0.f ? absMax : 1.f;
+        while (absMax >= _range)
+            Widen();
+
+        const size_t bins = _histogram.size();
+        for (size_t i = 0; i < size; i++) {
+            const auto bin = static_cast<size_t>(std::fabs(data[i]) / _range * bins);
+            _histogram[std::min(bin, bins - 1)]++;
+        }
+        _count += size;
+    }
+
+    float Min() const {
+        return _min;
+    }
+
+    float Max() const {
+        return _max;
+    }
+
+    bool IsEmpty() const {
+        return _count == 0;
+    }
+
+    // The absolute value covering the given percentile of values
+    float Percentile(float percentile) const {
+        const double target = static_cast<double>(_count) * percentile / 100.;
+        uint64_t accumulated = 0;
+        for (size_t i = 0; i < _histogram.size(); i++) {
+            accumulated += _histogram[i];
+            if (accumulated >= target)
+                return BinWidth() * (i + 1);
+        }
+        return _range;
+    }
+
+    // The absolute value minimizing KL divergence between the histogram and its quantization to the given number of
+    // levels, values above the threshold are saturated into the last bin
+    float KLThreshold(size_t levels) const {
+        const size_t bins = _histogram.size();
+        if (bins <= levels)
+            return _range;
+
+        size_t bestThreshold = bins;
+        double bestDivergence = std::numeric_limits<double>::max();
+        std::vector<double> reference(bins), expanded(bins);
+        for (size_t threshold = levels; threshold <= bins; threshold++) {
+            double outliers = 0.;
+            for (size_t i = threshold; i < bins; i++)
+                outliers += _histogram[i];
+            for (size_t i = 0; i < threshold; i++)
+                reference[i] = static_cast<double>(_histogram[i]);
+            reference[threshold - 1] += outliers;
+
+            // merges the bins into the quantization levels and spreads them back over the non-empty bins
+            const double binsPerLevel = static_cast<double>(threshold) / levels;
+            for (size_t level = 0; level < levels; level++) {
+                const auto begin = static_cast<size_t>(level * binsPerLevel);
+                const auto end = level == levels - 1 ? threshold : static_cast<size_t>((level + 1) * binsPerLevel);
+                double sum = 0.;
+                size_t nonEmpty = 0;
+                for (size_t i = begin; i < end; i++) {
+                    sum += _histogram[i];
+                    nonEmpty += _histogram[i] != 0 ? 1 : 0;
+                }
+                for (size_t i = begin; i < end; i++)
+                    expanded[i] = _histogram[i] != 0 ? sum / nonEmpty : 0.;
+            }
+
+            const double divergence = Divergence(reference, expanded, threshold);
+            if (divergence < bestDivergence) {
+                bestDivergence = divergence;
+                bestThreshold = threshold;
+            }
+        }
+        return BinWidth() * bestThreshold;
+    }
+
+private:
+    void Widen() {
+        const size_t bins = _histogram.size();
+        for (size_t i = 0; i < bins / 2; i++)
+            _histogram[i] = _histogram[2 * i] + _histogram[2 * i + 1];
+        if (bins % 2 != 0)
+            _histogram[bins / 2] = _histogram[bins - 1];
+        std::fill(_histogram.begin() + (bins + 1) / 2, _histogram.end(), 0);
+        _range *= 2.f;
+    }
+
+    float BinWidth() const {
+        return _range / _histogram.size();
+    }
+
+    static double Divergence(const std::vector<double>& p, const std::vector<double>& q, size_t size) {
+        double pSum = 0., qSum = 0.;
+        for (size_t i = 0; i < size; i++) {
+            pSum += p[i];
+            qSum += q[i];
+        }
+        if (pSum == 0. || qSum == 0.)
+            return std::numeric_limits<double>::max();
+
+        double divergence = 0.;
+        for (size_t i = 0; i < size; i++) {
+            if (p[i] == 0.)
+                continue;
+            // the bins lost by the quantization are penalized as nearly empty ones
+            const double pi = p[i] / pSum;
+            const double qi = q[i] != 0. ? q[i] / qSum : 1e-12;
+            divergence += pi * std::log(pi / qi);
+        }
+        return divergence;
+    }
+
+    std::vector<uint64_t> _histogram;
+    float _range = 0.f;
+    float _min = std::numeric_limits<float>::max();
+    float _max = std::numeric_limits<float>::lowest();
+    uint64_t _count = 0;
+};
+
+// The name of the network data produced by the output, the same as CNNNetwork gives to it
+std::string DataName(const ngraph::Output<ngraph::Node>& output) {
+    const auto node = output.get_node_shared_ptr();
+    std::string name = node->get_friendly_name();
+    if (node->get_output_size() != 1)
+        name += "." + std::to_string(output.get_index());
+    return name;
+}
+
+bool IsCandidate(const std::shared_ptr<ngraph::Node>& node) {
+    return ngraph::is_type<ngraph::opset1::Convolution>(node) ||
+           ngraph::is_type<ngraph::opset1::GroupConvolution>(node) ||
+           ngraph::is_type<ngraph::opset1::MatMul>(node);
+}
+
+bool IsConstant(const ngraph::Output<ngraph::Node>& output) {
+    return ngraph::is_type<ngraph::opset1::Constant>(output.get_node_shared_ptr());
+}
+
+std::shared_ptr<ngraph::Node> MakeFakeQuantize(const ngraph::Output<ngraph::Node>& input,
+                                               const ngraph::Shape& rangeShape,
+                                               const std::vector<float>& low,
+                                               const std::vector<float>& high,
+                                               size_t levels) {
+    const auto type = input.get_element_type();
+    const auto lowNode = ngraph::opset1::Constant::create(type, rangeShape, low);
+    const auto highNode = ngraph::opset1::Constant::create(type, rangeShape, high);
+    return std::make_shared<ngraph::opset1::FakeQuantize>(input, lowNode, highNode, lowNode, highNode, levels);
+}
+
+}  // namespace
+
+class Calibrator::Impl {
+public:
+    Impl(Core& core, const CNNNetwork& network, const CalibrationConfig& config): _config(config) {
+        _function = network.getFunction();
+        if (_function == nullptr)
+            THROW_IE_EXCEPTION << "Calibration is supported only for networks created from ngraph Function";
+        if (_config.histogramBins < 256)
+            THROW_IE_EXCEPTION << "Calibration needs at least 256 histogram bins, got " << _config.histogramBins;
+        if (_config.percentile <= 0.f || _config.percentile > 100.f)
+            THROW_IE_EXCEPTION << "Calibration percentile must be in (0, 100], got " << _config.percentile;
+
+        // Activations of the candidates are added as extra outputs of a copy of the function
+        const auto instrumented = ngraph::clone_function(*_function);
+        ngraph::ResultVector results = instrumented->get_results();
+        std::set<std::string> parameters;
+        for (const auto& parameter : instrumented->get_parameters())
+            parameters.insert(DataName(parameter->output(0)));
+
+        for (const auto& node : instrumented->get_ordered_ops()) {
+            if (!IsCandidate(node))
+                continue;
+            for (const auto& input : node->inputs()) {
+                const auto source = input.get_source_output();
+                if (IsConstant(source) || source.get_element_type() != ngraph::element::f32)
+                    continue;
+
+                const auto name = DataName(source);
+                if (_statistics.find(name) != _statistics.end())
+                    continue;
+                _statistics.emplace(name, TensorStatistics(_config.histogramBins));
+                // inputs of the network are taken from the samples directly
+                if (parameters.find(name) == parameters.end())
+                    results.push_back(std::make_shared<ngraph::opset1::Result>(source));
+            }
+        }
+        if (_statistics.empty())
+            THROW_IE_EXCEPTION << "Network " << network.getName() << " has no operations to quantize";
+
+        CNNNetwork instrumentedNetwork(std::make_shared<ngraph::Function>(results, instrumented->get_parameters(),
+                                                                          instrumented->get_friendly_name()));
+        for (auto& output : instrumentedNetwork.getOutputsInfo())
+            output.second->setPrecision(Precision::FP32);
+        _request = core.LoadNetwork(instrumentedNetwork, _config.device, _config.deviceConfig).CreateInferRequest();
+    }
+
+    void Collect(const BlobMap& inputs) {
+        for (const auto& input : inputs)
+            _request.SetBlob(input.first, input.second);
+        _request.Infer();
+
+        for (auto& tensor : _statistics) {
+            auto input = inputs.find(tensor.first);
+            const Blob::Ptr blob = input != inputs.end() ? input->second : _request.GetBlob(tensor.first);
+            if (blob->getTensorDesc().getPrecision() != Precision::FP32)
+                THROW_IE_EXCEPTION << "Calibrated tensor " << tensor.first << " must have FP32 precision";
+            tensor.second.Add(blob->cbuffer().as<const float*>(), blob->size());
+        }
+        _samples++;
+    }
+
+    size_t GetSamplesCount() const {
+        return _samples;
+    }
+
+    CNNNetwork Quantize() const {
+        if (_samples == 0)
+            THROW_IE_EXCEPTION << "No samples were collected to calibrate the network";
+
+        const auto quantized = ngraph::clone_function(*_function);
+        std::map<std::string, std::shared_ptr<ngraph::Node>> activations;
+        for (const auto& node : quantized->get_ordered_ops()) {
+            if (!IsCandidate(node))
+                continue;
+
+            for (const auto& input : node->inputs()) {
+                const auto source = input.get_source_output();
+                if (IsConstant(source)) {
+                    if (source.get_element_type() == ngraph::element::f32)
+                        input.replace_source_output(QuantizeWeights(node, source));
+                    continue;
+                }
+
+                const auto name = DataName(source);
+                auto statistics = _statistics.find(name);
+                if (statistics == _statistics.end())
+                    continue;
+                auto& fakeQuantize = activations[name];
+                if (fakeQuantize == nullptr)
+                    fakeQuantize = QuantizeActivation(source, statistics->second);
+                input.replace_source_output(fakeQuantize);
+            }
+        }
+
+        return CNNNetwork(quantized);
+    }
+
+private:
+    std::shared_ptr<ngraph::Node> QuantizeActivation(const ngraph::Output<ngraph::Node>& output,
+                                                     const TensorStatistics& statistics) const {
+        // unsigned tensors get [0, high] range to use all levels for positive values
+        const bool isUnsigned = statistics.Min() >= 0.f;
+        float low = std::min(statistics.Min(), 0.f);
+        float high = std::max(statistics.Max(), 0.f);
+        switch (_config.algorithm) {
+        case CalibrationConfig::RangeAlgorithm::MinMax:
+            break;
+        case CalibrationConfig::RangeAlgorithm::Percentile:
+            high = statistics.Percentile(_config.percentile);
+            low = isUnsigned ? 0.f : -high;
+            break;
+        case CalibrationConfig::RangeAlgorithm::KL:
+            high = statistics.KLThreshold(isUnsigned ? 256 : 128);
+            low = isUnsigned ? 0.f : -high;
+            break;
+        }
+        if (high <= low)
+            high = low + 1.f;
+
+        return MakeFakeQuantize(output, ngraph::Shape{}, {low}, {high}, 256);
+    }
+
+    std::shared_ptr<ngraph::Node> QuantizeWeights(const std::shared_ptr<ngraph::Node>& node,
+                                                  const ngraph::Output<ngraph::Node>& weights) const {
+        const auto constant = ngraph::as_type_ptr<ngraph::opset1::Constant>(weights.get_node_shared_ptr());
+        const auto values = constant->cast_vector<float>();
+        const auto& shape = weights.get_shape();
+
+        // Convolution weights are [O, I, ...], other weights are quantized per tensor
+        const bool perChannel = _config.perChannelWeights && ngraph::is_type<ngraph::opset1::Convolution>(node) &&
+                                shape.size() > 1;
+        const size_t channels = perChannel ? shape[0] : 1;
+        const size_t channelSize = values.size() / channels;
+
+        std::vector<float> low(channels), high(channels);
+        for (size_t c = 0; c < channels; c++) {
+            float absMax = 0.f;
+            for (size_t i = c * channelSize; i < (c + 1) * channelSize; i++)
+                absMax = std::max(absMax, std::fabs(values[i]));
+            if (absMax == 0.f)
+                absMax = 1.f;
+            low[c] = -absMax;
+            high[c] = absMax;
+        }
+
+        ngraph::Shape rangeShape;
+        if (perChannel) {
+            rangeShape = ngraph::Shape(shape.size(), 1);
+            rangeShape[0] = channels;
+        }
+        return MakeFakeQuantize(weights, rangeShape, low, high, 255);
+    }
+
+    CalibrationConfig                           _config;
+    std::shared_ptr<const ngraph::Function>     _function;
+    std::map<std::string, TensorStatistics>     _statistics;
+    InferRequest                                _request;
+    size_t                                      _samples = 0;
+};
+
+Calibrator::Calibrator(Core& core, const CNNNetwork& network, const CalibrationConfig& config):
+    _impl(std::make_shared<Impl>(core, network, config)) {}
+
+Calibrator::~Calibrator() = default;
+
+void Calibrator::Collect(const BlobMap& inputs) {
+    _impl->Collect(inputs);
+}
+
+size_t Calibrator::GetSamplesCount() const {
+    return _impl->GetSamplesCount();
+}
+
+CNNNetwork Calibrator::Quantize() const {
+    return _impl->Quantize();
+}
+
+}  // namespace InferenceEngine
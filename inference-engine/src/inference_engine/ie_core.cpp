@@ -29,6 +29,7 @@
 #include "ie_profiling.hpp"
 #include "ie_util_internal.hpp"
 #include "multi-device/multi_device_config.hpp"
+#include "auto-batch/auto_batch_config.hpp"
 #include "xml_parse_utils.h"
 
 using namespace InferenceEngine::PluginConfigParams;
@@ -87,6 +88,9 @@ Parsed<T> parseDeviceNameIntoConfig(const std::string& deviceName, const std::ma
     } else if (deviceName_.find("MULTI:") == 0) {
         deviceName_ = "MULTI";
         config_[InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES] = deviceName.substr(6);
+    } else if (deviceName_.find("BATCH:") == 0) {
+        deviceName_ = "BATCH";
+        config_[InferenceEngine::AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE] = deviceName.substr(6);
     } else {
         DeviceIDParser parser(deviceName_);
         deviceName_ = parser.getDeviceName();
@@ -429,6 +433,15 @@ public:
             }
         }
 
+        // BATCH case
+        {
+            if (deviceName.find("BATCH:") == 0) {
+                THROW_IE_EXCEPTION
+                    << "You can get specific metrics with the GetMetric only for the BATCH itself (without devices). "
+                       "To get individual devices's metrics call GetMetric for each device separately";
+            }
+        }
+
         auto parsed = parseDeviceNameIntoConfig(deviceName);
         IE_SUPPRESS_DEPRECATED_START
         InferencePlugin cppPlugin = GetCPPPluginByName(parsed._deviceName);
@@ -677,6 +690,12 @@ std::map<std::string, Version> Core::GetVersions(const std::string& deviceName)
                 deviceNames = DeviceIDParser::getMultiDevices(deviceName.substr(pos + 1));
             }
             deviceNames.push_back("MULTI");
+        } else if (deviceName.find("BATCH") == 0) {
+            auto pos = deviceName.find_first_of(":");
+            if (pos != std::string::npos) {
+                deviceNames = DeviceIDParser::getMultiDevices(deviceName.substr(pos + 1));
+            }
+            deviceNames.push_back("BATCH");
         } else {
             deviceNames.push_back(deviceName);
         }
@@ -750,6 +769,9 @@ RemoteContext::Ptr Core::CreateContext(const std::string& deviceName_, const Par
     if (deviceName_.find("MULTI") == 0) {
         THROW_IE_EXCEPTION << "MULTI device does not support remote contexts";
     }
+    if (deviceName_.find("BATCH") == 0) {
+        THROW_IE_EXCEPTION << "BATCH device does not support remote contexts";
+    }
 
     DeviceIDParser device(deviceName_);
     std::string deviceName = device.getDeviceName();
@@ -773,6 +795,9 @@ RemoteContext::Ptr Core::GetDefaultContext(const std::string& deviceName_) {
     if (deviceName_.find("MULTI") == 0) {
         THROW_IE_EXCEPTION << "MULTI device does not support remote contexts";
     }
+    if (deviceName_.find("BATCH") == 0) {
+        THROW_IE_EXCEPTION << "BATCH device does not support remote contexts";
+    }
 
     DeviceIDParser device(deviceName_);
     std::string deviceName = device.getDeviceName();
@@ -798,6 +823,10 @@ void Core::AddExtension(IExtensionPtr extension, const std::string& deviceName_)
         THROW_IE_EXCEPTION
             << "MULTI device does not support extensions. Please, set extensions directly to fallback devices";
     }
+    if (deviceName_.find("BATCH") == 0) {
+        THROW_IE_EXCEPTION
+            << "BATCH device does not support extensions. Please, set extensions directly to the batched device";
+    }
 
     _impl->AddExtension(extension);
 }
@@ -810,6 +839,9 @@ ExecutableNetwork Core::ImportNetwork(const std::string& modelFileName, const st
     if (deviceName.find("MULTI") == 0) {
         THROW_IE_EXCEPTION << "MULTI device does not support ImportNetwork";
     }
+    if (deviceName.find("BATCH") == 0) {
+        THROW_IE_EXCEPTION << "BATCH device does not support ImportNetwork";
+    }
 
     auto parsed = parseDeviceNameIntoConfig(deviceName, config);
 
@@ -871,6 +903,14 @@ void Core::SetConfig(const std::map<std::string, std::string>& config, const std
         }
     }
 
+    // BATCH case
+    {
+        if (deviceName.find("BATCH:") == 0) {
+            THROW_IE_EXCEPTION << "SetConfig is supported only for BATCH itself (without devices). "
+                                  "You can configure the devices with SetConfig before creating the BATCH on top.";
+        }
+    }
+
     if (deviceName.empty()) {
         _impl->SetConfigForPlugins(config, std::string());
     } else {
@@ -0,0 +1,313 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_streaming_session.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "blob_factory.hpp"
+#include "details/ie_exception.hpp"
+#include "ie_algorithm.hpp"
+#include "ie_memcpy.h"
+
+namespace InferenceEngine {
+
+class StreamingPool::Impl {
+public:
+    struct Request {
+        InferRequest                request;
+        Blob::Ptr                   input;
+        Blob::Ptr                   output;
+        std::vector<MemoryState>    states;
+        // The session whose memory states are kept by the request
+        StreamingSession::Impl*     owner = nullptr;
+        bool                        busy = false;
+    };
+
+    Impl(ExecutableNetwork& network, size_t numRequests, const StreamingConfig& config);
+
+    // Waits for an idle request and swaps in the states of the session
+    Request& Acquire(StreamingSession::Impl* session);
+    void Release(Request& request);
+    void ResetStates(StreamingSession::Impl* session);
+    void Forget(StreamingSession::Impl* session);
+
+    StreamingConfig                         _config;
+    size_t                                  _batch = 0;
+    size_t                                  _frameSize = 0;
+    size_t                                  _scoreSize = 0;
+
+private:
+    void SwapOut(Request& request);
+    void SwapIn(Request& request, StreamingSession::Impl* session);
+
+    std::vector<std::unique_ptr<Request>>   _requests;
+    std::mutex                              _mutex;
+    std::condition_variable                 _cv;
+};
+
+class StreamingSession::Impl {
+public:
+    explicit Impl(const std::shared_ptr<StreamingPool::Impl>& pool): _pool(pool) {
+        Reset();
+    }
+
+    ~Impl() {
+        _pool->Forget(this);
+    }
+
+    size_t Push(const float* frames, size_t numFrames, std::vector<float>& scores) {
+        const size_t frameSize = _pool->_frameSize;
+        if (numFrames == 0)
+            return 0;
+        if (frames == nullptr)
+            THROW_IE_EXCEPTION << "Frames of the stream are not allocated";
+
+        if (!_started) {
+            // The left context before the first frame is filled with the first frame
+            for (size_t i = 0; i < _pool->_config.leftContext; i++)
+                _pending.insert(_pending.end(), frames, frames + frameSize);
+            _started = true;
+        }
+        _pending.insert(_pending.end(), frames, frames + numFrames * frameSize);
+        _lastFrame.assign(frames + (numFrames - 1) * frameSize, frames + numFrames * frameSize);
+
+        return InferPending(false, scores);
+    }
+
+    size_t Finish(std::vector<float>& scores) {
+        size_t numScores = 0;
+        if (_started) {
+            // The right context after the last frame is filled with the last frame
+            for (size_t i = 0; i < _pool->_config.rightContext; i++)
+                _pending.insert(_pending.end(), _lastFrame.begin(), _lastFrame.end());
+            numScores = InferPending(true, scores);
+        }
+        Reset();
+        return numScores;
+    }
+
+    void Reset() {
+        _pending.clear();
+        _lastFrame.clear();
+        _started = false;
+        _scoresToDrop = _pool->_config.leftContext + _pool->_config.rightContext;
+        _pool->ResetStates(this);
+    }
+
+    std::shared_ptr<StreamingPool::Impl>    _pool;
+    // The memory states saved when the request keeping them was taken by another session, empty after reset
+    std::map<std::string, Blob::Ptr>        _savedStates;
+    StreamingPool::Impl::Request*           _resident = nullptr;
+
+private:
+    // Infers full batches of the pending frames, the last incomplete batch is padded with zeros if `flush` is set
+    size_t InferPending(bool flush, std::vector<float>& scores) {
+        const size_t frameSize = _pool->_frameSize;
+        const size_t scoreSize = _pool->_scoreSize;
+        const size_t batch = _pool->_batch;
+        const size_t numPending = _pending.size() / frameSize;
+
+        size_t numScores = 0;
+        size_t processed = 0;
+        while (numPending - processed >= batch || (flush && processed < numPending)) {
+            const size_t numFrames = std::min(batch, numPending - processed);
+
+            auto& request = _pool->Acquire(this);
+            try {
+                auto inputData = request.input->buffer().as<float*>();
+                std::copy_n(_pending.begin() + processed * frameSize, numFrames * frameSize, inputData);
+                std::fill(inputData + numFrames * frameSize, inputData + batch * frameSize, 0.f);
+
+                request.request.Infer();
+
+                auto outputData = request.output->cbuffer().as<const float*>();
+                for (size_t i = 0; i < numFrames; i++) {
+                    if (_scoresToDrop > 0) {
+                        _scoresToDrop--;
+                        continue;
+                    }
+                    scores.insert(scores.end(), outputData + i * scoreSize, outputData + (i + 1) * scoreSize);
+                    numScores++;
+                }
+            } catch (...) {
+                _pool->Release(request);
+                throw;
+            }
+            _pool->Release(request);
+            processed += numFrames;
+        }
+        _pending.erase(_pending.begin(), _pending.begin() + processed * frameSize);
+        return numScores;
+    }
+
+    std::vector<float>                      _pending;
+    std::vector<float>                      _lastFrame;
+    bool                                    _started = false;
+    size_t                                  _scoresToDrop = 0;
+};
+
+StreamingPool::Impl::Impl(ExecutableNetwork& network, size_t numRequests, const StreamingConfig& config):
+    _config(config) {
+    if (numRequests == 0)
+        THROW_IE_EXCEPTION << "Streaming pool needs at least one infer request";
+
+    ConstInputsDataMap inputs = network.GetInputsInfo();
+    ConstOutputsDataMap outputs = network.GetOutputsInfo();
+    if (inputs.size() != 1 || outputs.size() != 1)
+        THROW_IE_EXCEPTION << "Streaming is supported only for networks with one input and one output";
+
+    const auto& inputDesc = inputs.begin()->second->getTensorDesc();
+    const auto& outputDesc = outputs.begin()->second->getTensorDesc();
+    if (inputDesc.getPrecision() != Precision::FP32 || outputDesc.getPrecision() != Precision::FP32)
+        THROW_IE_EXCEPTION << "Streaming is supported only for FP32 input and output";
+    if (inputDesc.getDims().empty() || outputDesc.getDims().empty() ||
+        inputDesc.getDims()[0] != outputDesc.getDims()[0])
+        THROW_IE_EXCEPTION << "Input and output of a streamed network must have the same number of frames";
+    if (inputDesc.getLayout() == Layout::CN || outputDesc.getLayout() == Layout::CN)
+        THROW_IE_EXCEPTION << "Streamed frames must be the outermost dimension";
+
+    const auto& inputDims = inputDesc.getDims();
+    const auto& outputDims = outputDesc.getDims();
+    _batch = inputDims[0];
+    _frameSize = details::product(inputDims.begin() + 1, inputDims.end());
+    _scoreSize = details::product(outputDims.begin() + 1, outputDims.end());
+
+    for (size_t i = 0; i < numRequests; i++) {
+        std::unique_ptr<Request> request(new Request);
+        request->request = network.CreateInferRequest();
+        request->input = request->request.GetBlob(inputs.begin()->first);
+        request->output = request->request.GetBlob(outputs.begin()->first);
+        request->states = request->request.QueryState();
+        _requests.push_back(std::move(request));
+    }
+}
+
+StreamingPool::Impl::Request& StreamingPool::Impl::Acquire(StreamingSession::Impl* session) {
+    std::unique_lock<std::mutex> lock(_mutex);
+    Request* request = nullptr;
+    _cv.wait(lock, [&] {
+        // The request keeping the states of the session, then a free one, then any idle one
+        if (session->_resident != nullptr && !session->_resident->busy) {
+            request = session->_resident;
+            return true;
+        }
+        Request* idle = nullptr;
+        for (auto& candidate : _requests) {
+            if (candidate->busy)
+                continue;
+            if (candidate->owner == nullptr) {
+                request = candidate.get();
+                return true;
+            }
+            if (idle == nullptr)
+                idle = candidate.get();
+        }
+        request = idle;
+        return request != nullptr;
+    });
+
+    if (request->owner != session) {
+        SwapOut(*request);
+        SwapIn(*request, session);
+    }
+    request->busy = true;
+    return *request;
+}
+
+void StreamingPool::Impl::Release(Request& request) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        request.busy = false;
+    }
+    _cv.notify_all();
+}
+
+void StreamingPool::Impl::ResetStates(StreamingSession::Impl* session) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    session->_savedStates.clear();
+    if (session->_resident != nullptr) {
+        for (auto& state : session->_resident->states)
+            state.Reset();
+    }
+}
+
+void StreamingPool::Impl::Forget(StreamingSession::Impl* session) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (session->_resident != nullptr)
+        session->_resident->owner = nullptr;
+    session->_resident = nullptr;
+}
+
+void StreamingPool::Impl::SwapOut(Request& request) {
+    auto owner = request.owner;
+    if (owner == nullptr)
+        return;
+
+    for (auto& state : request.states) {
+        auto lastState = state.GetLastState();
+        if (lastState == nullptr)
+            THROW_IE_EXCEPTION << "Memory state " << state.GetName() << " cannot be swapped out of the request";
+        // The plugin may reuse the returned blob, so the state is copied
+        auto saved = make_blob_with_precision(lastState->getTensorDesc());
+        saved->allocate();
+        ie_memcpy(saved->buffer(), saved->byteSize(), lastState->cbuffer().as<const void*>(), lastState->byteSize());
+        owner->_savedStates[state.GetName()] = saved;
+    }
+    owner->_resident = nullptr;
+    request.owner = nullptr;
+}
+
+void StreamingPool::Impl::SwapIn(Request& request, StreamingSession::Impl* session) {
+    for (auto& state : request.states) {
+        auto saved = session->_savedStates.find(state.GetName());
+        if (saved != session->_savedStates.end()) {
+            state.SetState(saved->second);
+        } else {
+            state.Reset();
+        }
+    }
+    session->_savedStates.clear();
+    session->_resident = &request;
+    request.owner = session;
+}
+
+StreamingSession::StreamingSession(const std::shared_ptr<Impl>& impl): _impl(impl) {}
+
+StreamingSession::~StreamingSession() = default;
+
+size_t StreamingSession::Push(const float* frames, size_t numFrames, std::vector<float>& scores) {
+    return _impl->Push(frames, numFrames, scores);
+}
+
+size_t StreamingSession::Finish(std::vector<float>& scores) {
+    return _impl->Finish(scores);
+}
+
+void StreamingSession::Reset() {
+    _impl->Reset();
+}
+
+size_t StreamingSession::GetFrameSize() const {
+    return _impl->_pool->_frameSize;
+}
+
+size_t StreamingSession::GetScoreSize() const {
+    return _impl->_pool->_scoreSize;
+}
+
+StreamingPool::StreamingPool(ExecutableNetwork network, size_t numRequests, const StreamingConfig& config):
+    _impl(std::make_shared<Impl>(network, numRequests, config)) {}
+
+StreamingSession::Ptr StreamingPool::OpenSession() {
+    return std::make_shared<StreamingSession>(std::make_shared<StreamingSession::Impl>(_impl));
+}
+
+}  // namespace InferenceEngine
@@ -8,7 +8,6 @@
 #include <fstream>
 #include <map>
 #include <memory>
-#include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
@@ -40,9 +39,7 @@ StatusCode CNNNetReaderImpl::SetWeights(const TBlob<uint8_t>::Ptr& weights, Resp
         if (_version == 10) {
             // It's time to perform actual reading of V10 network and instantiate CNNNetworkNGraphImpl
             IRReader v10Reader(extensions);
-            std::stringstream model;
-            xmlDoc->save(model);
-            network = std::make_shared<CNNNetworkNGraphImpl>(v10Reader.read(model.str(), weights));
+            network = std::make_shared<CNNNetworkNGraphImpl>(v10Reader.read(*xmlDoc, weights));
         } else if (weights) {
             _parser->SetWeights(weights);
         }
@@ -8,13 +8,16 @@
 
 #include <unordered_set>
 #include <algorithm>
+#include <cstdlib>
 #include <deque>
+#include <exception>
 #include <map>
 #include <memory>
 #include <ngraph/ngraph.hpp>
 #include <set>
 #include <sstream>
 #include <string>
+#include <utility>
 #include <vector>
 #include <ngraph/op/strided_slice.hpp>
 #include <ngraph/op/not_equal.hpp>
@@ -25,6 +28,7 @@
 #include <ngraph/variant.hpp>
 
 #include "cnn_network_impl.hpp"
+#include "ie_parallel.hpp"
 #include "details/caseless.hpp"
 #include "details/ie_cnn_network_tools.h"
 #include "ie_format_parser.h"
@@ -84,10 +88,11 @@ std::shared_ptr<ngraph::Function> V10Parser::parse(const pugi::xml_node& root, c
         if (opName.find(node_param.name) != opName.end())
             THROW_IE_EXCEPTION << "Invalid IR! " << node_param.name << " name is not unique!";
         opName.insert(node_param.name);
-        params[node_param.layerId] = {node, node_param};
         if (node_param.type == "Result" || node_param.type == "Assign") {
             outputs.push_back(node_param.layerId);
         }
+        const size_t layerId = node_param.layerId;
+        params[layerId] = {node, std::move(node_param)};
     }
 
     using edge = struct { size_t fromLayerId, fromPortId, toPortId; };
@@ -122,6 +127,28 @@ std::shared_ptr<ngraph::Function> V10Parser::parse(const pugi::xml_node& root, c
     std::vector<std::shared_ptr<ngraph::op::Assign>> assign_nodes;
     std::map<std::string, std::shared_ptr<ngraph::Node>> variable_id_to_read_value;
 
+    // Constants don't depend on other layers and their creation (copy of weights) dominates reading
+    // of big models, so they are created in parallel before the rest of the graph
+    std::vector<std::pair<size_t, node_params*>> constants;
+    for (const auto& layer_id : order) {
+        auto& p = params[layer_id];
+        if (edges[layer_id].empty() && details::CaselessEq<std::string>()(p.params.type, "Const"))
+            constants.emplace_back(layer_id, &p);
+    }
+    std::vector<std::shared_ptr<ngraph::Node>> constant_nodes(constants.size());
+    std::vector<std::exception_ptr> constant_errors(constants.size());
+    parallel_for(constants.size(), [&](size_t i) {
+        try {
+            constant_nodes[i] = createNode({}, constants[i].second->xml, weights, constants[i].second->params);
+        } catch (...) {
+            constant_errors[i] = std::current_exception();
+        }
+    });
+    for (size_t i = 0; i < constants.size(); i++) {
+        if (constant_errors[i]) std::rethrow_exception(constant_errors[i]);
+        id_to_node[constants[i].first] = constant_nodes[i];
+    }
+
     //  Following topological order create nGraph operations
     for (auto& layer_id : order) {
         auto& p = params[layer_id];
@@ -139,8 +166,9 @@ std::shared_ptr<ngraph::Function> V10Parser::parse(const pugi::xml_node& root, c
                 input_node->output(p_output.getRealOutputPortId(e.fromPortId));
         }
 
-        auto node = createNode(inputs, p.xml, weights, p.params);
-        id_to_node[layer_id] = node;
+        auto& node = id_to_node[layer_id];
+        if (!node)
+            node = createNode(inputs, p.xml, weights, p.params);
 
         // Check that output shape after nGraph node validation the same as in IR
         // because IR always right!
@@ -194,10 +222,10 @@ V10Parser::GenericLayerParams V10Parser::parseGenericParams(const pugi::xml_node
         port.portId = GetIntAttr(parentNode, "id");
 
         for (auto node = parentNode.child("dim"); !node.empty(); node = node.next_sibling("dim")) {
-            size_t dim = 0;
             const pugi::char_t* dimVal = node.child_value();
-            std::stringstream ss(dimVal);
-            if (!(ss >> dim) || dim == 0) {
+            char* dimEnd = nullptr;
+            size_t dim = static_cast<size_t>(std::strtoull(dimVal, &dimEnd, 10));
+            if (dimEnd == dimVal || dim == 0) {
                 THROW_IE_EXCEPTION << "dimension (" << dimVal << ") in node " << node.name()
                                    << " must be a positive integer: at offset " << node.offset_debug();
             }
@@ -237,11 +265,6 @@ V10Parser::GenericLayerParams V10Parser::parseGenericParams(const pugi::xml_node
     return params;
 }
 
-bool V10Parser::LayerBaseCreator::shouldCreate(const std::string& nodeType) const {
-    InferenceEngine::details::CaselessEq<std::string> comparator;
-    return comparator(nodeType, type);
-}
-
 std::shared_ptr<ngraph::Node> V10Parser::createNode(const std::vector<ngraph::Output<ngraph::Node>>& inputs,
                                                     const pugi::xml_node& node, const Blob::CPtr& weights,
                                                     const GenericLayerParams& params) {
@@ -362,28 +385,35 @@ std::shared_ptr<ngraph::Node> V10Parser::createNode(const std::vector<ngraph::Ou
                 << " has undefined element type for input with index " << i << "!";
     }
 
+    // Layer type is hashed once instead of caseless comparison with every creator
+    static const details::caseless_unordered_map<std::string, std::shared_ptr<LayerBaseCreator>> creatorsByType = [] {
+        details::caseless_unordered_map<std::string, std::shared_ptr<LayerBaseCreator>> result;
+        for (const auto& creator : creators)
+            result.emplace(creator->getType(), creator);
+        return result;
+    }();
+
+    const auto opsetIt = opsets.find(params.version);
     std::shared_ptr<ngraph::Node> ngraphNode;
     // Try to create operation from creators
-    for (const auto& creator : creators) {
-        if (creator->shouldCreate(params.type)) {
-            bool useCreator = false;
-            // Check that opset is registered
-            useCreator |= opsets.find(params.version) == opsets.end();
-            if (!useCreator) {
-                // Check that creator can create operation with the version from opset
-                const auto opset = opsets.at(params.version);
-                // Opset should contains the same version of operation or doesn't contain operation with current type
-                useCreator |= opset.contains_type(creator->getNodeType()) || !opset.contains_type(params.type);
-            }
-            if (useCreator)
-                ngraphNode = creator->createLayer(inputs, node, weights, params);
-            break;
+    const auto creatorIt = creatorsByType.find(params.type);
+    if (creatorIt != creatorsByType.end()) {
+        const auto& creator = creatorIt->second;
+        // Check that opset is registered
+        bool useCreator = opsetIt == opsets.end();
+        if (!useCreator) {
+            // Check that creator can create operation with the version from opset
+            const auto& opset = opsetIt->second;
+            // Opset should contains the same version of operation or doesn't contain operation with current type
+            useCreator |= opset.contains_type(creator->getNodeType()) || !opset.contains_type(params.type);
         }
+        if (useCreator)
+            ngraphNode = creator->createLayer(inputs, node, weights, params);
     }
 
     // Try to create operation from loaded opsets
-    if (!ngraphNode && opsets.count(params.version)) {
-        auto opset = opsets.at(params.version);
+    if (!ngraphNode && opsetIt != opsets.end()) {
+        const auto& opset = opsetIt->second;
 
         if (!opset.contains_type(params.type)) {
             THROW_IE_EXCEPTION << "Opset " << params.version << " doesn't contain the operation with type: " << params.type;
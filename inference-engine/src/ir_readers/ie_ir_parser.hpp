@@ -92,9 +92,6 @@ private:
 
     protected:
         explicit LayerBaseCreator(const std::string& type): type(type) {}
-        std::string getType() {
-            return type;
-        }
         template <class T>
         std::vector<T> getParameters(const pugi::xml_node& node, const std::string& name) {
             std::vector<T> result;
@@ -139,7 +136,9 @@ private:
                                                           const pugi::xml_node& node, const Blob::CPtr& weights,
                                                           const GenericLayerParams& layerParsePrms) = 0;
 
-        bool shouldCreate(const std::string& nodeType) const;
+        const std::string& getType() const {
+            return type;
+        }
         virtual ngraph::NodeTypeInfo getNodeType() const = 0;
     };
 
@@ -160,62 +159,57 @@ private:
 
     GenericLayerParams parseGenericParams(const pugi::xml_node& node);
 
-    std::map<std::string, DataPtr> portsToData;
-    std::map<std::string, GenericLayerParams> layersParseInfo;
-
     class XmlDeserializer : public ngraph::AttributeVisitor {
     public:
-        explicit XmlDeserializer(const pugi::xml_node& node): node(node) {}
+        // data node of the layer is looked up once instead of for every visited attribute
+        explicit XmlDeserializer(const pugi::xml_node& node): data(node.child("data")) {}
         void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& value) override {
             std::string val;
-            if (!getStrAttribute(node.child("data"), name, val)) return;
+            if (!getStrAttribute(data, name, val)) return;
             value.set(val);
         }
         void on_adapter(const std::string& name, ngraph::ValueAccessor<bool>& value) override {
             std::string val;
-            if (!getStrAttribute(node.child("data"), name, val)) return;
+            if (!getStrAttribute(data, name, val)) return;
             std::transform(val.begin(), val.end(), val.begin(), [](char ch) {
                 return std::tolower(static_cast<unsigned char>(ch));
             });
-            std::set<std::string> true_names {"true", "1"};
-            std::set<std::string> false_names {"false", "0"};
-
-            bool is_true = true_names.find(val) != true_names.end();
-            bool is_false = false_names.find(val) != false_names.end();
+            bool is_true = val == "true" || val == "1";
+            bool is_false = val == "false" || val == "0";
 
             if (!is_true && !is_false) return;
             value.set(is_true);
         }
         void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override {
             std::string val;
-            if (!getStrAttribute(node.child("data"), name, val)) return;
+            if (!getStrAttribute(data, name, val)) return;
             if (auto a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::element::Type>>(&adapter)) {
                 static_cast<ngraph::element::Type&>(*a) = details::convertPrecision(val);
             } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::PartialShape>>(&adapter)) {
                 std::vector<int64_t> shape;
                 std::vector<ngraph::Dimension> dims;
-                if (!getParameters<int64_t>(node.child("data"), name, shape)) return;
+                if (!getParameters<int64_t>(data, name, shape)) return;
                 for (const auto& dim : shape) dims.emplace_back(dim);
                 static_cast<ngraph::PartialShape&>(*a) = ngraph::PartialShape(dims);
             } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::Shape>>(&adapter)) {
                 std::vector<size_t> shape;
-                if (!getParameters<size_t>(node.child("data"), name, shape)) return;
+                if (!getParameters<size_t>(data, name, shape)) return;
                 static_cast<ngraph::Shape&>(*a) = ngraph::Shape(shape);
             } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::Strides>>(&adapter)) {
                 std::vector<size_t> shape;
-                if (!getParameters<size_t>(node.child("data"), name, shape)) return;
+                if (!getParameters<size_t>(data, name, shape)) return;
                 static_cast<ngraph::Strides&>(*a) = ngraph::Strides(shape);
             } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::op::TopKSortType>>(&adapter)) {
-                if (!getStrAttribute(node.child("data"), name, val)) return;
+                if (!getStrAttribute(data, name, val)) return;
                 static_cast<ngraph::op::TopKSortType&>(*a) = ngraph::as_enum<ngraph::op::TopKSortType>(val);
             } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::op::TopKMode>>(&adapter)) {
-                if (!getStrAttribute(node.child("data"), name, val)) return;
+                if (!getStrAttribute(data, name, val)) return;
                 static_cast<ngraph::op::TopKMode&>(*a) = ngraph::as_enum<ngraph::op::TopKMode>(val);
             }
         }
         void on_adapter(const std::string& name, ngraph::ValueAccessor<double>& adapter) override {
             std::string val;
-            if (!getStrAttribute(node.child("data"), name, val))
+            if (!getStrAttribute(data, name, val))
                 return;
             double value;
             stringToType<double>(val, value);
@@ -223,7 +217,7 @@ private:
         }
         void on_adapter(const std::string& name, ngraph::ValueAccessor<int64_t>& adapter) override {
             std::string val;
-            if (!getStrAttribute(node.child("data"), name, val))
+            if (!getStrAttribute(data, name, val))
                 return;
             int64_t value;
             stringToType<int64_t>(val, value);
@@ -232,18 +226,18 @@ private:
 
         void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<float>>& adapter) override {
             std::vector<float> value;
-            if (!getParameters<float>(node.child("data"), name, value)) return;
+            if (!getParameters<float>(data, name, value)) return;
             adapter.set(value);
         }
 
         void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::string>>& adapter) override {
             std::vector<std::string> value;
-            if (!getParameters<std::string>(node.child("data"), name, value)) return;
+            if (!getParameters<std::string>(data, name, value)) return;
             adapter.set(value);
         }
 
     private:
-        const pugi::xml_node node;
+        const pugi::xml_node data;
 
         bool getStrAttribute(const pugi::xml_node& node, const std::string& name, std::string& value) {
             if (!node) return false;
@@ -22,11 +22,12 @@ static size_t GetIRVersion(pugi::xml_node& root) {
 }
 
 std::shared_ptr<ngraph::Function> IRReader::read(const std::string& modelPath, const std::string& binPath) {
-    std::ifstream modelFile(modelPath);
-    if (!modelFile.is_open()) THROW_IE_EXCEPTION << "File " << modelPath << " cannot be openned!";
+    if (!FileUtils::fileExist(modelPath)) THROW_IE_EXCEPTION << "File " << modelPath << " cannot be openned!";
 
-    std::stringstream modelBuf;
-    modelBuf << modelFile.rdbuf();
+    // pugixml reads the file into a single buffer and parses it in place, so the XML is neither
+    // copied into intermediate streams nor duplicated by the DOM
+    auto parse_result = ParseXml(modelPath.c_str());
+    if (!parse_result.error_msg.empty()) THROW_IE_EXCEPTION << parse_result.error_msg;
 
     Blob::Ptr weights;
     std::string bPath = binPath;
@@ -53,7 +54,7 @@ std::shared_ptr<ngraph::Function> IRReader::read(const std::string& modelPath, c
         FileUtils::readAllFile(bPath, weights->buffer(), ulFileSize);
     }
 
-    return read(modelBuf.str(), weights);
+    return read(*parse_result.xml, weights);
 }
 
 std::shared_ptr<ngraph::Function> IRReader::read(const std::string& model, const Blob::CPtr& weights) {
@@ -62,10 +63,10 @@ std::shared_ptr<ngraph::Function> IRReader::read(const std::string& model, const
     if (res.status != pugi::status_ok) {
         THROW_IE_EXCEPTION << res.description() << "at offset " << res.offset;
     }
-    return readXml(xmlDoc, weights);
+    return read(xmlDoc, weights);
 }
 
-std::shared_ptr<ngraph::Function> IRReader::readXml(const pugi::xml_document& xmlDoc, const Blob::CPtr& weights) {
+std::shared_ptr<ngraph::Function> IRReader::read(const pugi::xml_document& xmlDoc, const Blob::CPtr& weights) {
     try {
         // check which version it is...
         pugi::xml_node root = xmlDoc.document_element();
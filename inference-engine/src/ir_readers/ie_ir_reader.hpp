@@ -50,9 +50,15 @@ public:
      * @return shared pointer to nGraph function
      */
     std::shared_ptr<ngraph::Function> read(const std::string& model, const Blob::CPtr& weights);
+    /**
+     * @brief Reads IR from already parsed xml document
+     * @param xmlDoc parsed IR xml
+     * @param weights shared pointer to constant blob with weights
+     * @return shared pointer to nGraph function
+     */
+    std::shared_ptr<ngraph::Function> read(const pugi::xml_document& xmlDoc, const Blob::CPtr& weights);
 
 private:
-    std::shared_ptr<ngraph::Function> readXml(const pugi::xml_document& xmlDoc, const Blob::CPtr& weights);
     std::vector<IExtensionPtr> extensions;
 };
 
@@ -0,0 +1,41 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <vector>
+#include <ie_common.h>
+#include "low_precision_transformations/fully_connected.hpp"
+
+namespace InferenceEngine {
+namespace details {
+
+IE_SUPPRESS_DEPRECATED_START
+
+/**
+ * Gemm (batched MatMul) transformation. 2D Gemm with weights on the second input is handled as FullyConnected,
+ * Gemm of two activations or of activations and batched weights gets low precision inputs when the inputs
+ * are dequantized symmetrically and dequantization is moved after the layer. Batched weights are quantized
+ * per tensor to an I8 constant.
+ */
+class INFERENCE_ENGINE_API_CLASS(GemmTransformation) : public FullyConnectedTransformation {
+public:
+    GemmTransformation(const Params& params) : FullyConnectedTransformation(params) {}
+    ~GemmTransformation() override {};
+    void transform(TransformationContext& context, CNNLayer& layer) const override;
+    bool isQuantized(const CNNLayer& layer) const noexcept override;
+
+    static bool isWeightsOnSecondInput(const CNNLayer& layer);
+
+private:
+    bool getDequantizationScales(
+        const CNNLayer& gemm,
+        const CNNLayer& dequantizationLayer,
+        std::vector<float>& dequantizationScales) const;
+};
+
+IE_SUPPRESS_DEPRECATED_END
+
+}  // namespace details
+}  // namespace InferenceEngine
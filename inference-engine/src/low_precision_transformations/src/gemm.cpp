@@ -0,0 +1,220 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "low_precision_transformations/gemm.hpp"
+
+#include <algorithm>
+#include <details/caseless.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "low_precision_transformations/common/ie_lpt_exception.hpp"
+#include "low_precision_transformations/network_helper.hpp"
+
+using namespace InferenceEngine;
+using namespace InferenceEngine::details;
+
+bool GemmTransformation::isWeightsOnSecondInput(const CNNLayer& layer) {
+    if (layer.insData.size() < 2ul) {
+        return true;
+    }
+
+    CNNLayerPtr parent = CNNNetworkHelper::getParent(layer, 1);
+    if (parent == nullptr) {
+        return false;
+    }
+
+    if (parent->type == "ScaleShift") {
+        const std::vector<CNNLayerPtr> parents = CNNNetworkHelper::getParents(*parent);
+        if (parents.size() != 1ul) {
+            return false;
+        }
+        parent = parents[0];
+    }
+
+    if (parent->type == "Const") {
+        return true;
+    }
+
+    return (parent->type == "FakeQuantize") && CNNNetworkHelper::onWeights(*parent);
+}
+
+bool GemmTransformation::isQuantized(const CNNLayer& layer) const noexcept {
+    if (isWeightsOnSecondInput(layer)) {
+        const DataPtr insData = layer.insData[0].lock();
+        if (insData == nullptr) {
+            return false;
+        }
+
+        // only 2D Gemm with weights is equal to FullyConnected
+        if (insData->getDims().size() == 2ul) {
+            return FullyConnectedTransformation::isQuantized(layer);
+        }
+
+        // batched weights are quantized by the layer transformation
+        const CNNLayerPtr parent = layer.insData.size() == 2ul ? CNNNetworkHelper::getParent(layer, 1) : nullptr;
+        return (parent != nullptr) && (parent->type == "FakeQuantize");
+    }
+
+    return layer.insData.size() == 2ul;
+}
+
+void GemmTransformation::transform(TransformationContext& context, CNNLayer& gemm) const {
+    if (!CaselessEq<std::string>()(gemm.type, "Gemm")) {
+        THROW_IE_LPT_EXCEPTION(gemm) << "layer '" << gemm.name << "' is not correct";
+    }
+
+    const DataPtr insData = gemm.insData[0].lock();
+    if (insData == nullptr) {
+        THROW_IE_LPT_EXCEPTION(gemm) << "input data is absent";
+    }
+
+    const bool onWeights = isWeightsOnSecondInput(gemm);
+    if (onWeights && (insData->getDims().size() == 2ul)) {
+        if (isQuantized(gemm)) {
+            FullyConnectedTransformation::transform(context, gemm);
+        }
+        return;
+    }
+
+    if (!LayerTransformation::canBeTransformed(context, gemm)) {
+        return;
+    }
+
+    if (gemm.outData.size() != 1) {
+        THROW_IE_LPT_EXCEPTION(gemm) << "layer outputs '" << gemm.outData.size() << "' is not correct";
+    }
+
+    const std::vector<CNNLayerPtr> parents = CNNNetworkHelper::getParents(gemm);
+    if ((parents.size() != 2ul) || (parents[0]->type != "ScaleShift") ||
+        (parents[1]->type != (onWeights ? "FakeQuantize" : "ScaleShift")) || (parents[0]->name == parents[1]->name)) {
+        return;
+    }
+
+    for (const CNNLayerPtr& parent : parents) {
+        if (CNNNetworkHelper::getChildren(*parent).size() != 1ul) {
+            return;
+        }
+    }
+
+    // integer Gemm kernels support unsigned or signed first input and signed second input
+    const DataPtr insData0 = parents[0]->insData[0].lock();
+    if (insData0 == nullptr) {
+        THROW_IE_LPT_EXCEPTION(gemm) << "dequantization input data is absent";
+    }
+    const Precision precision0 = insData0->getPrecision();
+    if ((precision0 != Precision::U8) && (precision0 != Precision::I8)) {
+        return;
+    }
+
+    std::vector<float> dequantizationScales0;
+    if (!getDequantizationScales(gemm, *parents[0], dequantizationScales0)) {
+        return;
+    }
+
+    std::vector<float> dequantizationScales1;
+    DataPrecision weightsPrecision;
+    if (onWeights) {
+        // batched weights are quantized per tensor to signed values
+        if (!weightsToConst) {
+            return;
+        }
+
+        const QuantizationDetails quantizationDetails = QuantizationDetails::getDetails(*parents[1]);
+        weightsPrecision = getDataPrecision(*parents[1], quantizationDetails, true, false);
+        if (weightsPrecision.precision != Precision::I8) {
+            return;
+        }
+
+        std::vector<float> dequantizationShifts1;
+        fillFromQuantizationDetails(quantizationDetails, weightsPrecision, dequantizationScales1, dequantizationShifts1);
+        if (std::any_of(dequantizationShifts1.begin(), dequantizationShifts1.end(), [](const float value) { return value != 0.f; }) ||
+            std::any_of(dequantizationScales1.begin(), dequantizationScales1.end(),
+                        [&](const float value) { return value != dequantizationScales1[0]; })) {
+            return;
+        }
+        dequantizationScales1.resize(1ul);
+    } else {
+        const DataPtr insData1 = parents[1]->insData[0].lock();
+        if (insData1 == nullptr) {
+            THROW_IE_LPT_EXCEPTION(gemm) << "dequantization input data is absent";
+        }
+        if ((insData1->getPrecision() != Precision::I8) || !getDequantizationScales(gemm, *parents[1], dequantizationScales1)) {
+            return;
+        }
+    }
+
+    const size_t outputChannelsCount = CNNNetworkHelper::getOutputChannelsCount(gemm);
+    std::vector<float> dequantizationScales(outputChannelsCount);
+    const std::vector<float> dequantizationShifts(outputChannelsCount, 0.f);
+    for (size_t channel = 0ul; channel < outputChannelsCount; ++channel) {
+        dequantizationScales[channel] =
+            dequantizationScales0[dequantizationScales0.size() == 1ul ? 0ul : channel] *
+            dequantizationScales1[dequantizationScales1.size() == 1ul ? 0ul : channel];
+    }
+
+    if (onWeights) {
+        const Blob::Ptr weights = updatePrecisions ?
+            CNNNetworkHelper::quantizeWeights(*parents[1], roundQuantizedValues, weightsPrecision.precision) :
+            CNNNetworkHelper::quantizeWeights(*parents[1], roundQuantizedValues);
+        const std::vector<CNNLayerPtr> constLayers = CNNNetworkHelper::transformFakeQuantizeToConst(
+            context, parents[1], weights, CNNNetworkHelper::getParent(*parents[1], 0)->name);
+        if (updatePrecisions) {
+            CNNNetworkHelper::setOutDataPrecision(constLayers, weightsPrecision.precision);
+        }
+    }
+
+    for (const CNNLayerPtr& parent : parents) {
+        if (parent->type == "ScaleShift") {
+            CNNNetworkHelper::removeLayer(context.network, parent);
+            context.removeLayer(*parent);
+        }
+    }
+
+    const std::vector<CNNLayerPtr> children = CNNNetworkHelper::getChildren(gemm);
+    if (children.size() == 0) {
+        const std::string originalName = gemm.name;
+        CNNNetworkHelper::renameLayer(context.network, gemm.name, gemm.name + LayerTransformation::lastLayerPrefix);
+
+        CNNLayerPtr dequantizationLayer = CNNNetworkHelper::addScaleShiftBetween(
+            context,
+            std::make_shared<CNNLayer>(gemm),
+            nullptr,
+            DequantizationDetails(dequantizationScales, dequantizationShifts, outputChannelsCount),
+            originalName);
+        context.dequantizationLayersNames.insert(dequantizationLayer->name);
+    } else {
+        for (const CNNLayerPtr& child : children) {
+            CNNLayerPtr dequantizationLayer = CNNNetworkHelper::addScaleShiftBetween(
+                context,
+                std::make_shared<CNNLayer>(gemm),
+                child,
+                DequantizationDetails(dequantizationScales, dequantizationShifts, outputChannelsCount));
+            context.dequantizationLayersNames.insert(dequantizationLayer->name);
+        }
+    }
+}
+
+bool GemmTransformation::getDequantizationScales(
+    const CNNLayer& gemm,
+    const CNNLayer& dequantizationLayer,
+    std::vector<float>& dequantizationScales) const {
+    std::vector<float> dequantizationShifts;
+    fillFromDequantizationLayer(dequantizationLayer, dequantizationScales, dequantizationShifts);
+
+    if (std::any_of(dequantizationShifts.begin(), dequantizationShifts.end(), [](const float value) { return value != 0.f; })) {
+        return false;
+    }
+
+    if (std::all_of(dequantizationScales.begin(), dequantizationScales.end(),
+                    [&](const float value) { return value == dequantizationScales[0]; })) {
+        dequantizationScales.resize(1ul);
+        return true;
+    }
+
+    // channels are the batch dimension of 4D Gemm only, in other cases they are multiplied with each other
+    return (gemm.outData[0]->getDims().size() == 4ul) &&
+           (dequantizationScales.size() == CNNNetworkHelper::getOutputChannelsCount(gemm));
+}
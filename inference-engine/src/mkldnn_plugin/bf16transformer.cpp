@@ -22,11 +22,12 @@ void precisionColoringBF16(const CNNLayerPtr layer,
                            ordered_properties &node_properties) {
     if (layer && !layer->insData.empty() && layer->input()) {
         printed_properties.insert(printed_properties.begin(),
-                                  std::pair<std::string, std::string>("Precision",
-                                                                      layer->input()->getPrecision() == Precision::FP32 ? "FP32" : "BF16"));
+                                  std::pair<std::string, std::string>("Precision", layer->input()->getPrecision().name()));
 
         if (layer->input()->getPrecision() == Precision::FP32) {
             node_properties.emplace_back("fillcolor", "#5A5DF0");
+        } else if (layer->input()->getPrecision() != Precision::BF16) {
+            node_properties.emplace_back("fillcolor", "#F0A35A");
         } else {
             node_properties.emplace_back("fillcolor", "#20F608");
         }
@@ -128,7 +129,8 @@ void BF16Transformer::optimizeToFloat(InferenceEngine::CNNNetwork &network) {
                 }
             }
             // try to mark outputs of the unknown layer
-            for (size_t o = 0; o < iter->outData.size(); o++) {
+            // dequantization is executed by the INT8 node it is fused into, its output can stay in BF16
+            for (size_t o = 0; o < iter->outData.size() && !isDequantization(iter); o++) {
                 if (iter->outData[o]->getPrecision() == Precision::BF16) {
                     bool marked = tryToMarkFP32(iter->outData[o], immutable);
                     if (marked) {
@@ -181,6 +183,9 @@ void BF16Transformer::optimizeToFloat(InferenceEngine::CNNNetwork &network) {
         // TODO: add test input1->pooling1->conv1 and the same pooling1->relu. for example. now convolution should be returned to fp32
         // after greedy mode, it should be fp32.
         for (auto inputTo : tensor->getInputTo()) {
+            if (isDequantization(inputTo.second)) {
+                continue;
+            }
             for (size_t o = 0; o < inputTo.second->outData.size(); o++) {
                 if (inputTo.second->outData[o]->getTensorDesc().getPrecision() == Precision::BF16) {
                     bool marked = tryToMarkFP32(inputTo.second->outData[o], immutable);
@@ -229,6 +234,19 @@ bool BF16Transformer::tryToMarkFP32(InferenceEngine::DataPtr data, const std::se
     return marked;
 }
 
+bool BF16Transformer::isDequantization(const InferenceEngine::CNNLayerPtr &layer) const {
+    if (_dequantization.find(layer->type) == _dequantization.end() || layer->insData.size() != 1) {
+        return false;
+    }
+    auto data = layer->insData[0].lock();
+    auto producer = data->getCreatorLayer().lock();
+    if (!producer || _initbf16.find(producer->type) == _initbf16.end() || data->getInputTo().size() != 1) {
+        return false;
+    }
+    auto activationPrecision = producer->insData[0].lock()->getPrecision();
+    return activationPrecision == Precision::U8 || activationPrecision == Precision::I8;
+}
+
 InferenceEngine::MemoryBlob::Ptr BF16Transformer::convertBF16ToFloat(InferenceEngine::MemoryBlob::Ptr tweights) {
     TensorDesc td(Precision::FP32, tweights->getTensorDesc().getDims(), tweights->getTensorDesc().getLayout());
     MemoryBlob::Ptr weightsFP32 = make_shared_blob<float>(td);
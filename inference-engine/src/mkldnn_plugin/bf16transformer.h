@@ -21,6 +21,8 @@ class BF16Transformer {
         { "concat", "eltwise" };
     const InferenceEngine::details::caseless_set<std::string> _skipmarking =
         { "const" };
+    const InferenceEngine::details::caseless_set<std::string> _dequantization =
+        { "scaleshift" };
 
     /**
     * Tries to mark tensor as FP32 by analyzing of local consumers of the tensor. Do not mark if
@@ -32,6 +34,12 @@ class BF16Transformer {
     */
     bool tryToMarkFP32(InferenceEngine::DataPtr data, const std::set<InferenceEngine::DataPtr> &immutable);
 
+    /**
+    * Checks if the layer dequantizes the output of INT8 convolution or FC. Such layer is fused into the INT8 node,
+    * its BF16 output is produced by a single reorder after the node, as INT8 kernels don't write BF16
+    */
+    bool isDequantization(const InferenceEngine::CNNLayerPtr &layer) const;
+
 public:
     /**
      * Restores Float point data types on edges which goes to non supported layers
@@ -57,6 +65,7 @@ public:
 
     /**
     * converts all fp32 edges excepting inputs and outputs to bf16 and call restoreFloatPrecision
+    * quantized edges (U8, I8, BIN) are not touched, so INT8 regions of the network stay in INT8
     */
     void convertToBFloat16(InferenceEngine::CNNNetwork &network);
 
@@ -78,6 +78,25 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             else
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_ENFORCE_BF16
                     << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_SHAPE_CACHE_SIZE) {
+            int val_i = std::stoi(val);
+            if (val_i < 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SHAPE_CACHE_SIZE
+                    << ". Expected only non-negative numbers";
+            shapeCacheSize = val_i;
+        } else if (key == PluginConfigParams::KEY_CPU_SHAPE_BUCKET) {
+            int val_i = std::stoi(val);
+            if (val_i < 1)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SHAPE_BUCKET
+                    << ". Expected only positive numbers";
+            shapeBucket = val_i;
+        } else if (key == PluginConfigParams::KEY_CPU_WEIGHTS_COMPRESSION) {
+            if (val == PluginConfigParams::NO) weightsCompression = WeightsCompression::NoCompression;
+            else if (val == PluginConfigParams::I8) weightsCompression = WeightsCompression::Int8;
+            else if (val == PluginConfigParams::I4) weightsCompression = WeightsCompression::Int4;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_WEIGHTS_COMPRESSION
+                    << ". Expected only NO/I8/I4";
         } else {
             THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported property " << key << " by CPU plugin";
         }
@@ -122,6 +141,19 @@ void Config::updateProperties() {
             _config.insert({ PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::YES });
         else
             _config.insert({ PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::NO });
+        _config.insert({ PluginConfigParams::KEY_CPU_SHAPE_CACHE_SIZE, std::to_string(shapeCacheSize) });
+        _config.insert({ PluginConfigParams::KEY_CPU_SHAPE_BUCKET, std::to_string(shapeBucket) });
+        switch (weightsCompression) {
+            case WeightsCompression::NoCompression:
+                _config.insert({ PluginConfigParams::KEY_CPU_WEIGHTS_COMPRESSION, PluginConfigParams::NO });
+            break;
+            case WeightsCompression::Int8:
+                _config.insert({ PluginConfigParams::KEY_CPU_WEIGHTS_COMPRESSION, PluginConfigParams::I8 });
+            break;
+            case WeightsCompression::Int4:
+                _config.insert({ PluginConfigParams::KEY_CPU_WEIGHTS_COMPRESSION, PluginConfigParams::I4 });
+            break;
+        }
     }
 }
 
@@ -25,6 +25,12 @@ struct Config {
         On,
     };
 
+    enum WeightsCompression {
+        NoCompression,
+        Int8,
+        Int4,
+    };
+
     bool collectPerfCounters = false;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
@@ -33,6 +39,9 @@ struct Config {
     std::string dumpQuantizedGraphToIr = "";
     int batchLimit = 0;
     bool enforceBF16 = false;
+    int shapeCacheSize = 0;
+    int shapeBucket = 1;
+    WeightsCompression weightsCompression = WeightsCompression::NoCompression;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
 
 #if defined(__arm__) || defined(__aarch64__)
@@ -3,6 +3,7 @@
 //
 
 #include <ie_metric_helpers.hpp>
+#include <ie_plugin_config.hpp>
 #include <precision_utils.h>
 #include <net_pass.h>
 #include "mkldnn_exec_network.h"
@@ -11,6 +12,7 @@
 #include "mkldnn_infer_request.h"
 #include "mkldnn_memory_state.h"
 #include "bf16transformer.h"
+#include "weights_compressor.h"
 #include <ie_util_internal.hpp>
 #include <graph_tools.hpp>
 #include <cnn_network_int8_normalizer.hpp>
@@ -18,6 +20,7 @@
 #include "low_precision_transformations/convolution.hpp"
 #include "low_precision_transformations/eltwise.hpp"
 #include "low_precision_transformations/fully_connected.hpp"
+#include "low_precision_transformations/gemm.hpp"
 #include "low_precision_transformations/scaleshift_to_convolution.hpp"
 #include "low_precision_transformations/transformer.hpp"
 #include <threading/ie_cpu_streams_executor.hpp>
@@ -38,36 +41,27 @@ MKLDNNExecNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap network
     return std::make_shared<MKLDNNInferRequest>(networkInputs, networkOutputs, std::static_pointer_cast<MKLDNNExecNetwork>(shared_from_this()));
 }
 
-MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network,
-                                     const Config &cfg,
-                                     const MKLDNNExtensionManager::Ptr& extMgr,
-                                     NumaNodesWeights &numaNodesWeights) :
-    InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
-    extensionManager(extMgr),
-    _cfg{cfg},
-    _name{network.getName()} {
+CNNNetworkImplPtr MKLDNNExecNetwork::PrepareNetwork(const CNNNetworkImplPtr &clonedNetwork) const {
     ICNNNetworkStats* pstats = nullptr;
-    StatusCode s = network.getStats(&pstats, nullptr);
-    // we are cloning network if we have statistics and we can transform network.
-    _clonedNetwork = cloneNet(network);
+    StatusCode s = clonedNetwork->getStats(&pstats, nullptr);
 
     IE_SUPPRESS_DEPRECATED_START
-    if (Precision::FP16 == network.getPrecision()) {
-        _clonedNetwork->setPrecision(Precision::FP32);
+    if (Precision::FP16 == clonedNetwork->getPrecision()) {
+        clonedNetwork->setPrecision(Precision::FP32);
     }
     IE_SUPPRESS_DEPRECATED_END
 
     // CPU Plugin doesn't natively support some precision like int64/fp16/bool
     // so will convert all layer/tensors fp16->fp32 , bool->u8.
     // Default int64->int32 conversion is already applied in IE common module.
-    NetPass::ConvertPrecision(*_clonedNetwork, Precision::I64, Precision::I32);
-    NetPass::ConvertPrecision(*_clonedNetwork, Precision::U64, Precision::I32);
-    NetPass::ConvertPrecision(*_clonedNetwork, Precision::FP16, Precision::FP32);
-    NetPass::ConvertPrecision(*_clonedNetwork, Precision::BOOL, Precision::U8);
+    NetPass::ConvertPrecision(*clonedNetwork, Precision::I64, Precision::I32);
+    NetPass::ConvertPrecision(*clonedNetwork, Precision::U64, Precision::I32);
+    NetPass::ConvertPrecision(*clonedNetwork, Precision::FP16, Precision::FP32);
+    NetPass::ConvertPrecision(*clonedNetwork, Precision::BOOL, Precision::U8);
 
     if (s == StatusCode::OK && pstats && !pstats->isEmpty()) {
         CNNNetworkInt8Normalizer cnnorm;
-        cnnorm.NormalizeNetwork(*_clonedNetwork, *pstats);
+        cnnorm.NormalizeNetwork(*clonedNetwork, *pstats);
     } else {
         if (_cfg.lpTransformsMode == Config::LPTransformsMode::On) {
             auto params = LayerTransformation::Params(true,  // updatePrecisions
@@ -80,41 +74,58 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
                                                       true);  // supportAsymmetricQuantization
             LowPrecisionTransformer transformer(LowPrecisionTransformer::getAllTransformations(params).
                 add<ConvolutionTransformation>(LayerTransformation::Params(params).setPrecisionsOnActivations({ Precision::U8 }), "Convolution").
+                add<GemmTransformation>(params, "Gemm").
                 addCleanup<ScaleShiftToConvolutionTransformation>(
                     LayerTransformation::Params(params).setPrecisionsOnActivations({ Precision::U8 }),
                     "ScaleShift"));
-            transformer.transform(*_clonedNetwork);
-
-            // Check if network is INT8 or Binary.
-            // BF16 transformations were disabled since CPU plug-in doesn't support mixed precision execution:
-            // BF16 + INT8 or BF16 + BIN.
-            bool isFloatModel = true;
-            CNNNetworkIterator i(&network);
-            while (i != CNNNetworkIterator()) {
-                if (CaselessEq<std::string>()((*i)->type, "FakeQuantize")) {
-                    isFloatModel = false;
-                    break;
-                }
-                i++;
-            }
+            transformer.transform(*clonedNetwork);
 
-            if (with_cpu_x86_bfloat16() && isFloatModel) {
+            // Quantized regions keep U8/I8 tensors after the low precision transformations, BF16 transformer
+            // marks only the remaining FP32 tensors, so INT8 and BF16 parts of the network are executed together
+            if (with_cpu_x86_bfloat16()) {
                 BF16Transformer bf16Transformer;
-                CNNNetwork cnnetwork(_clonedNetwork);
-                if (cfg.enforceBF16 == true) {
+                CNNNetwork cnnetwork(clonedNetwork);
+                if (_cfg.enforceBF16 == true) {
                     bf16Transformer.convertToBFloat16(cnnetwork);
                 } else {
                     bf16Transformer.optimizeToFloat(cnnetwork);
                 }
             } else {
                 BF16Transformer bf16Transformer;
-                CNNNetwork cnnetwork(_clonedNetwork);
+                CNNNetwork cnnetwork(clonedNetwork);
                 bf16Transformer.convertToFloat(cnnetwork);
             }
         }
     }
 
-    MKLDNNGraph::ApplyUnrollPasses(static_cast<ICNNNetwork&>(*_clonedNetwork));
+    // FP32 FullyConnected layers which are left after the precision transformations get compressed weights
+    if (_cfg.weightsCompression != Config::WeightsCompression::NoCompression) {
+        WeightsCompressor compressor(_cfg.weightsCompression == Config::WeightsCompression::Int8 ? 8 : 4);
+        CNNNetwork cnnetwork(clonedNetwork);
+        compressor.compress(cnnetwork);
+    }
+
+    MKLDNNGraph::ApplyUnrollPasses(static_cast<ICNNNetwork&>(*clonedNetwork));
+
+    return clonedNetwork;
+}
+
+MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network,
+                                     const Config &cfg,
+                                     const MKLDNNExtensionManager::Ptr& extMgr,
+                                     NumaNodesWeights &numaNodesWeights) :
+    MKLDNNExecNetwork(cloneNet(network), cfg, extMgr, numaNodesWeights) {}
+
+MKLDNNExecNetwork::MKLDNNExecNetwork(const CNNNetworkImplPtr &network,
+                                     const Config &cfg,
+                                     const MKLDNNExtensionManager::Ptr& extMgr,
+                                     NumaNodesWeights &numaNodesWeights) :
+    InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
+    extensionManager(extMgr),
+    _cfg{cfg},
+    _name{network->getName()},
+    _numaNodesWeights(numaNodesWeights) {
+    _clonedNetwork = PrepareNetwork(network);
 
     if (_cfg.batchLimit > 1) {
         // check topology for applicability
@@ -123,6 +134,9 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
         }
     }
 
+    // The padded part of the batch is skipped by the graphs of the networks supporting dynamic batch only
+    _padBatch = _cfg.shapeCacheSize > 0 && _cfg.shapeBucket > 1 && CanProcessDynBatch(*_clonedNetwork);
+
     if (cfg.exclusiveAsyncRequests) {
         // special case when all InferRequests are muxed into a single queue
         _taskExecutor = ExecutorManager::getInstance()->getExecutor("CPU");
@@ -147,44 +161,98 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
         _callbackExecutor = _taskExecutor;
     }
 
-    _graphs = decltype(_graphs){[&] {
-        // TODO: Remove `cloneNet` to `localNetwork` when `MKLDNNGraph::CreateGraph`
-        //       is fixed and does not change content of network passed (CVS-26420)
-        auto localNetwork = cloneNet(static_cast<ICNNNetwork&>(*_clonedNetwork));
-        auto graph = std::make_shared<MKLDNNGraph>();
-        {
-            std::unique_lock<std::mutex> lock{_cfgMutex};
-            graph->setConfig(_cfg);
-        }
-        int numaNode = 0;
-        auto* streamExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
-        if (nullptr != streamExecutor) {
-            numaNode = streamExecutor->GetNumaNodeId();
-        }
-        graph->CreateGraph(static_cast<ICNNNetwork&>(*localNetwork), extensionManager, numaNodesWeights[numaNode]);
-        return graph;
+    _graphs = decltype(_graphs){[this] {
+        return CreateGraph(*_clonedNetwork);
     }};
 
     _taskExecutor->runAndWait({std::thread::hardware_concurrency(), [this] {_graphs.local();}});
 
-    // Save all MemoryLayer data tensors. Will use insight about mechanics
-    // of MemoryLayer implementation. It uses output edge of MemoryLayer
-    // producer as storage for tensor to keep it between infer calls.
-    if (_graphs.size() == 1) {
-        for (auto &node : _graphs.begin()->get()->GetNodes()) {
-            if (node->getType() == MemoryInput) {
-                auto state_store = node->getChildEdgeAt(0)->getMemoryPtr();
-                auto state_name = node->getName();
-
-                // Remove suffix with pair ID. Internal information.
-                auto suffix_idx = state_name.find("/id=");
-                if (suffix_idx != std::string::npos)
-                    state_name = state_name.substr(0, suffix_idx);
-
-                memoryStates.emplace_back(new MKLDNNMemoryState(state_name, state_store));
-            }
+    // Recurrent states of MemoryLayer pairs are owned by infer requests and bound into
+    // the graph of the stream that executes the request. The storages below keep the initial
+    // values of the request states, the states of the executable network control all of them.
+    auto graph = _graphs.begin()->get();
+    for (auto &state : graph->GetStateDescs()) {
+        auto state_store = std::make_shared<MKLDNNMemory>(graph->getEngine());
+        state_store->Create(state.second);
+        state_store->FillZero();
+
+        stateStorages.emplace(state.first, state_store);
+    }
+}
+
+MKLDNNGraph::Ptr MKLDNNExecNetwork::CreateGraph(const ICNNNetwork &network) {
+    // TODO: Remove `cloneNet` to `localNetwork` when `MKLDNNGraph::CreateGraph`
+    //       is fixed and does not change content of network passed (CVS-26420)
+    auto localNetwork = cloneNet(network);
+    auto graph = std::make_shared<MKLDNNGraph>();
+    {
+        std::unique_lock<std::mutex> lock{_cfgMutex};
+        graph->setConfig(_cfg);
+    }
+    int numaNode = 0;
+    auto* streamExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
+    if (nullptr != streamExecutor) {
+        numaNode = streamExecutor->GetNumaNodeId();
+    }
+    graph->CreateGraph(static_cast<ICNNNetwork&>(*localNetwork), extensionManager, _numaNodesWeights[numaNode]);
+    return graph;
+}
+
+void MKLDNNExecNetwork::setReshapeCallback(const ReshapeCallback &reshape) {
+    _reshapeCallback = reshape;
+}
+
+std::shared_ptr<MKLDNNExecNetwork::ShapeVariant>
+MKLDNNExecNetwork::GetShapeVariant(const ICNNNetwork::InputShapes &shapes) {
+    if (!_reshapeCallback)
+        THROW_IE_EXCEPTION << "Input shapes differ from the network ones, while "
+                           << PluginConfigParams::KEY_CPU_SHAPE_CACHE_SIZE << " is not set";
+
+    std::string signature;
+    for (auto &shape : shapes) {
+        signature += shape.first + ":";
+        for (auto dim : shape.second)
+            signature += std::to_string(dim) + ",";
+        signature += ";";
+    }
+    auto findVariant = [&] {
+        auto found = std::find_if(_shapeVariants.begin(), _shapeVariants.end(),
+                                  [&](const std::pair<std::string, std::shared_ptr<ShapeVariant>> &variant) {
+                                      return variant.first == signature;
+                                  });
+        if (found == _shapeVariants.end())
+            return std::shared_ptr<ShapeVariant>{};
+        // the list is kept in the least recently used order
+        _shapeVariants.splice(_shapeVariants.begin(), _shapeVariants, found);
+        return found->second;
+    };
+
+    std::shared_ptr<ShapeVariant> variant;
+    {
+        std::lock_guard<std::mutex> lock{_shapeVariantsMutex};
+        variant = findVariant();
+        if (!variant) {
+            variant = std::make_shared<ShapeVariant>();
+            _shapeVariants.emplace_front(signature, variant);
+            if (_shapeVariants.size() > static_cast<size_t>(_cfg.shapeCacheSize))
+                _shapeVariants.pop_back();
         }
     }
+
+    // Network is prepared without the lock, so the requests of other shapes are not blocked, while the
+    // requests of the same shape wait for it. Graphs are created on first use in the stream, weights are
+    // shared with the other variants through the weights cache.
+    std::call_once(variant->prepared, [&] {
+        // the reshaped network is created for this variant only, so it's transformed without cloning
+        auto reshapedNetwork = _reshapeCallback(shapes);
+        auto reshapedNetworkImpl = std::dynamic_pointer_cast<details::CNNNetworkImpl>(reshapedNetwork);
+        variant->network = PrepareNetwork(reshapedNetworkImpl ? reshapedNetworkImpl : cloneNet(*reshapedNetwork));
+        auto network = variant->network;
+        variant->graphs = decltype(variant->graphs){[this, network] {
+            return CreateGraph(*network);
+        }};
+    });
+    return variant;
 }
 
 void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &properties) {
@@ -259,6 +327,46 @@ void MKLDNNExecNetwork::GetMetric(const std::string &name, Parameter &result, Re
     }
 }
 
+namespace {
+
+// All configurations of the extension implementations have to support the dynamic batch
+bool extensionSupportsDynBatch(const MKLDNNExtensionManager::Ptr &extMgr, const CNNLayerPtr &layer) {
+    if (!extMgr)
+        return false;
+
+    std::vector<ILayerImpl::Ptr> impls;
+    if (layer->getNode()) {
+        if (auto impl = extMgr->CreateImplementation(layer->getNode()))
+            impls.push_back(impl);
+    }
+    ResponseDesc resp;
+    if (impls.empty()) {
+        IE_SUPPRESS_DEPRECATED_START
+        auto factory = extMgr->CreateExtensionFactory(layer);
+        if (!factory || factory->getImplementations(impls, &resp) != OK)
+            return false;
+        IE_SUPPRESS_DEPRECATED_END
+    }
+
+    bool supported = false;
+    for (const auto &impl : impls) {
+        auto execImpl = std::dynamic_pointer_cast<ILayerExecImpl>(impl);
+        if (!execImpl)
+            continue;
+        std::vector<LayerConfig> configs;
+        if (execImpl->getSupportedConfigurations(configs, &resp) != OK)
+            return false;
+        for (const auto &config : configs) {
+            if (!config.dynBatchSupport)
+                return false;
+            supported = true;
+        }
+    }
+    return supported;
+}
+
+}  // namespace
+
 bool MKLDNNExecNetwork::CanProcessDynBatch(const InferenceEngine::ICNNNetwork &network) const {
     InputsDataMap inputs;
     network.getInputsInfo(inputs);
@@ -289,6 +397,26 @@ bool MKLDNNExecNetwork::CanProcessDynBatch(const InferenceEngine::ICNNNetwork &n
             return;
         }
 
+        // Extension layers process the limited batch through their shape inference, that is valid only
+        // when the implementation declares it and the batch goes through the layer unchanged
+        if (type == Unknown) {
+            if (!extensionSupportsDynBatch(extensionManager, layer) ||
+                layer->insData.empty() || layer->insData[0].lock()->getTensorDesc().getDims().empty()) {
+                check_result = false;
+                return;
+            }
+            const size_t batch = layer->insData[0].lock()->getTensorDesc().getDims()[0];
+            auto keepsBatch = [batch](const DataPtr& data) {
+                const auto& dims = data->getTensorDesc().getDims();
+                return !dims.empty() && dims[0] == batch;
+            };
+            for (const auto& inData : layer->insData)
+                check_result = check_result && keepsBatch(inData.lock());
+            for (const auto& outData : layer->outData)
+                check_result = check_result && keepsBatch(outData);
+            return;
+        }
+
         if (type != Input &&
             type != Output &&
             type != Convolution &&
@@ -306,6 +434,7 @@ bool MKLDNNExecNetwork::CanProcessDynBatch(const InferenceEngine::ICNNNetwork &n
             type != Eltwise &&
             type != Crop &&
             type != BatchNormalization &&
+            type != Quantize &&
             type != Copy) {
             check_result = false;
         }
@@ -315,5 +444,24 @@ bool MKLDNNExecNetwork::CanProcessDynBatch(const InferenceEngine::ICNNNetwork &n
 }
 
 std::vector<IMemoryStateInternal::Ptr> MKLDNNExecNetwork::QueryState() {
+    std::lock_guard<std::mutex> lock{_requestStatesMutex};
+    // The states refer to the network weakly, so they are created once it is owned by a shared pointer
+    if (memoryStates.empty()) {
+        auto network = std::static_pointer_cast<MKLDNNExecNetwork>(shared_from_this());
+        for (auto &state : stateStorages)
+            memoryStates.emplace_back(new MKLDNNNetworkMemoryState(state.first, network));
+    }
     return memoryStates;
 }
+
+std::vector<MKLDNNMemoryPtr> MKLDNNExecNetwork::GetStateStorages(const std::string &name) {
+    std::vector<MKLDNNMemoryPtr> storages;
+    std::lock_guard<std::mutex> lock{_requestStatesMutex};
+    auto initial = stateStorages.find(name);
+    if (initial == stateStorages.end())
+        return storages;
+    storages.push_back(initial->second);
+    for (auto &requestStates : _requestStates)
+        storages.push_back(requestStates.at(name));
+    return storages;
+}
@@ -16,6 +16,10 @@
 #include <string>
 #include <cnn_network_impl.hpp>
 #include <unordered_map>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <utility>
 
 namespace MKLDNNPlugin {
 
@@ -32,6 +36,13 @@ public:
     MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network, const Config &cfg,
                       const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing);
 
+    /**
+     * @brief Creates executable network from the network which is owned by the plugin.
+     * The network is transformed in place instead of being cloned.
+     */
+    MKLDNNExecNetwork(const InferenceEngine::details::CNNNetworkImplPtr &network, const Config &cfg,
+                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing);
+
     ~MKLDNNExecNetwork() override = default;
 
     void setProperty(const std::map<std::string, std::string> &properties);
@@ -42,20 +53,65 @@ public:
 
     void GetExecGraphInfo(InferenceEngine::ICNNNetwork::Ptr &graphPtr) override;
 
+    /**
+     * @brief Returns the states of the network. Every infer request owns its states, Reset() and SetState()
+     * of a network state apply to this state of all the requests and set the initial value for requests
+     * created later, GetLastState() returns the state of the earliest created request alive.
+     */
     std::vector<InferenceEngine::IMemoryStateInternal::Ptr> QueryState() override;
 
+    /**
+     * @brief Returns the storages of the state: the initial value for new requests followed by
+     * the storages of the alive requests in the order of creation
+     */
+    std::vector<MKLDNNMemoryPtr> GetStateStorages(const std::string &name);
+
+    using ReshapeCallback = std::function<std::shared_ptr<InferenceEngine::ICNNNetwork>(
+                                const InferenceEngine::ICNNNetwork::InputShapes&)>;
+
+    /**
+     * @brief Sets a function returning the original network reshaped to the given input shapes
+     * and converted for the plugin. Enables compilation of shape variants.
+     */
+    void setReshapeCallback(const ReshapeCallback &reshape);
+
+    /**
+     * @brief Graphs compiled for particular input shapes, one per stream
+     */
+    struct ShapeVariant {
+        std::once_flag                                  prepared;
+        InferenceEngine::details::CNNNetworkImplPtr     network;
+        InferenceEngine::ThreadLocal<MKLDNNGraph::Ptr>  graphs;
+    };
+
+    /**
+     * @brief Returns the variant compiled for the given input shapes. Variants are compiled once on first use
+     * and at most Config::shapeCacheSize least recently used ones are kept.
+     */
+    std::shared_ptr<ShapeVariant> GetShapeVariant(const InferenceEngine::ICNNNetwork::InputShapes &shapes);
+
     InferenceEngine::ThreadLocal<MKLDNNGraph::Ptr>  _graphs;
 
 protected:
     friend class MKLDNNInferRequest;
     MKLDNNExtensionManager::Ptr extensionManager;
     std::vector<InferenceEngine::IMemoryStateInternal::Ptr> memoryStates;
+    std::map<std::string, MKLDNNMemoryPtr>      stateStorages;
+    std::mutex                                  _requestStatesMutex;
+    std::list<std::map<std::string, MKLDNNMemoryPtr>> _requestStates;
     InferenceEngine::details::CNNNetworkImplPtr _clonedNetwork;
     std::mutex                                  _cfgMutex;
     Config                                      _cfg;
     std::atomic_int                             _numRequests = {0};
     std::string                                 _name;
-
+    NumaNodesWeights&                           _numaNodesWeights;
+    ReshapeCallback                             _reshapeCallback;
+    std::mutex                                  _shapeVariantsMutex;
+    std::list<std::pair<std::string, std::shared_ptr<ShapeVariant>>> _shapeVariants;
+    bool                                        _padBatch = false;
+
+    InferenceEngine::details::CNNNetworkImplPtr PrepareNetwork(const InferenceEngine::details::CNNNetworkImplPtr &network) const;
+    MKLDNNGraph::Ptr CreateGraph(const InferenceEngine::ICNNNetwork &network);
 
     bool CanProcessDynBatch(const InferenceEngine::ICNNNetwork &network) const;
 };
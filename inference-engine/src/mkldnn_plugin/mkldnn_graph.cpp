@@ -21,6 +21,8 @@
 #include "mkldnn_memory_solver.hpp"
 #include <nodes/mkldnn_input_node.h>
 #include <nodes/mkldnn_reorder_node.h>
+#include <nodes/mkldnn_concat_node.h>
+#include <nodes/mkldnn_split_node.h>
 
 #include <graph_tools.hpp>
 #include <ie_algorithm.hpp>
@@ -91,7 +93,7 @@ void MKLDNNGraph::CreateGraph(const NET &net, const MKLDNNExtensionManager::Ptr&
     if (IsReady())
         ForgetGraphData();
     // disable caching if graph was created only once
-    weightsCache = config.streamExecutorConfig._streams != 1 ? w_cache : nullptr;
+    weightsCache = config.streamExecutorConfig._streams != 1 || config.shapeCacheSize > 0 ? w_cache : nullptr;
 
     Replicate(net, extMgr);
     InitGraph();
@@ -359,6 +361,8 @@ void MKLDNNGraph::InitGraph() {
 
     CreatePrimitives();
 
+    InitStates();
+
     // Do it before cleanup. Because it will lose original layers information
     for (auto &graphNode : graphNodes) {
         auto nodeType = graphNode->getType();
@@ -703,6 +707,101 @@ void MKLDNNGraph::CreatePrimitives() { IE_PROFILING_AUTO_SCOPE(MKLDNNGraph::Crea
     }
 }
 
+void MKLDNNGraph::InitStates() {
+    for (auto &node : graphNodes) {
+        if (node->getType() != MemoryInput)
+            continue;
+
+        // Remove suffix with pair ID. Internal information.
+        auto state_name = node->getName();
+        auto suffix_idx = state_name.find("/id=");
+        if (suffix_idx != std::string::npos)
+            state_name = state_name.substr(0, suffix_idx);
+
+        // The state may be rebound to an external storage only if all its consumers read it by the memory
+        // handle, i.e. none of them is in-place or keeps raw pointers to it
+        bool canBeRebound = true;
+        void *state_ptr = node->getChildEdgeAt(0)->getMemory().GetData();
+        for (size_t i = 0; canBeRebound && i < node->getChildEdges().size(); i++) {
+            auto edge = node->getChildEdgeAt(i);
+            auto child = edge->getChild();
+            if (edge->getMemory().GetData() != state_ptr || child->isConstant() || child->isInplace())
+                canBeRebound = false;
+#if defined(COMPILED_CPU_MKLDNN_CONCAT_NODE)
+            auto* concat = dynamic_cast<MKLDNNConcatNode *>(child.get());
+            if (canBeRebound && concat && concat->isOptimized())
+                canBeRebound = false;
+#endif
+            // Split is using different ptrs without offsets
+#if defined(COMPILED_CPU_MKLDNN_SPLIT_NODE)
+            if (canBeRebound && dynamic_cast<MKLDNNSplitNode *>(child.get()))
+                canBeRebound = false;
+#endif
+            for (size_t j = 0; canBeRebound && j < child->getChildEdges().size(); j++) {
+                if (child->getChildEdgeAt(j)->getMemory().GetData() == state_ptr)
+                    canBeRebound = false;
+            }
+        }
+
+        stateNodes[state_name] = {node, canBeRebound};
+    }
+}
+
+std::map<std::string, MKLDNNMemoryDesc> MKLDNNGraph::GetStateDescs() const {
+    std::map<std::string, MKLDNNMemoryDesc> descs;
+    for (auto &state : stateNodes) {
+        descs.emplace(state.first, MKLDNNMemoryDesc(state.second.first->getChildEdgeAt(0)->getMemory().GetDescriptor()));
+    }
+    return descs;
+}
+
+void MKLDNNGraph::PushStates(const std::map<std::string, MKLDNNMemoryPtr> &states) {
+    if (!IsReady())
+        THROW_IE_EXCEPTION << "Wrong state. Topology not ready.";
+
+    for (auto &state : states) {
+        auto state_node = stateNodes.find(state.first);
+        if (state_node == stateNodes.end())
+            THROW_IE_EXCEPTION << "Cannot find memory state: " << state.first;
+
+        auto &node = state_node->second.first;
+        const MKLDNNMemory &intr_mem = node->getChildEdgeAt(0)->getMemory();
+        if (intr_mem.GetSize() != state.second->GetSize())
+            THROW_IE_EXCEPTION << "Memory state size is not equal network state size ("
+                               << state.second->GetSize() << "!=" << intr_mem.GetSize() << ").";
+
+        void *ext_ptr = state.second->GetData();
+        if (intr_mem.GetData() == ext_ptr)
+            continue;
+
+        if (state_node->second.second) {
+            for (size_t i = 0; i < node->getChildEdges().size(); i++)
+                node->getChildEdgeAt(i)->getMemory().GetPrimitivePtr()->set_data_handle(ext_ptr);
+        } else {
+            ie_memcpy(intr_mem.GetData(), intr_mem.GetSize(), ext_ptr, state.second->GetSize());
+        }
+    }
+}
+
+void MKLDNNGraph::PullStates(const std::map<std::string, MKLDNNMemoryPtr> &states) {
+    if (!IsReady())
+        THROW_IE_EXCEPTION << "Wrong state. Topology not ready.";
+
+    for (auto &state : states) {
+        auto state_node = stateNodes.find(state.first);
+        if (state_node == stateNodes.end())
+            THROW_IE_EXCEPTION << "Cannot find memory state: " << state.first;
+
+        // Rebound states are already updated in place
+        const MKLDNNMemory &intr_mem = state_node->second.first->getChildEdgeAt(0)->getMemory();
+        void *ext_ptr = state.second->GetData();
+        if (intr_mem.GetData() == ext_ptr)
+            continue;
+
+        ie_memcpy(ext_ptr, state.second->GetSize(), intr_mem.GetData(), intr_mem.GetSize());
+    }
+}
+
 void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in) {
     if (!IsReady()) THROW_IE_EXCEPTION<< "Wrong state. Topology not ready.";
 
@@ -718,9 +817,14 @@ void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::
             if (l == CHW && input->second->getChildEdgeAt(0)->getDims().ndims() == 4)
                 l = NCHW;
 
+            // Only the processed part of the batch is copied when the dynamic batch is set
+            size_t size_to_copy = in->byteSize();
+            if (outDims.ndims() > 0 && outDims[0] > 0)
+                size_to_copy = size_to_copy / outDims[0] * input->second->batchToProcess();
+
             input->second->getChildEdgeAt(0)->getMemory().SetData(
                     MKLDNNExtensionUtils::IEPrecisionToDataType(in->getTensorDesc().getPrecision()),
-                    MKLDNNMemory::Convert(l), ext_data_ptr, in->byteSize(), false);
+                    MKLDNNMemory::Convert(l), ext_data_ptr, size_to_copy, false);
         }
 
         // todo: make sure 'name' exists in this map...
@@ -760,7 +864,11 @@ void MKLDNNGraph::PullOutputData(BlobMap &out) {
             ext_blob->allocate();
         }
 
-        if (ext_blob->byteSize() != intr_blob.GetSize())
+        int MB = intr_blob.GetDims()[0];
+        size_t size_to_copy = intr_blob.GetSize() * node->batchToProcess() / MB;
+
+        // The blob may hold the processed part of the batch only
+        if (ext_blob->byteSize() != intr_blob.GetSize() && ext_blob->byteSize() != size_to_copy)
             THROW_IE_EXCEPTION << "Output blob size is not equal network output size ("
                                << ext_blob->size() << "!=" << intr_blob.GetSize()/sizeof(float) << ").";
 
@@ -770,29 +878,34 @@ void MKLDNNGraph::PullOutputData(BlobMap &out) {
         // That is the same memory. No need to copy
         if (ext_blob_ptr == intr_blob_ptr) continue;
 
-        int MB = intr_blob.GetDims()[0];
-        int MB_to_process = node->batchToProcess();
-        // TODO: Should we support InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT???
-        if (config.batchLimit)
-            MB_to_process = std::min<int>(config.batchLimit, MB_to_process);
-        size_t size_to_copy = intr_blob.GetSize() * MB_to_process / MB;
-
         ie_memcpy(ext_blob_ptr, ext_blob->byteSize(), intr_blob_ptr, size_to_copy);
     }
 }
 
+void MKLDNNGraph::SetDynamicBatch(int batch) {
+    // The requests of a stream share the graph, so the whole batch has to reset the limit left by another request
+    if (batch <= 0 || (!inputNodes.empty() && batch >= inputNodes.begin()->second->getMaxBatch()))
+        batch = 0;
+    if (batch == dynBatch)
+        return;
+
+    for (auto &node : graphNodes) {
+        node->setDynamicBatchLim(batch);
+    }
+    dynBatch = batch;
+}
+
 void MKLDNNGraph::Infer(int batch) {
     if (!IsReady()) {
         THROW_IE_EXCEPTION << "Wrong state. Topology is not ready.";
     }
 
+    SetDynamicBatch(batch);
+
     mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
     for (int i = 0; i < graphNodes.size(); i++) {
         PERF(graphNodes[i]);
 
-        if (batch > 0)
-            graphNodes[i]->setDynamicBatchLim(batch);
-
         ENABLE_DUMP(do_before(DUMP_DIR, graphNodes[i]));
 
         if (!graphNodes[i]->isConstant()) {
@@ -58,6 +58,26 @@ public:
     void PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in);
     void PullOutputData(InferenceEngine::BlobMap &out);
 
+    /**
+     * @brief Returns descriptors of the recurrent states kept by MemoryInput nodes between Infer() calls, keyed by
+     * the state name.
+     */
+    std::map<std::string, MKLDNNMemoryDesc> GetStateDescs() const;
+
+    /**
+     * @brief Makes the next Infer() call read and update the given storages of the recurrent states.
+     * A storage is bound to the state edges in place when no consumer keeps its own pointer to the state memory,
+     * otherwise it is copied in here and back in PullStates().
+     */
+    void PushStates(const std::map<std::string, MKLDNNMemoryPtr> &states);
+    void PullStates(const std::map<std::string, MKLDNNMemoryPtr> &states);
+
+    /**
+     * @brief Limits the batch processed by the nodes, a non-positive value or the full batch processes the whole batch.
+     * The limit is propagated to the nodes only when it changes, so repeated calls with the same batch are free.
+     */
+    void SetDynamicBatch(int batch);
+
     void Infer(int batch = -1);
 
     std::vector<MKLDNNNodePtr>& GetNodes() {
@@ -98,9 +118,11 @@ protected:
     void ForgetGraphData() {
         status = NotReady;
         eng = mkldnn::engine(mkldnn::engine::kind::cpu, 0);
+        dynBatch = 0;
 
         inputNodes.clear();
         outputNodes.clear();
+        stateNodes.clear();
         graphNodes.clear();
         graphEdges.clear();
         _meanImages.clear();
@@ -114,10 +136,15 @@ protected:
 
     bool reuse_io_tensors = true;
 
+    // Batch limit currently set on the nodes, 0 means the whole batch
+    int dynBatch = 0;
+
     MKLDNNMemoryPtr memWorkspace;
 
     std::map<std::string, MKLDNNNodePtr> inputNodes;
     std::vector<MKLDNNNodePtr> outputNodes;
+    // MemoryInput nodes keyed by the state name, the flag tells whether the state memory may be rebound in place
+    std::map<std::string, std::pair<MKLDNNNodePtr, bool>> stateNodes;
     std::vector<MKLDNNNodePtr> graphNodes;
     std::vector<MKLDNNEdgePtr> graphEdges;
 
@@ -135,6 +162,7 @@ protected:
     void Allocate();
     void AllocateWithReuse();
     void CreatePrimitives();
+    void InitStates();
 
     void do_before(const std::string &dir, const MKLDNNNodePtr &node);
     void do_after(const std::string &dir, const MKLDNNNodePtr &node);
@@ -13,10 +13,13 @@
 #include "nodes/mkldnn_concat_node.h"
 #include "nodes/mkldnn_reorder_node.h"
 #include "nodes/mkldnn_conv_node.h"
+#include "nodes/mkldnn_gemm_node.h"
+#include "nodes/mkldnn_fullyconnected_node.h"
 #include "nodes/mkldnn_bin_conv_node.h"
 #include "nodes/mkldnn_quantize_node.h"
 #include "nodes/mkldnn_mvn_node.h"
 #include "nodes/mkldnn_resample_node.h"
+#include "nodes/mkldnn_reduce_node.h"
 
 #include <blob_factory.hpp>
 #include <ie_layers_internal.hpp>
@@ -126,6 +129,11 @@ void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
     FuseFullyConnectedAndSimpleOperation(graph);
     graph.RemoveDroppedNodes();
 
+#if defined (COMPILED_CPU_MKLDNN_DEPTHWISE_NODE)
+    FuseGemmAndScaleShift(graph);
+    graph.RemoveDroppedNodes();
+#endif
+
     FuseMVNAndSimpleOperation(graph);
     graph.RemoveDroppedNodes();
 
@@ -135,6 +143,9 @@ void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
     FuseNormalizeAndSimpleOperation(graph);
     graph.RemoveDroppedNodes();
 
+    FuseReduceAndSimpleOperation(graph);
+    graph.RemoveDroppedNodes();
+
     FuseEltwiseAndSimple(graph);
     graph.RemoveDroppedNodes();
 
@@ -776,8 +787,13 @@ void MKLDNNGraphOptimizer::FuseFullyConnectedAndSimpleOperation(MKLDNNGraph &gra
     auto& graphNodes = graph.GetNodes();
 
     auto isSutableParentNode = [](MKLDNNNodePtr node) {
-        return node->getType() == FullyConnected &&
-               node->getChildEdges().size() == 1;
+        if (node->getType() != FullyConnected || node->getChildEdges().size() != 1)
+            return false;
+
+        auto* fcNode = dynamic_cast<MKLDNNFullyConnectedNode *>(node.get());
+        if (fcNode == nullptr)
+            THROW_IE_EXCEPTION << "Cannot get fully connected node " << node->getName();
+        return !fcNode->isWeightsCompressed();
     };
 
     auto isSutableChildNode = [&](MKLDNNNodePtr node) {
@@ -886,6 +902,52 @@ void MKLDNNGraphOptimizer::FuseConvolutionAndDepthwise(MKLDNNGraph &graph) {
         graph.DropNode(depthwise0);
     }
 }
+
+void MKLDNNGraphOptimizer::FuseGemmAndScaleShift(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSutableParentNode = [](MKLDNNNodePtr node) {
+        if (node->getType() != Gemm || node->getChildEdges().size() != 1)
+            return false;
+
+        auto* gemmNode = dynamic_cast<MKLDNNGemmNode *>(node.get());
+        if (gemmNode == nullptr)
+            THROW_IE_EXCEPTION << "Cannot get gemm node " << node->getName();
+        return gemmNode->canBeExecutedInInt8();
+    };
+
+    auto isSutableChildNode = [](MKLDNNNodePtr parentNode, MKLDNNNodePtr node) {
+        if (node->getType() != Depthwise || !node->getCnnLayer() || node->getCnnLayer()->type != "ScaleShift")
+            return false;
+
+        auto* depthwiseNode = dynamic_cast<MKLDNNDepthwiseNode *>(node.get());
+        if (depthwiseNode == nullptr)
+            THROW_IE_EXCEPTION << "Cannot get depthwise node " << node->getName();
+        if (depthwiseNode->getAlgorithm() != mkldnn::algorithm::depthwise_scale_shift)
+            return false;
+
+        // scales are applied per output channel or per tensor
+        auto* scaleShiftLayer = dynamic_cast<ScaleShiftLayer *>(node->getCnnLayer().get());
+        if (scaleShiftLayer == nullptr || scaleShiftLayer->_weights == nullptr)
+            return false;
+        const size_t channels = parentNode->getChildEdgeAt(0)->getDims()[1];
+        auto isPerChannel = [&](const Blob::Ptr& blob) {
+            return blob == nullptr || blob->size() == 1 || blob->size() == channels;
+        };
+        return isPerChannel(scaleShiftLayer->_weights) && isPerChannel(scaleShiftLayer->_biases);
+    };
+
+    for (int i = 0; i < graphNodes.size(); i++) {
+        auto gemm = graphNodes[i];
+        if (!isSutableParentNode(gemm)) continue;
+
+        auto scaleShift = gemm->getChildEdgeAt(0)->getChild();
+        if (!isSutableChildNode(gemm, scaleShift)) continue;
+
+        gemm->fuseWith(scaleShift);
+        graph.DropNode(scaleShift);
+    }
+}
 #endif
 
 void MKLDNNGraphOptimizer::FuseConvolutionAndDWConvolution(MKLDNNGraph &graph) {
@@ -1778,6 +1840,69 @@ void MKLDNNGraphOptimizer::FuseNormalizeAndSimpleOperation(MKLDNNGraph &graph) {
     }
 }
 
+void MKLDNNGraphOptimizer::FuseReduceAndSimpleOperation(MKLDNNGraph &graph) {
+    auto isOneOf = [&](mkldnn::algorithm alg, std::vector<mkldnn::algorithm> algs) {
+        for (auto a : algs) {
+            if (alg == a) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSuitableParentNode = [](MKLDNNNodePtr node) {
+        if (node->getType() != Reduce)
+            return false;
+
+        auto* reduceNode = dynamic_cast<MKLDNNReduceNode*>(node.get());
+        if (reduceNode == nullptr)
+            THROW_IE_EXCEPTION << "Cannot get reduce layer " << node->getName();
+        return reduceNode->canFuse();
+    };
+
+    auto isSuitableChildNode = [&](MKLDNNNodePtr node) {
+        if (!node->getCnnLayer())
+            return false;
+
+        if (node->getType() == Depthwise) {
+            auto* depthwiseNode = dynamic_cast<MKLDNNDepthwiseNode*>(node.get());
+            if (depthwiseNode == nullptr)
+                THROW_IE_EXCEPTION << "Cannot get depthwise layer " << node->getName();
+            return ((depthwiseNode->getAlgorithm() == mkldnn::algorithm::depthwise_scale_shift && depthwiseNode->isWithBiases()) ||
+                    (depthwiseNode->getAlgorithm() == mkldnn::algorithm::depthwise_prelu));
+        } else if (node->getType() == Activation) {
+            auto* activationNode = dynamic_cast<MKLDNNActivationNode*>(node.get());
+            if (activationNode == nullptr)
+                THROW_IE_EXCEPTION << "Cannot get activation layer " << node->getName();
+            return isOneOf(activationNode->getAlgorithm(), {eltwise_relu, eltwise_gelu, eltwise_elu, eltwise_logistic,
+                eltwise_bounded_relu, eltwise_clamp, eltwise_tanh, eltwise_swish, eltwise_linear, eltwise_abs,
+                eltwise_square, eltwise_sqrt});
+        }
+        return false;
+    };
+
+    auto parent = graphNodes.begin();
+    while (parent != graphNodes.end()) {
+        auto parentNode = *parent;
+        if (!isSuitableParentNode(parentNode)) {
+            parent++;
+            continue;
+        }
+
+        auto childNode = parentNode->getChildEdgeAt(0)->getChild();
+        if (!isSuitableChildNode(childNode)) {
+            parent++;
+            continue;
+        }
+
+        parentNode->fuseWith(childNode);
+
+        graph.DropNode(childNode);
+    }
+}
+
 void MKLDNNGraphOptimizer::FuseEltwiseAndSimple(MKLDNNGraph &graph) {
     auto isOneOf = [&](mkldnn::algorithm alg, std::vector<mkldnn::algorithm> algs) {
         for (auto a : algs) {
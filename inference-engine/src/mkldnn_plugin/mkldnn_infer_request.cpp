@@ -7,12 +7,15 @@
 #include <vector>
 #include <string>
 #include <map>
+#include <cstring>
+#include <ie_parallel.hpp>
 #include <blob_factory.hpp>
 #include <nodes/mkldnn_concat_node.h>
 #include <nodes/mkldnn_split_node.h>
 #include <ie_compound_blob.h>
 #include "inference_engine.hpp"
 #include "mkldnn_exec_network.h"
+#include "mkldnn_memory_state.h"
 
 MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsDataMap     networkInputs,
                                                      InferenceEngine::OutputsDataMap    networkOutputs,
@@ -34,10 +37,25 @@ MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsData
         InferenceEngine::Blob::Ptr blob;
         MKLDNNInferRequest::GetBlob(it.first.c_str(), blob);
     }
+
+    // Keep own copies of the recurrent states to run stateful networks on several streams at once,
+    // they start from the initial values kept by the executable network
+    std::lock_guard<std::mutex> lock{execNetwork->_requestStatesMutex};
+    for (auto &state : graph->GetStateDescs()) {
+        auto state_store = std::make_shared<MKLDNNMemory>(graph->getEngine());
+        state_store->Create(state.second);
+        state_store->SetData(*execNetwork->stateStorages.at(state.first), false);
+        stateStorages.emplace(state.first, state_store);
+        memoryStates.emplace_back(new MKLDNNMemoryState(state.first, state_store));
+    }
+    // The states of the executable network apply to the states of all its requests
+    requestStates = execNetwork->_requestStates.insert(execNetwork->_requestStates.end(), stateStorages);
 }
 
 MKLDNNPlugin::MKLDNNInferRequest::~MKLDNNInferRequest() {
     --(execNetwork->_numRequests);
+    std::lock_guard<std::mutex> lock{execNetwork->_requestStatesMutex};
+    execNetwork->_requestStates.erase(requestStates);
 }
 
 template <typename T>
@@ -83,8 +101,14 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
     {
         execDataPreprocessing(_inputs);
 
+        if (execNetwork->_cfg.shapeCacheSize > 0)
+            selectShapeVariant();
+
         changeDefaultPtr();
 
+        // The batch limit has to be set before the inputs are pushed, they copy only the processed batch
+        graph->SetDynamicBatch(variantBatch > 0 ? variantBatch : m_curBatch);
+
         // need to retain converted blobs until infer finish
         std::vector<InferenceEngine::Blob::Ptr> convertedInputs;
         for (auto input : _inputs) {
@@ -93,6 +117,9 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
                                     "input blobs map contains not registered during IInferencePlugin::LoadNetwork blob with name "
                                     << input.first;
             }
+            auto padded = paddedInputs.find(input.first);
+            if (padded != paddedInputs.end())
+                input.second = padded->second;
 
             InferenceEngine::Blob::Ptr iconv;
             InferenceEngine::TBlob<float> *in_f = nullptr;
@@ -162,7 +189,11 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
         }
     }
 
-    graph->Infer(m_curBatch);
+    graph->PushStates(stateStorages);
+
+    graph->Infer(variantBatch > 0 ? variantBatch : m_curBatch);
+
+    graph->PullStates(stateStorages);
 
     graph->PullOutputData(_outputs);
 }
@@ -192,7 +223,8 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
 
         if (_inputs.find(name) != _inputs.end()) {
             data = _inputs[name];
-            checkBlob(data, name, true);
+            if (execNetwork->_cfg.shapeCacheSize == 0)
+                checkBlob(data, name, true);
             return;
         }
 
@@ -209,7 +241,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
         _inputs[name] = make_blob_with_precision(desc);
         _inputs[name]->allocate();
         if (desc.getPrecision() == originPrecision &&
-                graph->_meanImages.find(name) == graph->_meanImages.end() && !graph->getProperty().batchLimit) {
+                graph->_meanImages.find(name) == graph->_meanImages.end()) {
             externalPtr[name] = _inputs[name]->buffer();
         }
         data = _inputs[name];
@@ -221,14 +253,14 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
     if (blobs.find(name) != blobs.end()) {
         if (_outputs.find(name) != _outputs.end()) {
             data = _outputs[name];
-            checkBlob(data, name, false);
+            if (execNetwork->_cfg.shapeCacheSize == 0)
+                checkBlob(data, name, false);
             return;
         }
 
         _outputs[name] = make_blob_with_precision(blobs[name]->getTensorDesc());
         _outputs[name]->allocate();
-        if (blobs[name]->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
-                !graph->getProperty().batchLimit) {
+        if (blobs[name]->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32) {
             externalPtr[name] = _outputs[name]->buffer();
         }
         data = _outputs[name];
@@ -277,20 +309,27 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const Inference
             // pre-processing
             _preProcData[name]->setRoiBlob(data);
         } else {
-            size_t inputSize = foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
-                ? InferenceEngine::details::product(foundInput->getTensorDesc().getDims())
-                : 1;
-            if (dataSize != inputSize) {
-                THROW_IE_EXCEPTION << "Input blob size is not equal network input size ("
-                                   << dataSize << "!=" << inputSize << ").";
-            }
+            // With shape variants only the rank has to match, the graph is selected by the blob dimensions
+            if (execNetwork->_cfg.shapeCacheSize > 0) {
+                if (foundInput->getTensorDesc().getDims().size() != data->getTensorDesc().getDims().size()) {
+                    THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set input Blob. Rank mismatch.";
+                }
+            } else {
+                size_t inputSize = foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
+                    ? InferenceEngine::details::product(foundInput->getTensorDesc().getDims())
+                    : 1;
+                if (dataSize != inputSize) {
+                    THROW_IE_EXCEPTION << "Input blob size is not equal network input size ("
+                                       << dataSize << "!=" << inputSize << ").";
+                }
 
-            if (foundInput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
-                THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set input Blob. Dimensions mismatch.";
+                if (foundInput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
+                    THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set input Blob. Dimensions mismatch.";
+                }
             }
 
             if (data->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
-                graph->_meanImages.find(name) == graph->_meanImages.end() && !graph->getProperty().batchLimit) {
+                graph->_meanImages.find(name) == graph->_meanImages.end()) {
                 externalPtr[name] = data->buffer();
             } else if (externalPtr.find(name) != externalPtr.end()) {
                 externalPtr.erase(name);
@@ -302,22 +341,24 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const Inference
             THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str
                                << "cannot set compound blob: supported only for input pre-processing";
         }
-        size_t outputSize = foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
-            ? InferenceEngine::details::product(foundOutput->getDims())
-            : 1;
-        if (dataSize != outputSize) {
-            THROW_IE_EXCEPTION << "Output blob size is not equal network output size ("
-                               << dataSize << "!=" << outputSize << ").";
-        }
-        if (foundOutput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
-            THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set output Blob. Dimensions mismatch.";
+        // With shape variants outputs not matching the selected graph are reallocated on inference
+        if (execNetwork->_cfg.shapeCacheSize == 0) {
+            size_t outputSize = foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
+                ? InferenceEngine::details::product(foundOutput->getDims())
+                : 1;
+            if (dataSize != outputSize) {
+                THROW_IE_EXCEPTION << "Output blob size is not equal network output size ("
+                                   << dataSize << "!=" << outputSize << ").";
+            }
+            if (foundOutput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
+                THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set output Blob. Dimensions mismatch.";
+            }
         }
         if (foundOutput->getPrecision() != data->getTensorDesc().getPrecision()) {
             THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str
                                << "Failed to set Blob with precision not corresponding to user output precision";
         }
-        if (data->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
-                !graph->getProperty().batchLimit) {
+        if (data->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32) {
             externalPtr[name] = data->buffer();
         } else if (externalPtr.find(name) != externalPtr.end()) {
             externalPtr.erase(name);
@@ -406,6 +447,173 @@ void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
 }
 
 
+namespace {
+
+// Copies the blob to the beginning of each dimension of the bigger zero filled one with the same layout
+void padBlob(const InferenceEngine::Blob::Ptr &src, const InferenceEngine::Blob::Ptr &dst) {
+    const auto &srcBlocking = src->getTensorDesc().getBlockingDesc();
+    const auto &srcDims = srcBlocking.getBlockDims();
+    const auto &srcStrides = srcBlocking.getStrides();
+    const auto &dstDims = dst->getTensorDesc().getBlockingDesc().getBlockDims();
+    const size_t elemSize = src->element_size();
+
+    auto srcPtr = src->cbuffer().as<const uint8_t *>() + srcBlocking.getOffsetPadding() * elemSize;
+    auto dstPtr = dst->buffer().as<uint8_t *>();
+    memset(dstPtr, 0, dst->byteSize());
+
+    const size_t rank = srcDims.size();
+    const size_t rows = InferenceEngine::details::product(srcDims.begin(), srcDims.end() - 1);
+    InferenceEngine::parallel_for(rows, [&](size_t row) {
+        size_t srcOffset = 0, dstOffset = 0, dstStride = dstDims[rank - 1];
+        for (size_t d = rank - 1; d-- > 0;) {
+            const size_t idx = row % srcDims[d];
+            row /= srcDims[d];
+            srcOffset += idx * srcStrides[d];
+            dstOffset += idx * dstStride;
+            dstStride *= dstDims[d];
+        }
+        if (srcStrides[rank - 1] == 1) {
+            memcpy(dstPtr + dstOffset * elemSize, srcPtr + srcOffset * elemSize, srcDims[rank - 1] * elemSize);
+        } else {
+            for (size_t i = 0; i < srcDims[rank - 1]; i++)
+                memcpy(dstPtr + (dstOffset + i) * elemSize, srcPtr + (srcOffset + i * srcStrides[rank - 1]) * elemSize, elemSize);
+        }
+    });
+}
+
+}  // namespace
+
+void MKLDNNPlugin::MKLDNNInferRequest::selectShapeVariant() {
+    // The batch is rounded up to the bucket size only for the networks supporting dynamic batch, the padded
+    // part of such a graph is not processed at all. Other dimensions select the graph of the exact shapes.
+    const size_t bucket = execNetwork->_padBatch ? execNetwork->_cfg.shapeBucket : 1;
+    InferenceEngine::ICNNNetwork::InputShapes shapes;
+    size_t batch = 0;
+    for (auto &input : _inputs) {
+        const auto &dims = input.second->getTensorDesc().getDims();
+        const auto &networkDims = _networkInputs[input.first]->getTensorDesc().getDims();
+        if (dims.size() != networkDims.size())
+            THROW_IE_EXCEPTION << "Input blob rank is not equal network input rank: " << input.first;
+        if (bucket > 1 && batch != 0 && batch != dims[0])
+            THROW_IE_EXCEPTION << "Input blobs have different batch sizes: " << batch << " and " << dims[0];
+        batch = dims[0];
+        shapes[input.first] = dims;
+    }
+
+    variantBatch = 0;
+    if (bucket > 1) {
+        const size_t networkBatch = _networkInputs.begin()->second->getTensorDesc().getDims()[0];
+        const size_t paddedBatch = batch <= networkBatch ? networkBatch : (batch + bucket - 1) / bucket * bucket;
+        for (auto &shape : shapes)
+            shape.second[0] = paddedBatch;
+        // the batch set by the user is applied to the inputs of the full network batch only
+        variantBatch = batch == networkBatch && m_curBatch > 0 ? m_curBatch : static_cast<int>(batch);
+    }
+
+    bool isNetworkShape = true;
+    for (auto &shape : shapes)
+        isNetworkShape = isNetworkShape && shape.second == _networkInputs[shape.first]->getTensorDesc().getDims();
+
+    if (isNetworkShape) {
+        shapeVariant.reset();
+    } else {
+        shapeVariant = execNetwork->GetShapeVariant(shapes);
+        graph = shapeVariant->graphs.local().get();
+
+        // The request keeps its memory states for all graphs, so they have to be of the same shapes
+        for (auto &state : graph->GetStateDescs()) {
+            auto storage = stateStorages.find(state.first);
+            if (storage == stateStorages.end() || MKLDNNMemoryDesc(storage->second->GetDescriptor()) != state.second)
+                THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "Memory state " << state.first
+                                   << " depends on the input shapes, that is not supported by shape variants";
+        }
+    }
+
+    // Inputs with the smaller batch are padded to the graph shapes
+    for (auto &input : _inputs) {
+        auto padded = paddedInputs.find(input.first);
+        auto ext = externalPtr.find(input.first);
+        const auto &dims = shapes[input.first];
+        if (input.second->getTensorDesc().getDims() == dims) {
+            if (padded != paddedInputs.end()) {
+                if (ext != externalPtr.end() && ext->second == padded->second->buffer())
+                    ext->second = input.second->buffer();
+                paddedInputs.erase(padded);
+            }
+            continue;
+        }
+
+        const auto &desc = input.second->getTensorDesc();
+        if (padded == paddedInputs.end() || padded->second->getTensorDesc().getDims() != dims) {
+            auto blob = make_blob_with_precision({desc.getPrecision(), dims, desc.getLayout()});
+            blob->allocate();
+            paddedInputs[input.first] = blob;
+            padded = paddedInputs.find(input.first);
+        }
+        padBlob(input.second, padded->second);
+        if (ext != externalPtr.end())
+            ext->second = padded->second->buffer();
+    }
+
+    // Outputs get the shapes of the selected graph with the batch of the inputs. The sliced outputs
+    // can't be used by the graph in place, their data is copied from the graph memory.
+    InferenceEngine::BlobMap blobs;
+    graph->getOutputBlobs(blobs);
+    for (auto &output : _outputs) {
+        const auto &desc = blobs[output.first]->getTensorDesc();
+        auto dims = desc.getDims();
+        if (bucket > 1 && !dims.empty())
+            dims[0] = batch;
+
+        if (output.second->getTensorDesc().getDims() != dims) {
+            output.second = make_blob_with_precision({output.second->getTensorDesc().getPrecision(), dims,
+                                                      desc.getLayout()});
+            output.second->allocate();
+        }
+
+        if (dims == desc.getDims() && output.second->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32)
+            externalPtr[output.first] = output.second->buffer();
+        else
+            externalPtr.erase(output.first);
+    }
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::checkBlobs() {
+    if (execNetwork->_cfg.shapeCacheSize == 0) {
+        InferRequestInternal::checkBlobs();
+        return;
+    }
+
+    // Inputs of the network shapes are checked as usual, other ones have to be of the network rank only
+    bool isNetworkShape = true;
+    for (auto const &input : _inputs) {
+        if (!input.second || input.second->buffer() == nullptr)
+            THROW_IE_EXCEPTION << "Input data was not allocated. Input name: \'" << input.first << "\'";
+        const auto &dims = input.second->getTensorDesc().getDims();
+        const auto &networkDims = _networkInputs[input.first]->getTensorDesc().getDims();
+        if (dims.size() != networkDims.size())
+            THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Input blob rank is not equal network input rank ("
+                               << dims.size() << "!=" << networkDims.size() << "). Input name: \'" << input.first << "\'";
+        if (input.second->size() == 0)
+            THROW_IE_EXCEPTION << "Input data is empty. Input name: \'" << input.first << "\'";
+        isNetworkShape = isNetworkShape && dims == networkDims;
+    }
+    if (isNetworkShape) {
+        for (auto const &input : _inputs)
+            checkBlob(input.second, input.first, true);
+    }
+
+    // Outputs not matching the selected graph are reallocated before the inference
+    for (auto const &output : _outputs) {
+        if (!output.second || output.second->buffer() == nullptr)
+            THROW_IE_EXCEPTION << "Output data was not allocated. Output name: \'" << output.first << "\'";
+    }
+}
+
+std::vector<InferenceEngine::IMemoryStateInternal::Ptr> MKLDNNPlugin::MKLDNNInferRequest::QueryState() {
+    return memoryStates;
+}
+
 void MKLDNNPlugin::MKLDNNInferRequest::SetBatch(int new_batch) {
     if (!graph->getProperty().enableDynamicBatch)
         THROW_IE_EXCEPTION << "Dynamic batch is not enabled.";
@@ -5,9 +5,12 @@
 #pragma once
 
 #include "mkldnn_graph.h"
+#include "mkldnn_exec_network.h"
 #include <memory>
 #include <string>
+#include <list>
 #include <map>
+#include <vector>
 #include <cpp_interfaces/impl/ie_infer_request_internal.hpp>
 
 namespace MKLDNNPlugin {
@@ -43,13 +46,24 @@ public:
 
     void SetBatch(int batch = -1) override;
 
+    std::vector<InferenceEngine::IMemoryStateInternal::Ptr> QueryState() override;
+
+    void checkBlobs() override;
+
 private:
     template <typename T> void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob);
 
     void changeDefaultPtr();
+    void selectShapeVariant();
     std::shared_ptr<MKLDNNExecNetwork>  execNetwork;
     MKLDNNGraph*                        graph = nullptr;
     std::map<std::string, void*>        externalPtr;
+    std::map<std::string, MKLDNNMemoryPtr>                   stateStorages;
+    std::vector<InferenceEngine::IMemoryStateInternal::Ptr> memoryStates;
+    std::list<std::map<std::string, MKLDNNMemoryPtr>>::iterator requestStates;
+    std::shared_ptr<MKLDNNExecNetwork::ShapeVariant>        shapeVariant;
+    InferenceEngine::BlobMap                                paddedInputs;
+    int                                                     variantBatch = 0;
     InferenceEngine::ProfilingTask      profilingTask;
 };
 }  // namespace MKLDNNPlugin
@@ -3,7 +3,10 @@
 //
 
 #include "mkldnn_memory_state.h"
+#include "mkldnn_exec_network.h"
 #include "mkldnn_extension_utils.h"
+#include <blob_factory.hpp>
+#include <ie_memcpy.h>
 
 using namespace InferenceEngine;
 
@@ -18,6 +21,12 @@ void  MKLDNNMemoryState::Reset() {
 }
 
 void  MKLDNNMemoryState::SetState(Blob::Ptr newState) {
+    // States saved by GetLastState() may have a blocked layout, they are restored as is
+    if (newState->getTensorDesc() == static_cast<TensorDesc>(MKLDNNMemoryDesc(storage->GetDescriptor()))) {
+        ie_memcpy(storage->GetData(), storage->GetSize(), newState->cbuffer().as<const void*>(), newState->byteSize());
+        return;
+    }
+
     auto prec = newState->getTensorDesc().getPrecision();
     auto data_type = MKLDNNExtensionUtils::IEPrecisionToDataType(prec);
     auto data_layout = MKLDNNMemory::Convert(newState->getTensorDesc().getLayout());
@@ -28,8 +37,38 @@ void  MKLDNNMemoryState::SetState(Blob::Ptr newState) {
 }
 
 InferenceEngine::Blob::CPtr MKLDNNMemoryState::GetLastState() const {
-    THROW_IE_EXCEPTION << "GetLastState method is not implemented for MemoryState";
-    return nullptr;
+    // The storage is rebound into the graph on the next Infer(), so a copy is returned
+    auto lastState = make_blob_with_precision(static_cast<TensorDesc>(MKLDNNMemoryDesc(storage->GetDescriptor())));
+    lastState->allocate();
+    ie_memcpy(lastState->buffer(), lastState->byteSize(), storage->GetData(), storage->GetSize());
+    return lastState;
+}
+
+std::vector<MKLDNNMemoryPtr> MKLDNNNetworkMemoryState::getStorages() const {
+    auto execNetwork = network.lock();
+    if (!execNetwork)
+        THROW_IE_EXCEPTION << "Memory state " << name << " is used after the executable network was destroyed";
+    return execNetwork->GetStateStorages(name);
+}
+
+std::string MKLDNNNetworkMemoryState::GetName() const {
+    return name;
+}
+
+void MKLDNNNetworkMemoryState::Reset() {
+    for (auto &storage : getStorages())
+        MKLDNNMemoryState(name, storage).Reset();
+}
+
+void MKLDNNNetworkMemoryState::SetState(Blob::Ptr newState) {
+    for (auto &storage : getStorages())
+        MKLDNNMemoryState(name, storage).SetState(newState);
+}
+
+InferenceEngine::Blob::CPtr MKLDNNNetworkMemoryState::GetLastState() const {
+    // The first storage is the initial value, it is returned only when there are no requests
+    auto storages = getStorages();
+    return MKLDNNMemoryState(name, storages.size() > 1 ? storages[1] : storages.at(0)).GetLastState();
 }
 
 }  // namespace MKLDNNPlugin
\ No newline at end of file
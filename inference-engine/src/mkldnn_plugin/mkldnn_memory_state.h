@@ -7,10 +7,14 @@
 #include "cpp_interfaces/impl/ie_memory_state_internal.hpp"
 #include "mkldnn_memory.h"
 
+#include <memory>
 #include <string>
+#include <vector>
 
 namespace MKLDNNPlugin {
 
+class MKLDNNExecNetwork;
+
 class MKLDNNMemoryState : public InferenceEngine::IMemoryStateInternal {
 public:
     MKLDNNMemoryState(std::string name, MKLDNNMemoryPtr storage) :
@@ -26,4 +30,24 @@ private:
     MKLDNNMemoryPtr storage;
 };
 
+/**
+ * @brief State of the executable network, it controls the state of the same name of all infer requests
+ */
+class MKLDNNNetworkMemoryState : public InferenceEngine::IMemoryStateInternal {
+public:
+    MKLDNNNetworkMemoryState(std::string name, const std::shared_ptr<MKLDNNExecNetwork> &network) :
+            name(name), network(network) {}
+
+    std::string GetName() const override;
+    void Reset() override;
+    void SetState(InferenceEngine::Blob::Ptr newState) override;
+    InferenceEngine::Blob::CPtr GetLastState() const override;
+
+private:
+    std::vector<MKLDNNMemoryPtr> getStorages() const;
+
+    std::string name;
+    std::weak_ptr<MKLDNNExecNetwork> network;
+};
+
 }  // namespace MKLDNNPlugin
\ No newline at end of file
@@ -75,7 +75,8 @@ enum Type {
     Convert,
     MVN,
     Resample,
-    Normalize
+    Normalize,
+    Reduce
 };
 
 Type TypeFromName(const std::string type);
@@ -158,6 +159,8 @@ static std::string NameFromType(Type type) {
             return "Resample";
         case Normalize:
             return "Normalize";
+        case Reduce:
+            return "Reduce";
         default:
             return "Unknown";
     }
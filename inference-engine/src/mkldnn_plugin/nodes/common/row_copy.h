@@ -0,0 +1,77 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(_MSC_VER)
+#include <xmmintrin.h>
+#endif
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+/**
+ * @brief Hints the hardware to bring a cache line with the given address to all cache levels
+ */
+inline void prefetch_row(const void* ptr) {
+#if defined(_MSC_VER)
+    _mm_prefetch(reinterpret_cast<const char*>(ptr), _MM_HINT_T0);
+#else
+    __builtin_prefetch(ptr);
+#endif
+}
+
+/**
+ * @brief Copies rows of a size known at compile time.
+ * Gather/Scatter like kernels move millions of short rows, with the constant size the compiler emits
+ * a few vector loads/stores instead of a memcpy call.
+ */
+template <size_t row_size>
+struct row_copy_fixed {
+    size_t size() const { return row_size; }
+    void operator()(uint8_t* dst, const uint8_t* src) const { std::memcpy(dst, src, row_size); }
+};
+
+/**
+ * @brief Copies rows of a size known only at runtime
+ */
+struct row_copy_any {
+    explicit row_copy_any(size_t row_size) : row_size(row_size) {}
+    size_t size() const { return row_size; }
+    void operator()(uint8_t* dst, const uint8_t* src) const { std::memcpy(dst, src, row_size); }
+
+    size_t row_size;
+};
+
+/**
+ * @brief Calls body(copy_row) once with the copier for rows of row_size bytes. Rows of 1, 2, 4, ..., 256 bytes
+ * get a row_copy_fixed, so the row loop of the body is instantiated for the size and the copy is inlined into it.
+ * Other sizes fall back to row_copy_any.
+ * @param row_size Row size in bytes
+ * @param body Functor with a template operator() taking the copier
+ */
+template <typename Body>
+inline void dispatch_row_copy(size_t row_size, const Body& body) {
+    switch (row_size) {
+        case 1: body(row_copy_fixed<1>()); break;
+        case 2: body(row_copy_fixed<2>()); break;
+        case 4: body(row_copy_fixed<4>()); break;
+        case 8: body(row_copy_fixed<8>()); break;
+        case 16: body(row_copy_fixed<16>()); break;
+        case 32: body(row_copy_fixed<32>()); break;
+        case 64: body(row_copy_fixed<64>()); break;
+        case 128: body(row_copy_fixed<128>()); break;
+        case 256: body(row_copy_fixed<256>()); break;
+        default: body(row_copy_any(row_size)); break;
+    }
+}
+
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
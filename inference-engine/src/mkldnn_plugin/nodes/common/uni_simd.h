@@ -225,7 +225,7 @@ namespace AVX2 {
     }
 
     static inline __m256 _mm_uni_cmpgt_i32(__m256i vec0, __m256i vec1) {
-        return _mm256_cvtepi32_ps(_mm256_cmpgt_epi32(vec0, vec1));
+        return _mm256_castsi256_ps(_mm256_cmpgt_epi32(vec0, vec1));
     }
 
     static inline __m256i _mm_uni_blendv_epi8(__m256i vec0, __m256i vec1, __m256i vmask) {
@@ -339,7 +339,7 @@ namespace SSE42 {
     }
 
     static inline __m128 _mm_uni_cmpgt_i32(__m128i vec0, __m128i vec1) {
-        return _mm_cvtepi32_ps(_mm_cmpgt_epi32(vec0, vec1));
+        return _mm_castsi128_ps(_mm_cmpgt_epi32(vec0, vec1));
     }
 
     static inline __m128i _mm_uni_blendv_epi8(__m128i vec0, __m128i vec1, __m128i vmask) {
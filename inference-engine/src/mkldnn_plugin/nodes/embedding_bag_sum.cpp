@@ -0,0 +1,236 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "base.hpp"
+
+#include <string>
+#include <vector>
+#include <cstring>
+#include <functional>
+#include <numeric>
+#include "ie_parallel.hpp"
+#include "common/defs.h"
+#include "common/row_copy.h"
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+/**
+ * @brief Implements EmbeddingBagOffsetsSum, EmbeddingBagPackedSum and EmbeddingSegmentsSum.
+ * Rows of the embedding table are accumulated directly into the output row of their bag,
+ * so the gathered [num_indices, emb_dim] tensor is never materialized.
+ */
+class EmbeddingBagSumImpl: public ExtLayerBase {
+private:
+    enum class BagsType { offsets, packed, segments };
+
+public:
+    explicit EmbeddingBagSumImpl(const CNNLayer* layer) {
+        try {
+            if (layer->type == "EmbeddingBagOffsetsSum") {
+                bagsType = BagsType::offsets;
+                if (layer->insData.size() < 3 || layer->insData.size() > 5)
+                    THROW_IE_EXCEPTION << layer->name << " Incorrect number of input edges!";
+                if (layer->insData.size() > DEFAULT_INDEX_PORT)
+                    defaultIndexPort = DEFAULT_INDEX_PORT;
+                if (layer->insData.size() > DEFAULT_INDEX_PORT + 1)
+                    weightsPort = DEFAULT_INDEX_PORT + 1;
+            } else if (layer->type == "EmbeddingBagPackedSum") {
+                bagsType = BagsType::packed;
+                if (layer->insData.size() < 2 || layer->insData.size() > 3)
+                    THROW_IE_EXCEPTION << layer->name << " Incorrect number of input edges!";
+                if (layer->insData.size() > 2)
+                    weightsPort = 2;
+            } else if (layer->type == "EmbeddingSegmentsSum") {
+                bagsType = BagsType::segments;
+                if (layer->insData.size() < 4 || layer->insData.size() > 6)
+                    THROW_IE_EXCEPTION << layer->name << " Incorrect number of input edges!";
+                if (layer->insData.size() > SEGMENTS_DEFAULT_INDEX_PORT)
+                    defaultIndexPort = SEGMENTS_DEFAULT_INDEX_PORT;
+                if (layer->insData.size() > SEGMENTS_DEFAULT_INDEX_PORT + 1)
+                    weightsPort = SEGMENTS_DEFAULT_INDEX_PORT + 1;
+            } else {
+                THROW_IE_EXCEPTION << layer->name << " Incorrect EmbeddingBag layer type!";
+            }
+
+            if (layer->outData.size() != 1)
+                THROW_IE_EXCEPTION << layer->name << " Incorrect number of output edges!";
+
+            Precision tablePrecision = layer->insData[EMB_TABLE_PORT].lock()->getTensorDesc().getPrecision();
+            if (tablePrecision != Precision::FP32)
+                THROW_IE_EXCEPTION << layer->name << " Incorrect precision of the embedding table. Only FP32 is supported!";
+
+            for (size_t i = 1; i < layer->insData.size(); i++) {
+                if (static_cast<int>(i) == weightsPort)
+                    continue;
+                if (layer->insData[i].lock()->getTensorDesc().getPrecision() != Precision::I32)
+                    THROW_IE_EXCEPTION << layer->name << " Incorrect precision of the input " << i << ". Only I32 is supported!";
+            }
+            if (weightsPort >= 0 && layer->insData[weightsPort].lock()->getTensorDesc().getPrecision() != Precision::FP32)
+                THROW_IE_EXCEPTION << layer->name << " Incorrect precision of the per sample weights. Only FP32 is supported!";
+
+            const SizeVector& tableDims = layer->insData[EMB_TABLE_PORT].lock()->getTensorDesc().getDims();
+            if (tableDims.empty())
+                THROW_IE_EXCEPTION << layer->name << " Embedding table must have at least one dimension!";
+            tableRows = tableDims[0];
+            embDim = std::accumulate(tableDims.begin() + 1, tableDims.end(), size_t(1), std::multiplies<size_t>());
+
+            const SizeVector& indicesDims = layer->insData[INDICES_PORT].lock()->getTensorDesc().getDims();
+            if (bagsType == BagsType::packed && indicesDims.size() != 2)
+                THROW_IE_EXCEPTION << layer->name << " Indices must be a 2D tensor for EmbeddingBagPackedSum!";
+            if (bagsType != BagsType::packed && indicesDims.size() != 1)
+                THROW_IE_EXCEPTION << layer->name << " Indices must be a 1D tensor!";
+
+            if (weightsPort >= 0 &&
+                layer->insData[weightsPort].lock()->getTensorDesc().getDims() != indicesDims)
+                THROW_IE_EXCEPTION << layer->name << " Per sample weights must have the same shape as indices!";
+
+            const SizeVector& outDims = layer->outData[0]->getTensorDesc().getDims();
+            if (outDims.empty())
+                THROW_IE_EXCEPTION << layer->name << " Incorrect dimensions for output.";
+            numBags = outDims[0];
+
+            std::vector<DataConfigurator> inConfs(layer->insData.size(), DataConfigurator(ConfLayout::PLN));
+            addConfig(layer, inConfs, { DataConfigurator(ConfLayout::PLN) });
+        } catch (InferenceEngine::details::InferenceEngineException &ex) {
+            errorMsg = ex.what();
+        }
+    }
+
+    StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept override {
+        const float *table = inputs[EMB_TABLE_PORT]->cbuffer().as<const float *>() +
+            inputs[EMB_TABLE_PORT]->getTensorDesc().getBlockingDesc().getOffsetPadding();
+        const int32_t *indices = inputs[INDICES_PORT]->cbuffer().as<const int32_t *>() +
+            inputs[INDICES_PORT]->getTensorDesc().getBlockingDesc().getOffsetPadding();
+        const float *weights = weightsPort < 0 ? nullptr :
+            inputs[weightsPort]->cbuffer().as<const float *>() + inputs[weightsPort]->getTensorDesc().getBlockingDesc().getOffsetPadding();
+        float *dst = outputs[0]->cbuffer().as<float *>() + outputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
+
+        const size_t numIndices = inputs[INDICES_PORT]->size();
+        int32_t defaultIndex = defaultIndexPort < 0 ? -1 : inputs[defaultIndexPort]->cbuffer().as<const int32_t *>()[0];
+
+        //  bag b consists of indices[order[bagStarts[b]]] .. indices[order[bagStarts[b + 1] - 1]],
+        //  order is only needed when segment ids are not sorted
+        std::vector<size_t> bagStarts(numBags + 1, 0);
+        std::vector<size_t> order;
+        switch (bagsType) {
+            case BagsType::offsets: {
+                const int32_t *offsets = inputs[OFFSETS_PORT]->cbuffer().as<const int32_t *>() +
+                    inputs[OFFSETS_PORT]->getTensorDesc().getBlockingDesc().getOffsetPadding();
+                for (size_t b = 0; b < numBags; b++) {
+                    if (offsets[b] < 0 || static_cast<size_t>(offsets[b]) > numIndices ||
+                        (b > 0 && offsets[b] < offsets[b - 1]))
+                        return error(resp, "Offsets must be non-decreasing and lie within indices");
+                    bagStarts[b] = offsets[b];
+                }
+                bagStarts[numBags] = numIndices;
+                break;
+            }
+            case BagsType::packed: {
+                const size_t bagSize = numBags == 0 ? 0 : numIndices / numBags;
+                for (size_t b = 0; b <= numBags; b++)
+                    bagStarts[b] = b * bagSize;
+                break;
+            }
+            case BagsType::segments: {
+                const int32_t *segmentIds = inputs[SEGMENT_IDS_PORT]->cbuffer().as<const int32_t *>() +
+                    inputs[SEGMENT_IDS_PORT]->getTensorDesc().getBlockingDesc().getOffsetPadding();
+                bool sorted = true;
+                for (size_t i = 0; i < numIndices; i++) {
+                    if (segmentIds[i] < 0 || static_cast<size_t>(segmentIds[i]) >= numBags)
+                        return error(resp, "Segment ids must lie within [0, num_segments)");
+                    bagStarts[segmentIds[i] + 1]++;
+                    sorted = sorted && (i == 0 || segmentIds[i] >= segmentIds[i - 1]);
+                }
+                for (size_t b = 0; b < numBags; b++)
+                    bagStarts[b + 1] += bagStarts[b];
+                if (!sorted) {
+                    order.resize(numIndices);
+                    std::vector<size_t> pos(bagStarts.begin(), bagStarts.end() - 1);
+                    for (size_t i = 0; i < numIndices; i++)
+                        order[pos[segmentIds[i]]++] = i;
+                }
+                break;
+            }
+        }
+
+        //  Indices out of the table select zero rows, as Gather does for the Gather+Reduce pattern
+        //  this layer replaces, so they don't contribute to the sum
+        auto isValid = [&](int32_t idx) { return idx >= 0 && static_cast<size_t>(idx) < tableRows; };
+        if (!isValid(defaultIndex))
+            defaultIndex = -1;
+
+        parallel_for(numBags, [&](size_t b) {
+            float *dstRow = dst + b * embDim;
+            const size_t start = bagStarts[b], end = bagStarts[b + 1];
+
+            if (start == end) {
+                if (defaultIndex >= 0)
+                    std::memcpy(dstRow, table + defaultIndex * embDim, embDim * sizeof(float));
+                else
+                    std::memset(dstRow, 0, embDim * sizeof(float));
+                return;
+            }
+
+            auto position = [&](size_t i) { return order.empty() ? i : order[i]; };
+            bool first = true;
+            for (size_t i = start; i < end; i++) {
+                if (i + 1 < end && isValid(indices[position(i + 1)]))
+                    prefetch_row(table + indices[position(i + 1)] * embDim);
+
+                const size_t p = position(i);
+                if (!isValid(indices[p]))
+                    continue;
+                const float *srcRow = table + indices[p] * embDim;
+                const float w = weights ? weights[p] : 1.f;
+                if (first) {
+                    DLSDK_EXT_IVDEP()
+                    for (size_t j = 0; j < embDim; j++)
+                        dstRow[j] = w * srcRow[j];
+                    first = false;
+                } else {
+                    DLSDK_EXT_IVDEP()
+                    for (size_t j = 0; j < embDim; j++)
+                        dstRow[j] += w * srcRow[j];
+                }
+            }
+            if (first)
+                std::memset(dstRow, 0, embDim * sizeof(float));
+        });
+
+        return OK;
+    }
+
+private:
+    static StatusCode error(ResponseDesc *resp, const std::string& msg) {
+        if (resp) {
+            std::string errorMsg = "EmbeddingBag layer: " + msg;
+            errorMsg.copy(resp->msg, sizeof(resp->msg) - 1);
+        }
+        return GENERAL_ERROR;
+    }
+
+    BagsType bagsType = BagsType::offsets;
+    size_t tableRows = 0;
+    size_t embDim = 1;
+    size_t numBags = 0;
+    int defaultIndexPort = -1;
+    int weightsPort = -1;
+
+    const size_t EMB_TABLE_PORT = 0;
+    const size_t INDICES_PORT = 1;
+    const size_t OFFSETS_PORT = 2;
+    const size_t SEGMENT_IDS_PORT = 2;
+    const size_t DEFAULT_INDEX_PORT = 3;
+    const size_t SEGMENTS_DEFAULT_INDEX_PORT = 4;
+};
+
+REG_FACTORY_FOR(EmbeddingBagSumImpl, EmbeddingBagOffsetsSum);
+REG_FACTORY_FOR(EmbeddingBagSumImpl, EmbeddingBagPackedSum);
+REG_FACTORY_FOR(EmbeddingBagSumImpl, EmbeddingSegmentsSum);
+
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -11,7 +11,7 @@
 #include <algorithm>
 #include <limits>
 #include "ie_parallel.hpp"
-#include "common/simple_copy.h"
+#include "common/row_copy.h"
 #include "common/fp16_utils.h"
 
 namespace InferenceEngine {
@@ -26,8 +26,9 @@ public:
                 THROW_IE_EXCEPTION << layer->name << " Incorrect number of input/output edges!";
 
             Precision inIdxPrecision = layer->insData[GATHER_INDEXES].lock()->getTensorDesc().getPrecision();
-            if (inIdxPrecision != Precision::FP32 && inIdxPrecision != Precision::I32 && inIdxPrecision != Precision::FP16)
-                THROW_IE_EXCEPTION << layer->name << " Incorrect input precision. Only FP32, FP16 or I32 are supported!";
+            if (inIdxPrecision != Precision::FP32 && inIdxPrecision != Precision::I32 && inIdxPrecision != Precision::I64 &&
+                inIdxPrecision != Precision::FP16)
+                THROW_IE_EXCEPTION << layer->name << " Incorrect input precision. Only FP32, FP16, I32 or I64 are supported!";
 
             axis = layer->GetParamAsInt("axis");
 
@@ -40,8 +41,20 @@ public:
             if (axis < 0)
                 axis += dictionary_dims.size();
 
+            const SizeVector& indexes_dims = layer->insData[GATHER_INDEXES].lock()->getTensorDesc().getDims();
+            batchDims = layer->GetParamAsInt("batch_dims", 0);
+            if (batchDims < 0)
+                batchDims += indexes_dims.size();
+            if (batchDims < 0 || batchDims > axis || batchDims > static_cast<int>(indexes_dims.size()))
+                THROW_IE_EXCEPTION << layer->name << " Incorrect batch_dims value: " << batchDims;
+            for (int i = 0; i < batchDims; i++) {
+                if (indexes_dims[i] != dictionary_dims[i])
+                    THROW_IE_EXCEPTION << layer->name << " Batch dimensions of dictionary and indices must be equal!";
+                batchSize *= dictionary_dims[i];
+            }
+
             //  Find number of dictionaries, index range and data length
-            for (int i = 0; i < axis; i++)
+            for (int i = batchDims; i < axis; i++)
                 numDictionaries *= dictionary_dims[i];
             indexRange = dictionary_dims[axis];
             for (size_t i = axis + 1; i < dictionary_dims.size(); i++)
@@ -56,7 +69,6 @@ public:
             dataConfigDct.desc = TensorDesc(dataPrecision, dictionary_dims,
                     layer->insData[GATHER_DICTIONARY].lock()->getTensorDesc().getLayoutByDims(dictionary_dims));
             config.inConfs.push_back(dataConfigDct);
-            const SizeVector& indexes_dims = layer->insData[GATHER_INDEXES].lock()->getTensorDesc().getDims();
             dataConfigIdx.desc = TensorDesc(inIdxPrecision, indexes_dims,
                     layer->insData[GATHER_INDEXES].lock()->getTensorDesc().getLayout());
             config.inConfs.push_back(dataConfigIdx);
@@ -73,34 +85,19 @@ public:
         }
     }
 
-    struct f32toUi32 {
-        inline unsigned int operator()(const float value) {
-            return static_cast<unsigned int>(value);
-        }
-    };
-
-    struct f16toUi32 {
-        inline unsigned int operator()(const ie_fp16 value) {
-            return static_cast<unsigned int>(f16tof32(value));
-        }
-    };
-
-    struct i32toUi32 {
-        inline unsigned int operator()(const int32_t value) {
-            return static_cast<unsigned int>(value);
-        }
-    };
-
     StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept override {
         switch (inputs[GATHER_INDEXES]->getTensorDesc().getPrecision()) {
             case Precision::FP32:
-                gather<float, f32toUi32>(inputs[GATHER_INDEXES], inputs[GATHER_DICTIONARY], outputs[0]);
+                gather<float>(inputs[GATHER_INDEXES], inputs[GATHER_DICTIONARY], outputs[0]);
                 break;
             case Precision::FP16:
-                gather<ie_fp16, f16toUi32>(inputs[GATHER_INDEXES], inputs[GATHER_DICTIONARY], outputs[0]);
+                gather<ie_fp16>(inputs[GATHER_INDEXES], inputs[GATHER_DICTIONARY], outputs[0]);
                 break;
             case Precision::I32:
-                gather<int32_t, i32toUi32>(inputs[GATHER_INDEXES], inputs[GATHER_DICTIONARY], outputs[0]);
+                gather<int32_t>(inputs[GATHER_INDEXES], inputs[GATHER_DICTIONARY], outputs[0]);
+                break;
+            case Precision::I64:
+                gather<int64_t>(inputs[GATHER_INDEXES], inputs[GATHER_DICTIONARY], outputs[0]);
                 break;
             default:
                 return GENERAL_ERROR;
@@ -110,40 +107,92 @@ public:
     }
 
 private:
-    template <typename index_t, class Conversion>
+    //  Negative indices are mapped to values out of range, so they are clipped as well
+    static inline size_t toIndex(const float value) { return static_cast<size_t>(static_cast<int64_t>(value)); }
+    static inline size_t toIndex(const ie_fp16 value) { return toIndex(f16tof32(value)); }
+    static inline size_t toIndex(const int32_t value) { return static_cast<size_t>(static_cast<int64_t>(value)); }
+    static inline size_t toIndex(const int64_t value) { return static_cast<size_t>(value); }
+
+    template <typename index_t>
     void gather(Blob::Ptr indexes, Blob::Ptr dictionary, Blob::Ptr output) {
-        size_t src_indexSize = indexes->size();
         const index_t *src_index = indexes->cbuffer().as<const index_t *>() + indexes->getTensorDesc().getBlockingDesc().getOffsetPadding();
         const uint8_t *src_dataDict = dictionary->cbuffer().as<const uint8_t *>() + dictionary->getTensorDesc().getBlockingDesc().getOffsetPadding();
         uint8_t *dst_data = output->cbuffer().as<uint8_t*>() + output->getTensorDesc().getBlockingDesc().getOffsetPadding();
-        size_t len = dataLength * dictionary->getTensorDesc().getPrecision().size();
-
-        parallel_for(src_indexSize, [&](size_t i) {
-            unsigned int idx = Conversion()(src_index[i]);
-
-            //  Index clipping
-            if (idx < indexRange) {
-                //  Copying data to destination from Dictionary
-                for (size_t j = 0; j < numDictionaries; j++) {
-                    simple_copy(&dst_data[len * (i + j * src_indexSize)],
-                                output->byteSize() - (len * (i + j * src_indexSize)),
-                                &src_dataDict[len * (idx + j * indexRange)],
-                                len);
+        const size_t len = dataLength * dictionary->getTensorDesc().getPrecision().size();
+
+        dispatch_row_copy(len, GatherRows<index_t>{*this, src_index, indexes->size(), src_dataDict, dst_data});
+    }
+
+    //  Arguments of the row loop, which dispatch_row_copy instantiates for the row size
+    template <typename index_t>
+    struct GatherRows {
+        const GatherImpl &impl;
+        const index_t *src_index;
+        size_t src_indexSize;
+        const uint8_t *src_dataDict;
+        uint8_t *dst_data;
+
+        template <typename row_copy_t>
+        void operator()(const row_copy_t &copy_row) const {
+            impl.gatherRows(copy_row, src_index, src_indexSize, src_dataDict, dst_data);
+        }
+    };
+
+    template <typename row_copy_t, typename index_t>
+    void gatherRows(const row_copy_t &copy_row, const index_t *src_index, size_t src_indexSize,
+                    const uint8_t *src_dataDict, uint8_t *dst_data) const {
+        const size_t len = copy_row.size();
+        const size_t indexesPerBatch = src_indexSize / batchSize;
+        const size_t work_amount = batchSize * numDictionaries * indexesPerBatch;
+
+        //  Output rows are laid out as [batch][dictionary][index], so a contiguous chunk of work
+        //  produces a contiguous chunk of output and only the source rows are accessed randomly
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            splitter(work_amount, nthr, ithr, start, end);
+            if (start >= end)
+                return;
+
+            size_t i = start % indexesPerBatch;
+            size_t dict = start / indexesPerBatch;
+            const index_t *batch_index = src_index + (dict / numDictionaries) * indexesPerBatch;
+            const uint8_t *src_dict = src_dataDict + dict * indexRange * len;
+            uint8_t *dst = dst_data + start * len;
+
+            for (size_t iwork = start; iwork < end; iwork++, dst += len) {
+                if (i + GATHER_PREFETCH_DISTANCE < indexesPerBatch) {
+                    size_t next_idx = toIndex(batch_index[i + GATHER_PREFETCH_DISTANCE]);
+                    if (next_idx < indexRange)
+                        prefetch_row(src_dict + next_idx * len);
                 }
-            } else {
-                for (size_t j = 0; j < numDictionaries; j++) {
-                    memset(&dst_data[len * (i + j * src_indexSize)], 0, len);
+
+                size_t idx = toIndex(batch_index[i]);
+                //  Index clipping
+                if (idx < indexRange) {
+                    copy_row(dst, src_dict + idx * len);
+                } else {
+                    memset(dst, 0, len);
+                }
+
+                if (++i == indexesPerBatch) {
+                    i = 0;
+                    src_dict += indexRange * len;
+                    if (++dict % numDictionaries == 0)
+                        batch_index += indexesPerBatch;
                 }
             }
         });
     }
 
     int axis = 0;
+    int batchDims = 0;
+    size_t batchSize = 1;
     size_t numDictionaries = 1;
     size_t indexRange = 0;
     size_t dataLength = 1;
     const size_t GATHER_DICTIONARY = 0;
     const size_t GATHER_INDEXES = 1;
+    const size_t GATHER_PREFETCH_DISTANCE = 8;
 };
 
 
@@ -48,6 +48,7 @@ MKLDNN_EXTENSION_NODE(UniqueImpl, Unique);
 MKLDNN_EXTENSION_NODE(PSROIPoolingImpl, PSROIPooling);
 MKLDNN_EXTENSION_NODE(DepthToSpaceImpl, DepthToSpace);
 MKLDNN_EXTENSION_NODE(ScatterImpl, ScatterUpdate);
+MKLDNN_EXTENSION_NODE(ScatterImpl, ScatterElementsUpdate);
 MKLDNN_EXTENSION_NODE(OneHotImpl, OneHot);
 MKLDNN_EXTENSION_NODE(BroadcastImpl, Broadcast);
 MKLDNN_EXTENSION_NODE(ExperimentalSparseWeightedReduceImpl, ExperimentalSparseWeightedSum);
@@ -72,22 +73,13 @@ MKLDNN_EXTENSION_NODE(GatherImpl, Gather);
 MKLDNN_EXTENSION_NODE(ProposalImpl, Proposal);
 MKLDNN_EXTENSION_NODE(RangeImpl, Range);
 MKLDNN_EXTENSION_NODE(SelectImpl, Select);
-MKLDNN_EXTENSION_NODE(ReduceImpl, ReduceAnd);
-MKLDNN_EXTENSION_NODE(ReduceImpl, ReduceL1);
-MKLDNN_EXTENSION_NODE(ReduceImpl, ReduceL2);
-MKLDNN_EXTENSION_NODE(ReduceImpl, ReduceLogSum);
-MKLDNN_EXTENSION_NODE(ReduceImpl, ReduceLogSumExp);
-MKLDNN_EXTENSION_NODE(ReduceImpl, ReduceMax);
-MKLDNN_EXTENSION_NODE(ReduceImpl, ReduceMean);
-MKLDNN_EXTENSION_NODE(ReduceImpl, ReduceMin);
-MKLDNN_EXTENSION_NODE(ReduceImpl, ReduceOr);
-MKLDNN_EXTENSION_NODE(ReduceImpl, ReduceProd);
-MKLDNN_EXTENSION_NODE(ReduceImpl, ReduceSum);
-MKLDNN_EXTENSION_NODE(ReduceImpl, ReduceSumSquare);
 MKLDNN_EXTENSION_NODE(GatherTreeImpl, GatherTree);
 MKLDNN_EXTENSION_NODE(PriorBoxClusteredImpl, PriorBoxClustered);
 MKLDNN_EXTENSION_NODE(SpaceToBatchImpl, SpaceToBatch);
 MKLDNN_EXTENSION_NODE(SparseSegmentReduceImpl, SparseSegmentMean);
 MKLDNN_EXTENSION_NODE(SparseSegmentReduceImpl, SparseSegmentSqrtN);
 MKLDNN_EXTENSION_NODE(SparseSegmentReduceImpl, SparseSegmentSum);
+MKLDNN_EXTENSION_NODE(EmbeddingBagSumImpl, EmbeddingBagOffsetsSum);
+MKLDNN_EXTENSION_NODE(EmbeddingBagSumImpl, EmbeddingBagPackedSum);
+MKLDNN_EXTENSION_NODE(EmbeddingBagSumImpl, EmbeddingSegmentsSum);
 MKLDNN_EXTENSION_NODE(CumSumImpl, CumSum);
@@ -142,6 +142,13 @@ void MKLDNNConvolutionNode::getSupportedDescriptors() {
         }
     }
 
+    // INT8 convolutions have no BF16 destination, the output of the INT8 region is dequantized to FP32
+    // and reordered to the BF16 consumers
+    if ((inputDataType == memory::u8 || inputDataType == memory::s8) && outputDataType == memory::bf16) {
+        outputDataType = memory::f32;
+        eltwisePrecision = Precision::FP32;
+    }
+
     int expectedInputEdgesNum = baseInputsNumber + isFusedWith(Eltwise);
     for (int i = 0; i < fusedWith.size(); i++) {
         auto *convolutionNode = dynamic_cast<MKLDNNConvolutionNode *>(fusedWith[i].get());
@@ -7,7 +7,9 @@
 #include "mkldnn_depthwise_node.h"
 #include "mkldnn_quantize_node.h"
 #include "desc_iterator.hpp"
+#include "weights_compressor.h"
 #include <ie_layers.h>
+#include <ie_parallel.hpp>
 #include <string>
 #include <vector>
 #include <mkldnn_extension_utils.h>
@@ -37,6 +39,12 @@ MKLDNNFullyConnectedNode::MKLDNNFullyConnectedNode(const InferenceEngine::CNNLay
         baseInputsNumber = getCnnLayer().get()->insData.size();
     }
 
+    if (WeightsCompressor::isCompressed(*layer)) {
+        weightsCompressed = true;
+        compressedWeights = layer->blobs[WeightsCompressor::compressedWeightsBlob];
+        compressedScales = layer->blobs[WeightsCompressor::compressedScalesBlob];
+    }
+
     // Trying to find oi-scale
     if (getCnnLayer()->type == "FullyConnected" && getCnnLayer()->precision == Precision::I8) {
         if (baseInputsNumber != 1) {
@@ -85,9 +93,32 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
         }
     }
 
+    // INT8 inner product has no BF16 destination, the output is dequantized to FP32 and reordered
+    if ((inputDataType == memory::u8 || inputDataType == memory::s8) && outputDataType == memory::bf16) {
+        outputDataType = memory::f32;
+    }
+
     auto * fcLayer = dynamic_cast<FullyConnectedLayer*>(getCnnLayer().get());
     if (fcLayer == nullptr)
         THROW_IE_EXCEPTION << "Cannot convert fully connected layer.";
+
+    if (weightsCompressed) {
+        if (getParentEdges().size() != 1)
+            THROW_IE_EXCEPTION << "Incorrect number of input edges for layer " << getName();
+        if (getChildEdges().empty())
+            THROW_IE_EXCEPTION << "Incorrect number of output edges for layer " << getName();
+
+        const size_t inputChannels = MKLDNNDims(fcLayer->input()->getDims()).size(1);
+        const bool int8Weights = compressedWeights->getTensorDesc().getPrecision() == Precision::I8;
+        weightsGroupSize = int8Weights ? inputChannels : WeightsCompressor::int4GroupSize;
+        const size_t groups = (inputChannels + weightsGroupSize - 1) / weightsGroupSize;
+        if (compressedWeights->size() != fcLayer->_out_num * (int8Weights ? inputChannels : (inputChannels + 1) / 2) ||
+            compressedScales->size() != fcLayer->_out_num * groups)
+            THROW_IE_EXCEPTION << "Compressed weights of layer " << getName() << " don't match its input";
+
+        withBiases = fcLayer->_biases != nullptr && fcLayer->_biases->size() != 0;
+        return;
+    }
     if (fcLayer->_weights == nullptr && baseInputsNumber == 1) {
         THROW_IE_EXCEPTION << "Weights are empty for layer: " << fcLayer->name
                            << " used in MKLDNN node: " << getName() << "\n"
@@ -158,7 +189,57 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
     }
 }
 
+void MKLDNNFullyConnectedNode::initSupportedPrimitiveDescriptors() {
+    if (!weightsCompressed) {
+        MKLDNNNode::initSupportedPrimitiveDescriptors();
+        return;
+    }
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    // The decompressing kernel works with planar FP32 data only
+    InferenceEngine::LayerConfig config;
+    config.dynBatchSupport = true;
+
+    InferenceEngine::DataConfig inConfig;
+    inConfig.inPlace = -1;
+    inConfig.constant = false;
+    inConfig.desc = MKLDNNMemoryDesc(getParentEdgeAt(0)->getDims(), memory::f32,
+                                     MKLDNNMemory::GetPlainFormat(getParentEdgeAt(0)->getDims()));
+    config.inConfs.push_back(inConfig);
+
+    InferenceEngine::DataConfig outConfig;
+    outConfig.inPlace = -1;
+    outConfig.constant = false;
+    outConfig.desc = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), memory::f32,
+                                      MKLDNNMemory::GetPlainFormat(getChildEdgeAt(0)->getDims()));
+    config.outConfs.push_back(outConfig);
+
+    supportedPrimitiveDescriptors.push_back({config, impl_desc_type::ref_any,
+                                             MKLDNNMemory::GetPlainFormat(getChildEdgeAt(0)->getDims())});
+}
+
+void MKLDNNFullyConnectedNode::initOptimalPrimitiveDescriptor() {
+    // The only descriptor of compressed weights is already fully defined
+    if (weightsCompressed)
+        return;
+
+    MKLDNNNode::initOptimalPrimitiveDescriptor();
+}
+
 void MKLDNNFullyConnectedNode::createPrimitive() {
+    if (weightsCompressed) {
+        auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+        auto& srcMemPtr = getParentEdgeAt(0)->getMemoryPtr();
+        if (!dstMemPtr || !dstMemPtr->GetPrimitivePtr())
+            THROW_IE_EXCEPTION << "Destination memory isn't allocated.";
+        if (!srcMemPtr || !srcMemPtr->GetPrimitivePtr())
+            THROW_IE_EXCEPTION << "Input memory isn't allocated.";
+        if (getSelectedPrimitiveDescriptor() == nullptr)
+            THROW_IE_EXCEPTION << "Preferable primitive descriptor isn't set.";
+        return;
+    }
+
     if (prim)
         return;
 
@@ -261,6 +342,81 @@ void MKLDNNFullyConnectedNode::setPostOps(mkldnn::primitive_attr &attr, bool ini
     attr.set_post_ops(ops);
 }
 
+void MKLDNNFullyConnectedNode::execute(mkldnn::stream strm) {
+    if (weightsCompressed) {
+        executeCompressed();
+        return;
+    }
+
+    MKLDNNNode::execute(strm);
+}
+
+static inline float dotProduct(const float *a, const float *b, size_t size) {
+    // independent partial sums let the compiler vectorize the reduction
+    float partialSums[8] = {};
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        for (size_t j = 0; j < 8; j++)
+            partialSums[j] += a[i + j] * b[i + j];
+    }
+
+    float sum = 0.f;
+    for (; i < size; i++)
+        sum += a[i] * b[i];
+    for (size_t j = 0; j < 8; j++)
+        sum += partialSums[j];
+    return sum;
+}
+
+void MKLDNNFullyConnectedNode::executeCompressed() {
+    auto& srcMemory = getParentEdgeAt(0)->getMemory();
+    auto& dstMemory = getChildEdgeAt(0)->getMemory();
+    const float *src = reinterpret_cast<const float*>(srcMemory.GetData()) +
+                       srcMemory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    float *dst = reinterpret_cast<float*>(dstMemory.GetData()) +
+                 dstMemory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+
+    const size_t batch = batchToProcess();
+    const size_t inputChannels = getParentEdgeAt(0)->getDims().size(1);
+    const size_t outputChannels = getChildEdgeAt(0)->getDims()[1];
+    const size_t groups = (inputChannels + weightsGroupSize - 1) / weightsGroupSize;
+    const bool int8Weights = compressedWeights->getTensorDesc().getPrecision() == Precision::I8;
+    const size_t rowSize = int8Weights ? inputChannels : (inputChannels + 1) / 2;
+
+    const uint8_t *weights = compressedWeights->cbuffer().as<const uint8_t*>();
+    const float *scales = compressedScales->cbuffer().as<const float*>();
+    auto *fcLayer = dynamic_cast<FullyConnectedLayer*>(getCnnLayer().get());
+    const float *biases = withBiases ? fcLayer->_biases->cbuffer().as<const float*>() : nullptr;
+
+    // Every output channel is decompressed to the thread local row once and reused by all batches,
+    // so the weights are read from memory in the compressed form only
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(outputChannels, nthr, ithr, start, end);
+        if (start >= end)
+            return;
+
+        std::vector<float> row(inputChannels);
+        for (size_t oc = start; oc < end; oc++) {
+            const uint8_t *packed = weights + oc * rowSize;
+            for (size_t ic = 0; ic < inputChannels; ic++) {
+                int8_t value;
+                if (int8Weights) {
+                    value = static_cast<int8_t>(packed[ic]);
+                } else {
+                    // sign extension of the nibble
+                    value = static_cast<int8_t>(static_cast<uint8_t>(packed[ic / 2] << (ic % 2 == 0 ? 4 : 0))) >> 4;
+                }
+                row[ic] = static_cast<float>(value) * scales[oc * groups + ic / weightsGroupSize];
+            }
+
+            const float bias = biases != nullptr ? biases[oc] : 0.f;
+            for (size_t mb = 0; mb < batch; mb++)
+                dst[mb * outputChannels + oc] = dotProduct(src + mb * inputChannels, row.data(), inputChannels) + bias;
+        }
+    });
+}
+
 bool MKLDNNFullyConnectedNode::created() const {
     return getType() == FullyConnected;
 }
@@ -18,7 +18,10 @@ public:
     ~MKLDNNFullyConnectedNode() override = default;
 
     void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
+    void initOptimalPrimitiveDescriptor() override;
     void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
     bool created() const override;
     bool canBeInPlace() const override {
         return false;
@@ -37,6 +40,11 @@ public:
     const mkldnn::memory& getWeights() const;
     const mkldnn::memory& getBias() const;
 
+    // Compressed weights are decompressed by the node itself, so no post operations can be fused
+    bool isWeightsCompressed() const {
+        return weightsCompressed;
+    }
+
 protected:
     std::shared_ptr<mkldnn::primitive_attr> initPrimitiveAttr();
 
@@ -52,6 +60,12 @@ private:
 
     bool withBiases;
     int baseInputsNumber;
+
+    void executeCompressed();
+
+    bool weightsCompressed = false;
+    InferenceEngine::Blob::Ptr compressedWeights, compressedScales;
+    size_t weightsGroupSize = 0;
 };
 
 }  // namespace MKLDNNPlugin
@@ -11,6 +11,7 @@
 #include <cmath>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include "ie_parallel.hpp"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -112,13 +113,35 @@ void MKLDNNGemmNode::getSupportedDescriptors() {
         bOffsets.push_back(0);
     for (unsigned long dim_idx = cOffsets.size(); dim_idx < 2; dim_idx++)
         cOffsets.push_back(0);
+
+    if (canBeExecutedInInt8()) {
+        inputPrecision0 = getCnnLayer()->insData[0].lock()->getPrecision();
+        inputPrecision1 = getCnnLayer()->insData[1].lock()->getPrecision();
+    }
+
+    // dequantization fused by the graph optimizer, per tensor or per output channel
+    dequantizationScales = {1.f};
+    dequantizationShifts = {0.f};
+    for (auto &node : fusedWith) {
+        auto* scaleShiftLayer = dynamic_cast<ScaleShiftLayer*>(node->getCnnLayer().get());
+        if (scaleShiftLayer == nullptr)
+            THROW_IE_EXCEPTION << "Cannot get scale shift layer " << node->getName() << " fused into " << getName();
+
+        const float *scales = scaleShiftLayer->_weights->cbuffer().as<const float *>();
+        dequantizationScales.assign(scales, scales + scaleShiftLayer->_weights->size());
+        if (scaleShiftLayer->_biases != nullptr) {
+            const float *shifts = scaleShiftLayer->_biases->cbuffer().as<const float *>();
+            dequantizationShifts.assign(shifts, shifts + scaleShiftLayer->_biases->size());
+        }
+    }
 }
 
 void MKLDNNGemmNode::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
-    auto inputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(InferenceEngine::Precision::FP32);
+    auto inputDataType0 = MKLDNNExtensionUtils::IEPrecisionToDataType(inputPrecision0);
+    auto inputDataType1 = MKLDNNExtensionUtils::IEPrecisionToDataType(inputPrecision1);
     auto outputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(InferenceEngine::Precision::FP32);
 
     auto same = [&] (memory::format fmt) -> PrimitiveDescInfo {
@@ -128,7 +151,7 @@ void MKLDNNGemmNode::initSupportedPrimitiveDescriptors() {
             InferenceEngine::DataConfig dataConfig;
             dataConfig.inPlace = -1;
             dataConfig.constant = false;
-            dataConfig.desc = MKLDNNMemoryDesc(getParentEdgeAt(i)->getDims(), inputDataType, fmt);
+            dataConfig.desc = MKLDNNMemoryDesc(getParentEdgeAt(i)->getDims(), i == 1 ? inputDataType1 : inputDataType0, fmt);
             config.inConfs.push_back(dataConfig);
         }
 
@@ -158,10 +181,10 @@ void MKLDNNGemmNode::initOptimalPrimitiveDescriptor() {
         return;
     }
 
-    // Only FP32 is supported for now
+    // Only FP32 and integer activations are supported for now
     auto& selectedConfig = getSelectedPrimitiveDescriptor()->getConfig();
-    for (auto &inConf : selectedConfig.inConfs) {
-        inConf.desc.setPrecision(Precision::FP32);
+    for (size_t i = 0; i < selectedConfig.inConfs.size(); i++) {
+        selectedConfig.inConfs[i].desc.setPrecision(i == 1 ? inputPrecision1 : inputPrecision0);
     }
 
     for (auto &outConf : selectedConfig.outConfs) {
@@ -185,9 +208,99 @@ void MKLDNNGemmNode::createPrimitive() {
         if (!src2MemPtr || !src2MemPtr->GetPrimitivePtr())
             THROW_IE_EXCEPTION << "Input memory isn't allocated.";
     }
+
+    if (canBeExecutedInInt8()) {
+        auto outDims = getChildEdgeAt(0)->getDims();
+        accumulator.resize(outDims[yAxis] * outDims[xAxis]);
+    }
+}
+
+static inline void gemm_x8s8s32(char transa, char transb, int M, int N, int K, const uint8_t *A, int lda,
+                                const int8_t *B, int ldb, int32_t *C, int ldc) {
+    const int32_t co = 0;
+    mkldnn_gemm_u8s8s32(transa, transb, 'F', M, N, K, 1.f, A, lda, 0, B, ldb, 0, 0.f, C, ldc, &co);
+}
+
+static inline void gemm_x8s8s32(char transa, char transb, int M, int N, int K, const int8_t *A, int lda,
+                                const int8_t *B, int ldb, int32_t *C, int ldc) {
+    const int32_t co = 0;
+    mkldnn_gemm_s8s8s32(transa, transb, 'F', M, N, K, 1.f, A, lda, 0, B, ldb, 0, 0.f, C, ldc, &co);
+}
+
+void MKLDNNGemmNode::dequantize(const int32_t *acc, float *dst, int M, int N, int channel) const {
+    const int nDims = getChildEdgeAt(0)->getDims().ndims();
+    // output channels are the batch of matrices for 4D, the rows for 3D and the columns for 2D output
+    auto valueAt = [&](const std::vector<float> &values, int m, int n) {
+        if (values.size() == 1)
+            return values[0];
+        return values[nDims == 4 ? channel : nDims == 3 ? m : n];
+    };
+
+    parallel_for(M, [&](int m) {
+        for (int n = 0; n < N; n++) {
+            dst[m * N + n] = alpha * static_cast<float>(acc[m * N + n]) * valueAt(dequantizationScales, m, n) +
+                             valueAt(dequantizationShifts, m, n);
+        }
+    });
+}
+
+template <typename T0>
+void MKLDNNGemmNode::executeInt8() {
+    auto inDims0 = getParentEdgeAt(0)->getDims();
+    auto outDims = getChildEdgeAt(0)->getDims();
+
+    auto& srcMemory0 = getParentEdgeAt(0)->getMemory();
+    auto& srcMemory1 = getParentEdgeAt(1)->getMemory();
+    const T0 *src0_ptr = reinterpret_cast<const T0*>(srcMemory0.GetData()) +
+                         srcMemory0.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    const int8_t *src1_ptr = reinterpret_cast<const int8_t*>(srcMemory1.GetData()) +
+                             srcMemory1.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    float *dst_ptr = reinterpret_cast<float*>(getChildEdgeAt(0)->getMemory().GetData()) +
+                     getChildEdgeAt(0)->getMemory().GetDescriptor().data.layout_desc.blocking.offset_padding;
+
+    int MB1 = outDims.ndims() == 4 ? batchToProcess() : 1;
+    int MB2 = outDims.ndims() == 3 ? batchToProcess() : outDims.ndims() > 3 ? outDims[outDims.ndims() - 3] : 1;
+    int M = outDims[yAxis];
+    int N = outDims[xAxis];
+    int K = transposeA ? inDims0[yAxis] : inDims0[xAxis];
+
+    const char transa = transposeA ? 'T' : 'N';
+    const char transb = transposeB ? 'T' : 'N';
+
+    int lda = transposeA ? M : K;
+    int ldb = transposeB ? K : N;
+    int ldc = N;
+
+    for (int b1 = 0; b1 < MB1; b1++) {
+        const T0 *a_ptr = src0_ptr;
+        const int8_t *b_ptr = src1_ptr;
+        float *d_ptr = dst_ptr;
+
+        for (int b2 = 0; b2 < MB2; b2++) {
+            gemm_x8s8s32(transa, transb, M, N, K, a_ptr, lda, b_ptr, ldb, accumulator.data(), ldc);
+            dequantize(accumulator.data(), d_ptr, M, N, b2);
+
+            a_ptr += aOffsets[0];
+            b_ptr += bOffsets[0];
+            d_ptr += M * N;
+        }
+
+        src0_ptr += aOffsets[1];
+        src1_ptr += bOffsets[1];
+        dst_ptr += MB2 * M * N;
+    }
 }
 
 void MKLDNNGemmNode::execute(mkldnn::stream strm) {
+    if (canBeExecutedInInt8()) {
+        if (inputPrecision0 == Precision::U8) {
+            executeInt8<uint8_t>();
+        } else {
+            executeInt8<int8_t>();
+        }
+        return;
+    }
+
     auto inDims0 = getParentEdgeAt(0)->getDims();
     auto inDims1 = getParentEdgeAt(1)->getDims();
     auto outDims = getChildEdgeAt(0)->getDims();
@@ -260,6 +373,16 @@ bool MKLDNNGemmNode::created() const {
     return getType() == Gemm;
 }
 
+bool MKLDNNGemmNode::canBeExecutedInInt8() const {
+    const auto& insData = getCnnLayer()->insData;
+    if (insData.size() != 2)
+        return false;
+
+    const auto precision0 = insData[0].lock()->getPrecision();
+    const auto precision1 = insData[1].lock()->getPrecision();
+    return (precision0 == Precision::U8 || precision0 == Precision::I8) && precision1 == Precision::I8;
+}
+
 int MKLDNNGemmNode::getMaxBatch() {
     if (!outDims.empty())
         return outDims[0][0];
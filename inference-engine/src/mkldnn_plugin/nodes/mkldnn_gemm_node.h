@@ -24,7 +24,15 @@ public:
     bool created() const override;
     int getMaxBatch() override;
 
+    // Gemm of U8/I8 by I8 activations is executed in integer arithmetic, the output is dequantized to FP32
+    bool canBeExecutedInInt8() const;
+
 private:
+    template <typename T0>
+    void executeInt8();
+    // Applies alpha and fused dequantization to the integer result of the matrix of output channel `channel`
+    void dequantize(const int32_t *acc, float *dst, int M, int N, int channel) const;
+
     float alpha = 1.0f;
     float beta = 1.0f;
     bool transposeA = false;
@@ -38,6 +46,12 @@ private:
     std::vector<int> aOffsets;
     std::vector<int> bOffsets;
     std::vector<int> cOffsets;
+
+    InferenceEngine::Precision inputPrecision0 = InferenceEngine::Precision::FP32;
+    InferenceEngine::Precision inputPrecision1 = InferenceEngine::Precision::FP32;
+    std::vector<float> dequantizationScales;
+    std::vector<float> dequantizationShifts;
+    std::vector<int32_t> accumulator;
 };
 
 }  // namespace MKLDNNPlugin
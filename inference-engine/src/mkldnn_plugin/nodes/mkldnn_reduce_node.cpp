@@ -0,0 +1,1052 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_reduce_node.h"
+#include "desc_iterator.hpp"
+#include "mkldnn_depthwise_node.h"
+#include "mkldnn_activation_node.h"
+#include <ie_layers.h>
+#include <mkldnn.hpp>
+#include <string>
+#include <vector>
+#include <cmath>
+#include <cfloat>
+#include <numeric>
+#include <limits>
+#include <mkldnn_types.h>
+#include <mkldnn_extension_utils.h>
+#include <ie_layers_internal.hpp>
+#include "ie_parallel.hpp"
+#include <algorithm>
+
+#include "jit_generator.hpp"
+#include "jit_uni_eltwise.hpp"
+#include "jit_uni_depthwise.hpp"
+
+using namespace mkldnn;
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu;
+using namespace mkldnn::impl::utils;
+using namespace Xbyak;
+
+#define GET_OFF(field) offsetof(jit_reduce_call_args, field)
+
+static float reduce_init_value(ReduceMode mode) {
+    switch (mode) {
+        case ReduceMode::And:
+        case ReduceMode::Prod:
+            return 1.f;
+        case ReduceMode::Max:
+            return -FLT_MAX;
+        case ReduceMode::Min:
+            return FLT_MAX;
+        default:
+            return 0.f;
+    }
+}
+
+// dst = op(dst, f(src)), where f is abs/square/exp for L1/L2,SumSquare/LogSumExp
+template <cpu_isa_t isa>
+struct jit_uni_reduce_kernel_f32 : public jit_uni_reduce_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_reduce_kernel_f32)
+
+    explicit jit_uni_reduce_kernel_f32(jit_reduce_config_params jcp) : jit_uni_reduce_kernel(jcp), jit_generator() {
+        if (jcp_.reduce_mode == ReduceMode::LogSumExp)
+            exp_injector.reset(new jit_uni_eltwise_injector_f32<isa>(this, alg_kind::eltwise_exp, 0.f, 0.f));
+
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+        mov(reg_reduce_w, ptr[reg_params + GET_OFF(reduce_w)]);
+        mov(reg_table, l_table);
+
+        Xbyak::Label reduce_lanes_label;
+        Xbyak::Label exit_label;
+
+        cmp(reg_reduce_w, 0);
+        jne(reduce_lanes_label, T_NEAR);
+
+        // dst row is updated lane by lane
+        {
+            Xbyak::Label loop_label;
+            Xbyak::Label loop_end_label;
+
+            L(loop_label);
+            {
+                cmp(reg_work_amount, 0);
+                jle(loop_end_label, T_NEAR);
+
+                load_vector(vmm_src, ptr[reg_src]);
+                uni_vmovups(vmm_dst, ptr[reg_dst]);
+                combine_vector(vmm_dst, vmm_src);
+                uni_vmovups(ptr[reg_dst], vmm_dst);
+
+                add(reg_src, vlen);
+                add(reg_dst, vlen);
+                sub(reg_work_amount, 1);
+
+                jmp(loop_label, T_NEAR);
+            }
+            L(loop_end_label);
+
+            jmp(exit_label, T_NEAR);
+        }
+
+        // all lanes of the row are reduced into dst[0]; independent accumulators hide the latency of the reduction op
+        L(reduce_lanes_label);
+        {
+            for (int i = 0; i < unroll; i++)
+                uni_vbroadcastss(Vmm(vmm_acc_idx + i), ptr[reg_table]);
+
+            Xbyak::Label unrolled_loop_label;
+            Xbyak::Label unrolled_loop_end_label;
+            Xbyak::Label loop_label;
+            Xbyak::Label loop_end_label;
+
+            L(unrolled_loop_label);
+            {
+                cmp(reg_work_amount, unroll);
+                jl(unrolled_loop_end_label, T_NEAR);
+
+                for (int i = 0; i < unroll; i++) {
+                    load_vector(vmm_src, ptr[reg_src + i * vlen]);
+                    combine_vector(Vmm(vmm_acc_idx + i), vmm_src);
+                }
+
+                add(reg_src, unroll * vlen);
+                sub(reg_work_amount, unroll);
+
+                jmp(unrolled_loop_label, T_NEAR);
+            }
+            L(unrolled_loop_end_label);
+
+            L(loop_label);
+            {
+                cmp(reg_work_amount, 0);
+                jle(loop_end_label, T_NEAR);
+
+                load_vector(vmm_src, ptr[reg_src]);
+                combine_vector(Vmm(vmm_acc_idx), vmm_src);
+
+                add(reg_src, vlen);
+                sub(reg_work_amount, 1);
+
+                jmp(loop_label, T_NEAR);
+            }
+            L(loop_end_label);
+
+            for (int i = 1; i < unroll; i++)
+                combine_vector(Vmm(vmm_acc_idx), Vmm(vmm_acc_idx + i));
+
+            horiz_reduce_store(Vmm(vmm_acc_idx));
+        }
+
+        L(exit_label);
+
+        this->postamble();
+
+        if (exp_injector)
+            exp_injector->prepare_table();
+
+        prepare_table();
+
+        ker_ = (decltype(ker_)) this->getCode();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == cpu::sse42, Xbyak::Xmm, isa == cpu::avx2,
+            Xbyak::Ymm, Xbyak::Zmm>::type;
+
+    const int vlen = cpu_isa_traits<isa>::vlen;
+    static const int unroll = 4;
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_dst = r9;
+    Xbyak::Reg64 reg_work_amount = r10;
+    Xbyak::Reg64 reg_reduce_w = r11;
+    Xbyak::Reg64 reg_table = r12;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_src = Vmm(0);
+    Vmm vmm_dst = Vmm(1);
+    Vmm vmm_aux = Vmm(2);
+    const int vmm_acc_idx = 3;  // 3..3 + unroll - 1
+    Xbyak::Xmm xmm_aux1 = Xbyak::Xmm(7);
+    Xbyak::Xmm xmm_aux2 = Xbyak::Xmm(8);
+    Xbyak::Xmm xmm_aux3 = Xbyak::Xmm(9);
+
+    Xbyak::Label l_table;
+
+    std::shared_ptr<jit_uni_eltwise_injector_f32<isa>> exp_injector;
+
+    inline void load_vector(Vmm vmm_val, const Xbyak::Address &op) {
+        uni_vmovups(vmm_val, op);
+
+        switch (jcp_.reduce_mode) {
+            case ReduceMode::L1:
+                uni_vpxor(vmm_aux, vmm_aux, vmm_aux);
+                uni_vsubps(vmm_aux, vmm_aux, vmm_val);
+                uni_vmaxps(vmm_val, vmm_val, vmm_aux);
+                break;
+            case ReduceMode::L2:
+            case ReduceMode::SumSquare:
+                uni_vmulps(vmm_val, vmm_val, vmm_val);
+                break;
+            case ReduceMode::LogSumExp:
+                exp_injector->compute_vector_range(vmm_val.getIdx(), vmm_val.getIdx() + 1);
+                break;
+            default:
+                break;
+        }
+    }
+
+    inline void combine_vector(Vmm vmm_acc, Vmm vmm_val) {
+        switch (jcp_.reduce_mode) {
+            case ReduceMode::Max:
+                uni_vmaxps(vmm_acc, vmm_acc, vmm_val);
+                break;
+            case ReduceMode::Min:
+                uni_vminps(vmm_acc, vmm_acc, vmm_val);
+                break;
+            case ReduceMode::Prod:
+                uni_vmulps(vmm_acc, vmm_acc, vmm_val);
+                break;
+            default:
+                uni_vaddps(vmm_acc, vmm_acc, vmm_val);
+                break;
+        }
+    }
+
+    inline void combine_xmm(Xbyak::Xmm xmm_dst, Xbyak::Xmm xmm_src) {
+        switch (jcp_.reduce_mode) {
+            case ReduceMode::Max:
+                maxps(xmm_dst, xmm_src);
+                break;
+            case ReduceMode::Min:
+                minps(xmm_dst, xmm_src);
+                break;
+            case ReduceMode::Prod:
+                mulps(xmm_dst, xmm_src);
+                break;
+            default:
+                addps(xmm_dst, xmm_src);
+                break;
+        }
+    }
+
+    inline void horiz_reduce_store(Vmm vmm_acc) {
+        if (isa == cpu::sse42) {
+            movups(xmm_aux1, Xbyak::Xmm(vmm_acc.getIdx()));
+        } else if (isa == cpu::avx2) {
+            Xbyak::Ymm ymm_acc = Xbyak::Ymm(vmm_acc.getIdx());
+            vextractf128(xmm_aux1, ymm_acc, 0);
+            vextractf128(xmm_aux2, ymm_acc, 1);
+            combine_xmm(xmm_aux1, xmm_aux2);
+        } else {
+            Xbyak::Zmm zmm_acc = Xbyak::Zmm(vmm_acc.getIdx());
+            vextractf32x4(xmm_aux1, zmm_acc, 0);
+            vextractf32x4(xmm_aux2, zmm_acc, 1);
+            combine_xmm(xmm_aux1, xmm_aux2);
+            vextractf32x4(xmm_aux2, zmm_acc, 2);
+            vextractf32x4(xmm_aux3, zmm_acc, 3);
+            combine_xmm(xmm_aux2, xmm_aux3);
+            combine_xmm(xmm_aux1, xmm_aux2);
+        }
+
+        movshdup(xmm_aux3, xmm_aux1);  //  acc:1,2,3,4; aux3:2,2,4,4
+        combine_xmm(xmm_aux1, xmm_aux3);  //  acc:1+2,2+2,3+4,4+4
+        movhlps(xmm_aux3, xmm_aux1);   //  aux3:3+4,4+4,4,4
+        combine_xmm(xmm_aux1, xmm_aux3);  //  acc:1+2+3+4,...
+
+        movss(xmm_aux3, ptr[reg_dst]);
+        combine_xmm(xmm_aux1, xmm_aux3);
+        movss(ptr[reg_dst], xmm_aux1);
+    }
+
+    void prepare_table() {
+        union {
+            float f;
+            uint32_t i;
+        } init_value;
+        init_value.f = reduce_init_value(jcp_.reduce_mode);
+
+        align(64);
+        L(l_table);
+        dd(init_value.i);
+    }
+};
+
+// Mean/L2 finalization followed by fused post operations, applied in place on dst
+template <cpu_isa_t isa>
+struct jit_uni_reduce_post_kernel_f32 : public jit_uni_reduce_post_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_reduce_post_kernel_f32)
+
+    explicit jit_uni_reduce_post_kernel_f32(jit_reduce_config_params jcp, const mkldnn_primitive_attr &attr)
+    : jit_uni_reduce_post_kernel(jcp, attr), jit_generator() {
+        const auto &p = attr_.post_ops_;
+        for (int i = 0; i < p.len_; i++) {
+            auto &post_op = p.entry_[i];
+            if (post_op.is_eltwise()) {
+                eltwise_injectors.push_back(std::make_shared<jit_uni_eltwise_injector_f32<isa>>(
+                        this, post_op.eltwise.alg, post_op.eltwise.alpha, post_op.eltwise.beta));
+            } else if (post_op.is_depthwise()) {
+                depthwise_injectors.push_back(std::make_shared<jit_uni_depthwise_injector_f32<isa>>(
+                        this, post_op.depthwise.alg));
+            }
+        }
+
+        this->preamble();
+
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+        if (jcp_.reduce_mode == ReduceMode::Mean) {
+            mov(reg_divisor, ptr[reg_params + GET_OFF(divisor)]);
+            uni_vbroadcastss(vmm_divisor, ptr[reg_divisor]);
+        }
+        if (attr_.post_ops_.len_ != 0)
+            mov(reg_oc_off, ptr[reg_params + GET_OFF(oc_off)]);
+
+        // in blocked layout one spatial position holds a channel block, which is 8 channels on cpu::sse42 too
+        int repeats = (!jcp_.planar_layout && isa == cpu::sse42) ? 2 : 1;
+
+        Xbyak::Label loop_label;
+        Xbyak::Label loop_end_label;
+
+        L(loop_label);
+        {
+            cmp(reg_work_amount, 0);
+            jle(loop_end_label, T_NEAR);
+
+            for (int i = 0; i < repeats; i++) {
+                uni_vmovups(vmm_dst, ptr[reg_dst + i * vlen]);
+
+                if (jcp_.reduce_mode == ReduceMode::Mean)
+                    uni_vmulps(vmm_dst, vmm_dst, vmm_divisor);
+                else if (jcp_.reduce_mode == ReduceMode::L2)
+                    uni_vsqrtps(vmm_dst, vmm_dst);
+
+                apply_post_ops(i * vlen);
+
+                uni_vmovups(ptr[reg_dst + i * vlen], vmm_dst);
+            }
+
+            add(reg_dst, repeats * vlen);
+            sub(reg_work_amount, 1);
+
+            jmp(loop_label, T_NEAR);
+        }
+        L(loop_end_label);
+
+        this->postamble();
+
+        for (auto& inj : eltwise_injectors)
+            inj->prepare_table();
+
+        ker_ = (decltype(ker_)) this->getCode();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == cpu::sse42, Xbyak::Xmm, isa == cpu::avx2,
+            Xbyak::Ymm, Xbyak::Zmm>::type;
+
+    const int vlen = cpu_isa_traits<isa>::vlen;
+
+    Xbyak::Reg64 reg_dst = r8;
+    Xbyak::Reg64 reg_work_amount = r9;
+    Xbyak::Reg64 reg_divisor = r10;
+    Xbyak::Reg64 reg_oc_off = r11;
+    Xbyak::Reg64 reg_d_weights = r12;
+    Xbyak::Reg64 reg_d_bias = r13;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_dst = Vmm(0);
+    Vmm vmm_divisor = Vmm(1);
+
+    std::vector<std::shared_ptr<jit_uni_eltwise_injector_f32<isa>>> eltwise_injectors;
+    std::vector<std::shared_ptr<jit_uni_depthwise_injector_f32<isa>>> depthwise_injectors;
+
+    void apply_post_ops(int oc_shift) {
+        const auto &p = attr_.post_ops_;
+        int eltwise_inj_idx = 0;
+        int depthwise_inj_idx = 0;
+        for (int i = 0; i < p.len_; i++) {
+            auto& post_op = p.entry_[i];
+            if (post_op.is_eltwise()) {
+                eltwise_injectors[eltwise_inj_idx]->compute_vector_range(vmm_dst.getIdx(), vmm_dst.getIdx() + 1);
+                eltwise_inj_idx++;
+            } else if (post_op.is_depthwise()) {
+                mov(reg_d_weights, reinterpret_cast<size_t>(post_op.depthwise.weights_data) + oc_shift);
+                mov(reg_d_bias, reinterpret_cast<size_t>(post_op.depthwise.biases_data) + oc_shift);
+                add(reg_d_weights, reg_oc_off);
+                add(reg_d_bias, reg_oc_off);
+                depthwise_injectors[depthwise_inj_idx]->compute_vector_range(vmm_dst.getIdx(), vmm_dst.getIdx() + 1, reg_d_weights, reg_d_bias);
+                depthwise_inj_idx++;
+            }
+        }
+    }
+};
+//////////////////////////////////////////////////////////////////////////////////
+
+MKLDNNReduceNode::MKLDNNReduceNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache)
+        : MKLDNNNode(layer, eng, cache) {}
+
+void MKLDNNReduceNode::getSupportedDescriptors() {
+    if (!descs.empty())
+        return;
+
+    if (getParentEdges().size() != 2)
+        THROW_IE_EXCEPTION << "Incorrect number of input edges for layer " << getName();
+    if (getChildEdges().empty())
+        THROW_IE_EXCEPTION << "Incorrect number of output edges for layer " << getName();
+
+    if (getParentEdgeAt(REDUCE_INDEXES)->getDims().ndims() != 1)
+        THROW_IE_EXCEPTION << "Reduce layer with name '" << getName() << "' gets incorrect index vector dimension! Index vector should be 1 dimension.";
+
+    auto *layer = getCnnLayer().get();
+    keep_dims = layer->GetParamAsBool("keep_dims", true);
+    if (keep_dims) {
+        if (getParentEdgeAt(REDUCE_DATA)->getDims().ndims() != getChildEdgeAt(0)->getDims().ndims())
+            THROW_IE_EXCEPTION << "Reduce layer with name '" << getName() << "' gets incorrect number of input/output dimensions!";
+    } else {
+        if (getParentEdgeAt(REDUCE_DATA)->getDims().ndims() <= getChildEdgeAt(0)->getDims().ndims())
+            THROW_IE_EXCEPTION << "Reduce layer with name '" << getName() << "' gets incorrect number of input/output dimensions!";
+    }
+
+    const std::string& reduce_mode = layer->type;
+    if (reduce_mode == "ReduceAnd") reduceMode = ReduceMode::And;
+    else if (reduce_mode == "ReduceL1") reduceMode = ReduceMode::L1;
+    else if (reduce_mode == "ReduceL2") reduceMode = ReduceMode::L2;
+    else if (reduce_mode == "ReduceLogSum") reduceMode = ReduceMode::LogSum;
+    else if (reduce_mode == "ReduceLogSumExp") reduceMode = ReduceMode::LogSumExp;
+    else if (reduce_mode == "ReduceMax") reduceMode = ReduceMode::Max;
+    else if (reduce_mode == "ReduceMean") reduceMode = ReduceMode::Mean;
+    else if (reduce_mode == "ReduceMin") reduceMode = ReduceMode::Min;
+    else if (reduce_mode == "ReduceOr") reduceMode = ReduceMode::Or;
+    else if (reduce_mode == "ReduceProd") reduceMode = ReduceMode::Prod;
+    else if (reduce_mode == "ReduceSum") reduceMode = ReduceMode::Sum;
+    else if (reduce_mode == "ReduceSumSquare") reduceMode = ReduceMode::SumSquare;
+    else
+        THROW_IE_EXCEPTION << "Reduce layer with name '" << getName() << "' gets incorrect Reduce layer type!";
+}
+
+std::vector<int32_t> MKLDNNReduceNode::getConstAxes() const {
+    std::vector<int32_t> axes;
+    auto parentLayer = getParentEdgeAt(REDUCE_INDEXES)->getParent()->getCnnLayer();
+    if (!parentLayer || parentLayer->type != "Const" || parentLayer->blobs.find("custom") == parentLayer->blobs.end())
+        return axes;
+
+    auto axesBlob = parentLayer->blobs["custom"];
+    if (axesBlob->getTensorDesc().getPrecision() == Precision::I32) {
+        auto data = axesBlob->cbuffer().as<const int32_t *>();
+        axes.assign(data, data + axesBlob->size());
+    } else if (axesBlob->getTensorDesc().getPrecision() == Precision::I64) {
+        auto data = axesBlob->cbuffer().as<const int64_t *>();
+        for (size_t i = 0; i < axesBlob->size(); i++)
+            axes.push_back(static_cast<int32_t>(data[i]));
+    }
+    return axes;
+}
+
+bool MKLDNNReduceNode::canUseBlockedLayout() const {
+    const size_t rank = getParentEdgeAt(REDUCE_DATA)->getDims().ndims();
+    if (rank != 4 && rank != 5)
+        return false;
+    if (!getCnnLayer()->GetParamAsBool("keep_dims", true))
+        return false;
+
+    auto axes = getConstAxes();
+    if (axes.empty())
+        return false;
+    for (auto axis : axes) {
+        if (axis < 0)
+            axis += rank;
+        if (axis == 1)
+            return false;
+    }
+    return true;
+}
+
+bool MKLDNNReduceNode::canFuse() const {
+    const std::string& type = getCnnLayer()->type;
+    if (type != "ReduceL1" && type != "ReduceL2" && type != "ReduceMax" && type != "ReduceMean" &&
+        type != "ReduceMin" && type != "ReduceProd" && type != "ReduceSum" && type != "ReduceSumSquare")
+        return false;
+
+    auto inputPrecision = getCnnLayer()->insData[REDUCE_DATA].lock()->getPrecision();
+    return (inputPrecision == Precision::FP32 || inputPrecision == Precision::BF16) &&
+           getChildEdges().size() == 1 && mayiuse(cpu::sse42) && canUseBlockedLayout();
+}
+
+void MKLDNNReduceNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    setPostOps(attr, true);
+
+    Precision inputPrecision = getCnnLayer()->insData[REDUCE_DATA].lock()->getPrecision();
+    Precision outputPrecision = getCnnLayer()->outData[0]->getPrecision();
+
+    if (!fusedWith.empty()) {
+        auto lastFusedLayer = fusedWith[fusedWith.size() - 1].get()->getCnnLayer();
+        if (lastFusedLayer) {
+            outputPrecision = lastFusedLayer->outData[0]->getPrecision();
+        }
+    }
+
+    if (inputPrecision == Precision::BF16)
+        inputPrecision = Precision::FP32;
+    if (outputPrecision == Precision::BF16)
+        outputPrecision = Precision::FP32;
+
+    // combinations supported by the reference path, everything else is computed in FP32
+    auto isSupported = [](Precision in, Precision out) {
+        return (in == Precision::FP32 && (out == Precision::FP32 || out == Precision::U8)) ||
+               (in == Precision::I32 && (out == Precision::I32 || out == Precision::FP32)) ||
+               (in == Precision::U8 && (out == Precision::U8 || out == Precision::FP32));
+    };
+    if (!isSupported(inputPrecision, outputPrecision) || !fusedWith.empty()) {
+        inputPrecision = Precision::FP32;
+        outputPrecision = Precision::FP32;
+    }
+
+    input_prec = inputPrecision;
+    output_prec = outputPrecision;
+
+    auto inputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(inputPrecision);
+    auto outputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(outputPrecision);
+
+    InferenceEngine::LayerConfig config;
+    config.dynBatchSupport = false;
+    config.inConfs.resize(2);
+    config.outConfs.resize(1);
+    config.inConfs[REDUCE_DATA].constant = false;
+    config.inConfs[REDUCE_INDEXES].constant = false;
+    config.outConfs[0].constant = false;
+    config.inConfs[REDUCE_DATA].inPlace = -1;
+    config.inConfs[REDUCE_INDEXES].inPlace = -1;
+    config.outConfs[0].inPlace = -1;
+    config.inConfs[REDUCE_INDEXES].desc = MKLDNNMemoryDesc(getParentEdgeAt(REDUCE_INDEXES)->getDims(), memory::s32, memory::x);
+
+    if (inputPrecision == Precision::FP32 && outputPrecision == Precision::FP32 &&
+        mayiuse(cpu::sse42) && canUseBlockedLayout()) {
+        memory::format format;
+        if (getParentEdgeAt(REDUCE_DATA)->getDims().ndims() == 4)
+            format = mayiuse(cpu::avx512_common) ? memory::nChw16c : memory::nChw8c;
+        else
+            format = mayiuse(cpu::avx512_common) ? memory::nCdhw16c : memory::nCdhw8c;
+
+        config.inConfs[REDUCE_DATA].desc = MKLDNNMemoryDesc(getParentEdgeAt(REDUCE_DATA)->getDims(), inputDataType, format);
+        config.outConfs[0].desc = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDataType, format);
+        supportedPrimitiveDescriptors.push_back({config, impl_desc_type::unknown, format});
+    }
+
+    if (fusedWith.empty()) {
+        auto planarDesc = [](Precision precision, const MKLDNNDims& dims) {
+            SizeVector blocks = dims.ToSizeVector();
+            SizeVector order(blocks.size());
+            std::iota(order.begin(), order.end(), 0);
+            return TensorDesc(precision, blocks, {blocks, order});
+        };
+
+        config.inConfs[REDUCE_DATA].desc = planarDesc(inputPrecision, getParentEdgeAt(REDUCE_DATA)->getDims());
+        config.outConfs[0].desc = planarDesc(outputPrecision, getChildEdgeAt(0)->getDims());
+        supportedPrimitiveDescriptors.push_back({config, impl_desc_type::unknown,
+                                                 MKLDNNMemory::Convert(config.outConfs[0].desc.getLayout())});
+    }
+}
+
+void MKLDNNReduceNode::createPrimitive() {
+    auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    auto& srcMemPtr = getParentEdgeAt(REDUCE_DATA)->getMemoryPtr();
+    auto& idxMemPtr = getParentEdgeAt(REDUCE_INDEXES)->getMemoryPtr();
+    if (!dstMemPtr || !dstMemPtr->GetPrimitivePtr())
+        THROW_IE_EXCEPTION << "Destination memory didn't allocate.";
+    if (!srcMemPtr || !srcMemPtr->GetPrimitivePtr())
+        THROW_IE_EXCEPTION << "Input memory didn't allocate.";
+    if (!idxMemPtr || !idxMemPtr->GetPrimitivePtr())
+        THROW_IE_EXCEPTION << "Axes memory didn't allocate.";
+    if (getSelectedPrimitiveDescriptor() == nullptr)
+        THROW_IE_EXCEPTION << "Preferable primitive descriptor is not set.";
+
+    auto selectedPD = getSelectedPrimitiveDescriptor();
+    const auto& srcDesc = selectedPD->getConfig().inConfs[REDUCE_DATA].desc;
+    planar_layout = srcDesc.getBlockingDesc().getOrder().size() == srcDesc.getDims().size();
+    blk_size = planar_layout ? 1 : srcDesc.getBlockingDesc().getBlockDims().back();
+
+    auto jcp = jit_reduce_config_params();
+    jcp.src_dt = MKLDNNExtensionUtils::IEPrecisionToDataType(srcDesc.getPrecision());
+    jcp.dst_dt = MKLDNNExtensionUtils::IEPrecisionToDataType(selectedPD->getConfig().outConfs[0].desc.getPrecision());
+    jcp.src_data_size = MKLDNNExtensionUtils::sizeOfDataType(jcp.src_dt);
+    jcp.dst_data_size = MKLDNNExtensionUtils::sizeOfDataType(jcp.dst_dt);
+    jcp.planar_layout = planar_layout;
+    jcp.reduce_mode = reduceMode;
+
+    // logical reductions and integer data are handled by the reference code
+    if (jcp.src_dt != memory::f32 || jcp.dst_dt != memory::f32 ||
+        reduceMode == ReduceMode::And || reduceMode == ReduceMode::Or)
+        return;
+
+    // log is applied by the reference code, so LogSum/LogSumExp never get the post kernel
+    bool needPostKernel = reduceMode == ReduceMode::Mean || reduceMode == ReduceMode::L2 || !fusedWith.empty();
+
+    if (mayiuse(cpu::avx512_common)) {
+        vec_size = 16;
+        reduce_kernel.reset(new jit_uni_reduce_kernel_f32<cpu::avx512_common>(jcp));
+        if (needPostKernel)
+            reduce_post_kernel.reset(new jit_uni_reduce_post_kernel_f32<cpu::avx512_common>(jcp, *attr.get()));
+    } else if (mayiuse(cpu::avx2)) {
+        vec_size = 8;
+        reduce_kernel.reset(new jit_uni_reduce_kernel_f32<cpu::avx2>(jcp));
+        if (needPostKernel)
+            reduce_post_kernel.reset(new jit_uni_reduce_post_kernel_f32<cpu::avx2>(jcp, *attr.get()));
+    } else if (mayiuse(cpu::sse42)) {
+        vec_size = 4;
+        reduce_kernel.reset(new jit_uni_reduce_kernel_f32<cpu::sse42>(jcp));
+        if (needPostKernel)
+            reduce_post_kernel.reset(new jit_uni_reduce_post_kernel_f32<cpu::sse42>(jcp, *attr.get()));
+    }
+}
+
+void MKLDNNReduceNode::setPostOps(mkldnn::primitive_attr &attr, bool initWeights) {
+    int blob_idx = 0;
+    mkldnn::post_ops ops;
+
+    for (auto &node : fusedWith) {
+        auto* depthwiseNode = dynamic_cast<MKLDNNDepthwiseNode *>(node.get());
+        if (depthwiseNode) {
+            if (initWeights) {
+                auto* depthwiseLayer = reinterpret_cast<WeightableLayer*>(depthwiseNode->getCnnLayer().get());
+                MKLDNNDims depthwiseDims({static_cast<ptrdiff_t>(rnd_up(getChildEdgeAt(0)->getDims()[1], 16))});
+
+                PostOpsIntBlobMemory.push_back(MKLDNNMemoryPtr(new MKLDNNMemory(getEngine())));
+                PostOpsIntBlobMemory[blob_idx]->Create(depthwiseDims, memory::data_type::f32, memory::format::x);
+
+                PostOpsIntBlobMemory[blob_idx]->SetData(memory::data_type::f32, memory::x,
+                                                        depthwiseLayer->_weights->buffer(),
+                                                        depthwiseLayer->_weights->size() *
+                                                        MKLDNNExtensionUtils::sizeOfDataType(memory::data_type::f32));
+
+                if (depthwiseNode->isBroadcast()) {
+                    float broadcastValue = static_cast<float *>(PostOpsIntBlobMemory[blob_idx]->GetData())[0];
+                    for (int i = 1; i < PostOpsIntBlobMemory[blob_idx]->GetPrimitiveDescriptor().desc().data.dims[0]; i++) {
+                        static_cast<float *>(PostOpsIntBlobMemory[blob_idx]->GetData())[i] = broadcastValue;
+                    }
+                }
+
+                if (depthwiseNode->getAlgorithm() == depthwise_scale_shift) {
+                    PostOpsIntBlobMemory.push_back(MKLDNNMemoryPtr(new MKLDNNMemory(getEngine())));
+                    PostOpsIntBlobMemory[blob_idx + 1]->Create(depthwiseDims, memory::data_type::f32,
+                                                               memory::format::x);
+                    PostOpsIntBlobMemory[blob_idx + 1]->SetData(memory::data_type::f32, memory::x,
+                                                                depthwiseLayer->_biases->buffer(),
+                                                                depthwiseLayer->_biases->size() *
+                                                                MKLDNNExtensionUtils::sizeOfDataType(memory::data_type::f32));
+
+                    if (depthwiseNode->isBroadcast()) {
+                        float broadcastValue = static_cast<float *>(PostOpsIntBlobMemory[blob_idx + 1]->GetData())[0];
+                        for (int i = 1; i < PostOpsIntBlobMemory[blob_idx + 1]->GetPrimitiveDescriptor().desc().data.dims[0]; i++) {
+                            static_cast<float *>(PostOpsIntBlobMemory[blob_idx + 1]->GetData())[i] = broadcastValue;
+                        }
+                    }
+
+                    ops.append_depthwise(depthwiseNode->getAlgorithm(),
+                                         (const float *) PostOpsIntBlobMemory[blob_idx]->GetData(),
+                                         (const float *) PostOpsIntBlobMemory[blob_idx + 1]->GetData());
+
+                    blob_idx += 2;
+                } else {
+                    ops.append_depthwise(depthwiseNode->getAlgorithm(),
+                                         (const float *) PostOpsIntBlobMemory[blob_idx]->GetData(),
+                                         nullptr);
+
+                    blob_idx += 1;
+                }
+            } else {
+                ops.append_depthwise(depthwiseNode->getAlgorithm(),
+                                     nullptr,
+                                     nullptr);
+            }
+
+            continue;
+        }
+
+        auto* activationNode = dynamic_cast<MKLDNNActivationNode *>(node.get());
+        if (activationNode) {
+            ops.append_eltwise(1.0, activationNode->getAlgorithm(), activationNode->getAlpha(), activationNode->getBeta());
+
+            continue;
+        }
+
+        THROW_IE_EXCEPTION << "Fusing of " << NameFromType(node->getType()) << " operation to " << NameFromType(this->getType()) << " node is not implemented";
+    }
+
+    attr.set_post_ops(ops);
+}
+
+void MKLDNNReduceNode::execute(mkldnn::stream strm) {
+    auto &dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    auto &srcMemPtr = getParentEdgeAt(REDUCE_DATA)->getMemoryPtr();
+    auto &idxMemPtr = getParentEdgeAt(REDUCE_INDEXES)->getMemoryPtr();
+
+    const auto idx_data = reinterpret_cast<const int32_t *>(idxMemPtr->GetData());
+    const size_t axes_size = getParentEdgeAt(REDUCE_INDEXES)->getDims()[0];
+
+    const SizeVector src_dims = getParentEdgeAt(REDUCE_DATA)->getDesc().getDims();
+    const size_t rank = src_dims.size();
+
+    std::vector<bool> is_reduced(rank, false);
+    for (size_t i = 0; i < axes_size; i++) {
+        int32_t axis = idx_data[i];
+        if (axis < 0)
+            axis += static_cast<int32_t>(rank);
+        if (axis < 0 || static_cast<size_t>(axis) >= rank)
+            THROW_IE_EXCEPTION << "Reduce layer with name '" << getName() << "' gets index to reduce which exceeds data tensor dimension";
+        is_reduced[axis] = true;
+    }
+
+    SizeVector out_dims;
+    size_t reduced_size = 1;
+    for (size_t i = 0; i < rank; i++) {
+        if (is_reduced[i]) {
+            reduced_size *= src_dims[i];
+            if (keep_dims)
+                out_dims.push_back(1);
+        } else {
+            out_dims.push_back(src_dims[i]);
+        }
+    }
+    // scalar output may be represented as a 1D tensor of one element
+    const SizeVector dst_dims = getChildEdgeAt(0)->getDesc().getDims();
+    if (!std::equal(out_dims.begin(), out_dims.begin() + (std::min)(out_dims.size(), dst_dims.size()), dst_dims.begin()))
+        THROW_IE_EXCEPTION << "Reduce layer with name '" << getName() << "' gets incorrect number of output dimensions!";
+
+    // blocked memory is treated as the plain [N, C / blk, (D), H, W, blk] tensor
+    SizeVector dims = src_dims;
+    std::vector<bool> dims_reduced = is_reduced;
+    SizeVector dst_blk_dims;
+    if (!planar_layout) {
+        if (is_reduced[1])
+            THROW_IE_EXCEPTION << "Reduce layer with name '" << getName() << "' can't reduce channels in blocked layout";
+
+        dims[1] = div_up(src_dims[1], blk_size);
+        dims.push_back(blk_size);
+        dims_reduced.push_back(false);
+
+        size_t spatial = 1;
+        for (size_t i = 2; i < rank; i++)
+            spatial *= out_dims[i];
+        dst_blk_dims = {out_dims[0], dims[1], spatial};
+    }
+
+    size_t dst_size = 1;
+    for (size_t i = 0; i < dims.size(); i++) {
+        if (!dims_reduced[i])
+            dst_size *= dims[i];
+    }
+
+    const void *src_data = srcMemPtr->GetData();
+    void *dst_data = dstMemPtr->GetData();
+
+    auto in = input_prec, out = output_prec;
+    if (in == Precision::FP32 && out == Precision::FP32) {
+        reduce_type(static_cast<const float *>(src_data), static_cast<float *>(dst_data), dims, dims_reduced, dst_size);
+        reduce_post(static_cast<float *>(dst_data), dst_size, reduced_size, dst_blk_dims);
+    } else if (in == Precision::FP32 && out == Precision::U8) {
+        reduce_to_u8(static_cast<const float *>(src_data), static_cast<uint8_t *>(dst_data), dims, dims_reduced, dst_size,
+                     reduced_size, dst_blk_dims);
+    } else if (in == Precision::I32 && out == Precision::I32) {
+        reduce_type(static_cast<const int32_t *>(src_data), static_cast<int32_t *>(dst_data), dims, dims_reduced, dst_size);
+        reduce_post(static_cast<int32_t *>(dst_data), dst_size, reduced_size, dst_blk_dims);
+    } else if (in == Precision::I32 && out == Precision::FP32) {
+        reduce_type(static_cast<const int32_t *>(src_data), static_cast<float *>(dst_data), dims, dims_reduced, dst_size);
+        reduce_post(static_cast<float *>(dst_data), dst_size, reduced_size, dst_blk_dims);
+    } else if (in == Precision::U8 && out == Precision::U8) {
+        reduce_to_u8(static_cast<const uint8_t *>(src_data), static_cast<uint8_t *>(dst_data), dims, dims_reduced, dst_size,
+                     reduced_size, dst_blk_dims);
+    } else if (in == Precision::U8 && out == Precision::FP32) {
+        reduce_type(static_cast<const uint8_t *>(src_data), static_cast<float *>(dst_data), dims, dims_reduced, dst_size);
+        reduce_post(static_cast<float *>(dst_data), dst_size, reduced_size, dst_blk_dims);
+    } else {
+        THROW_IE_EXCEPTION << "Reduce layer with name '" << getName() << "' has unsupported input/output precisions";
+    }
+}
+
+template <typename src_t, typename dst_t, typename F>
+static inline void accumulate_row(const src_t *src, dst_t *dst, size_t len, bool reduce_w, F func) {
+    if (reduce_w) {
+        dst_t acc = dst[0];
+        for (size_t i = 0; i < len; i++)
+            acc = func(acc, src[i]);
+        dst[0] = acc;
+    } else {
+        for (size_t i = 0; i < len; i++)
+            dst[i] = func(dst[i], src[i]);
+    }
+}
+
+template <typename src_t, typename dst_t>
+static void reduce_row_ref(ReduceMode mode, const src_t *src, dst_t *dst, size_t len, bool reduce_w) {
+    switch (mode) {
+        case ReduceMode::And:
+            accumulate_row(src, dst, len, reduce_w, [](dst_t x, src_t y)->dst_t { return x && y; });
+            break;
+        case ReduceMode::L1:
+            accumulate_row(src, dst, len, reduce_w, [](dst_t x, src_t y)->dst_t { return x + (std::abs)(y); });
+            break;
+        case ReduceMode::L2:
+        case ReduceMode::SumSquare:
+            accumulate_row(src, dst, len, reduce_w, [](dst_t x, src_t y)->dst_t { return x + y * y; });
+            break;
+        case ReduceMode::LogSumExp:
+            accumulate_row(src, dst, len, reduce_w, [](dst_t x, src_t y)->dst_t { return x + expf(y); });
+            break;
+        case ReduceMode::Max:
+            accumulate_row(src, dst, len, reduce_w, [](dst_t x, src_t y)->dst_t { return x > y ? x : y; });
+            break;
+        case ReduceMode::Min:
+            accumulate_row(src, dst, len, reduce_w, [](dst_t x, src_t y)->dst_t { return x < y ? x : y; });
+            break;
+        case ReduceMode::Or:
+            accumulate_row(src, dst, len, reduce_w, [](dst_t x, src_t y)->dst_t { return x || y; });
+            break;
+        case ReduceMode::Prod:
+            accumulate_row(src, dst, len, reduce_w, [](dst_t x, src_t y)->dst_t { return x * y; });
+            break;
+        default:
+            accumulate_row(src, dst, len, reduce_w, [](dst_t x, src_t y)->dst_t { return x + y; });
+            break;
+    }
+}
+
+template <typename dst_t>
+static dst_t reduce_combine(ReduceMode mode, dst_t x, dst_t y) {
+    switch (mode) {
+        case ReduceMode::And:
+            return x && y;
+        case ReduceMode::Max:
+            return x > y ? x : y;
+        case ReduceMode::Min:
+            return x < y ? x : y;
+        case ReduceMode::Or:
+            return x || y;
+        case ReduceMode::Prod:
+            return x * y;
+        default:
+            return x + y;
+    }
+}
+
+template <typename dst_t>
+static dst_t reduce_init(ReduceMode mode) {
+    switch (mode) {
+        case ReduceMode::And:
+        case ReduceMode::Prod:
+            return static_cast<dst_t>(1);
+        case ReduceMode::Max:
+            return std::numeric_limits<dst_t>::lowest();
+        case ReduceMode::Min:
+            return (std::numeric_limits<dst_t>::max)();
+        default:
+            return static_cast<dst_t>(0);
+    }
+}
+
+template <typename src_t, typename dst_t>
+void MKLDNNReduceNode::reduce_row(const src_t *src, dst_t *dst, size_t len, bool reduce_w) {
+    size_t done = 0;
+    // the kernels exist for fp32 data only
+    if (reduce_kernel && len >= vec_size) {
+        auto arg = jit_reduce_call_args();
+        arg.src = src;
+        arg.dst = dst;
+        arg.work_amount = len / vec_size;
+        arg.reduce_w = reduce_w ? 1 : 0;
+        (*reduce_kernel)(&arg);
+        done = arg.work_amount * vec_size;
+    }
+    if (done < len)
+        reduce_row_ref(reduceMode, src + done, reduce_w ? dst : dst + done, len - done, reduce_w);
+}
+
+template <typename src_t, typename dst_t>
+void MKLDNNReduceNode::reduce_type(const src_t *src_data, dst_t *dst_data, const SizeVector &src_dims,
+                                   const std::vector<bool> &is_reduced, size_t dst_size) {
+    // neighbouring dimensions of the same kind are merged, so any set of axes turns into an alternation
+    // of kept and reduced groups and the innermost group is processed as one contiguous row
+    SizeVector dims;
+    std::vector<bool> reduced;
+    for (size_t i = 0; i < src_dims.size(); i++) {
+        if (src_dims[i] == 1)
+            continue;
+        if (!dims.empty() && reduced.back() == is_reduced[i]) {
+            dims.back() *= src_dims[i];
+        } else {
+            dims.push_back(src_dims[i]);
+            reduced.push_back(is_reduced[i]);
+        }
+    }
+    if (dims.empty()) {
+        dims.push_back(1);
+        reduced.push_back(false);
+    }
+
+    const size_t row_len = dims.back();
+    const bool row_reduced = reduced.back();
+    const size_t dst_row_len = row_reduced ? 1 : row_len;
+
+    // (dim, stride) of the outer groups
+    std::vector<std::pair<size_t, size_t>> kept_groups, reduced_groups;
+    size_t stride = row_len;
+    for (int i = static_cast<int>(dims.size()) - 2; i >= 0; i--) {
+        if (reduced[i])
+            reduced_groups.insert(reduced_groups.begin(), {dims[i], stride});
+        else
+            kept_groups.insert(kept_groups.begin(), {dims[i], stride});
+        stride *= dims[i];
+    }
+
+    size_t outer_work = 1, reduced_work = 1;
+    for (auto &g : kept_groups) outer_work *= g.first;
+    for (auto &g : reduced_groups) reduced_work *= g.first;
+
+    auto offset = [](const std::vector<std::pair<size_t, size_t>> &groups, size_t idx) {
+        size_t off = 0;
+        for (int i = static_cast<int>(groups.size()) - 1; i >= 0; i--) {
+            off += (idx % groups[i].first) * groups[i].second;
+            idx /= groups[i].first;
+        }
+        return off;
+    };
+
+    const dst_t init_value = reduce_init<dst_t>(reduceMode);
+    const size_t nthr = parallel_get_max_threads();
+
+    // a long kept row of a few outputs is split into vector aligned chunks
+    size_t chunk = dst_row_len, chunks_num = 1;
+    if (!row_reduced && outer_work < nthr) {
+        chunk = rnd_up(div_up(row_len, nthr), vec_size);
+        chunks_num = div_up(row_len, chunk);
+    }
+
+    if (outer_work * chunks_num >= nthr || reduced_work == 1) {
+        parallel_for2d(outer_work, chunks_num, [&](size_t o, size_t c) {
+            const size_t start = c * chunk;
+            const size_t len = row_reduced ? row_len : (std::min)(chunk, row_len - start);
+            dst_t *dst = dst_data + o * dst_row_len + (row_reduced ? 0 : start);
+            std::fill(dst, dst + (row_reduced ? 1 : len), init_value);
+
+            const src_t *src = src_data + offset(kept_groups, o) + (row_reduced ? 0 : start);
+            for (size_t r = 0; r < reduced_work; r++)
+                reduce_row(src + offset(reduced_groups, r), dst, len, row_reduced);
+        });
+    } else {
+        // too few outputs to keep all threads busy: every thread reduces its part of the reduced range
+        std::vector<dst_t> partial(nthr * dst_size, init_value);
+        parallel_nt(static_cast<int>(nthr), [&](const int ithr, const int nthr_used) {
+            size_t start = 0, end = 0;
+            splitter(reduced_work, nthr_used, ithr, start, end);
+            dst_t *dst = &partial[ithr * dst_size];
+            for (size_t o = 0; o < outer_work; o++) {
+                const src_t *src = src_data + offset(kept_groups, o);
+                for (size_t r = start; r < end; r++)
+                    reduce_row(src + offset(reduced_groups, r), dst + o * dst_row_len, row_len, row_reduced);
+            }
+        });
+
+        parallel_for(dst_size, [&](size_t i) {
+            dst_t value = partial[i];
+            for (size_t ithr = 1; ithr < nthr; ithr++)
+                value = reduce_combine(reduceMode, value, partial[ithr * dst_size + i]);
+            dst_data[i] = value;
+        });
+    }
+}
+
+template <typename dst_t>
+void MKLDNNReduceNode::reduce_post(dst_t *dst_data, size_t dst_size, size_t reduced_size, const SizeVector &dst_blk_dims) {
+    auto finalize = [&](dst_t &value) {
+        switch (reduceMode) {
+            case ReduceMode::L2:
+                value = static_cast<dst_t>(sqrt(value));
+                break;
+            case ReduceMode::LogSum:
+            case ReduceMode::LogSumExp:
+                value = static_cast<dst_t>(logf(value));
+                break;
+            case ReduceMode::Mean:
+                value /= static_cast<dst_t>(reduced_size);
+                break;
+            default:
+                break;
+        }
+    };
+
+    if (!reduce_post_kernel) {
+        if (reduceMode == ReduceMode::L2 || reduceMode == ReduceMode::LogSum ||
+            reduceMode == ReduceMode::LogSumExp || reduceMode == ReduceMode::Mean) {
+            parallel_for(dst_size, [&](size_t i) {
+                finalize(dst_data[i]);
+            });
+        }
+        return;
+    }
+
+    const float divisor = 1.f / static_cast<float>(reduced_size);
+    if (!planar_layout) {
+        const size_t N = dst_blk_dims[0], CB = dst_blk_dims[1], spatial = dst_blk_dims[2];
+        parallel_for2d(N, CB, [&](size_t n, size_t cb) {
+            auto arg = jit_reduce_call_args();
+            arg.dst = dst_data + (n * CB + cb) * spatial * blk_size;
+            arg.work_amount = spatial;
+            arg.oc_off = cb * blk_size * sizeof(float);
+            arg.divisor = &divisor;
+            (*reduce_post_kernel)(&arg);
+        });
+    } else {
+        const size_t vec_num = dst_size / vec_size;
+        parallel_nt(parallel_get_max_threads(), [&](const int ithr, const int nthr_used) {
+            size_t start = 0, end = 0;
+            splitter(vec_num, nthr_used, ithr, start, end);
+            if (start >= end)
+                return;
+
+            auto arg = jit_reduce_call_args();
+            arg.dst = dst_data + start * vec_size;
+            arg.work_amount = end - start;
+            arg.divisor = &divisor;
+            (*reduce_post_kernel)(&arg);
+        });
+
+        for (size_t i = vec_num * vec_size; i < dst_size; i++)
+            finalize(dst_data[i]);
+    }
+}
+
+template <typename src_t>
+void MKLDNNReduceNode::reduce_to_u8(const src_t *src_data, uint8_t *dst_data, const SizeVector &dims,
+                                    const std::vector<bool> &is_reduced, size_t dst_size, size_t reduced_size,
+                                    const SizeVector &dst_blk_dims) {
+    // u8 can hold neither the partial sums nor the init value of Max, so the values are accumulated and finalized
+    // in fp32 and saturated to u8 only once
+    accum_buf.resize(dst_size);
+    float *accum = accum_buf.data();
+    reduce_type(src_data, accum, dims, is_reduced, dst_size);
+    reduce_post(accum, dst_size, reduced_size, dst_blk_dims);
+
+    parallel_for(dst_size, [&](size_t i) {
+        float value = std::nearbyint(accum[i]);
+        value = (std::min)((std::max)(value, 0.f), 255.f);
+        dst_data[i] = static_cast<uint8_t>(value);
+    });
+}
+
+bool MKLDNNReduceNode::created() const {
+    return getType() == Reduce;
+}
+
+REG_MKLDNN_PRIM_FOR(MKLDNNReduceNode, Reduce);
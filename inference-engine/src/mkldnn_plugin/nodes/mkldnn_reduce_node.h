@@ -0,0 +1,127 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <string>
+#include <memory>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+enum class ReduceMode { And, L1, L2, LogSum, LogSumExp, Max, Mean, Min, Or, Prod, Sum, SumSquare };
+
+struct jit_reduce_config_params {
+    bool planar_layout;
+    ReduceMode reduce_mode;
+    mkldnn::memory::data_type src_dt;
+    mkldnn::memory::data_type dst_dt;
+    int src_data_size;
+    int dst_data_size;
+};
+
+struct jit_reduce_call_args {
+    const void *src;
+    void *dst;
+    size_t work_amount;   // number of full vectors to process
+    size_t reduce_w;      // 1 - all lanes of the row are reduced into dst[0], 0 - dst row is updated lane by lane
+    size_t oc_off;
+    const float *divisor;
+};
+
+struct jit_uni_reduce_kernel {
+    void (*ker_)(const jit_reduce_call_args *);
+
+    void operator()(const jit_reduce_call_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_reduce_kernel(jit_reduce_config_params jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_reduce_kernel() {}
+
+    jit_reduce_config_params jcp_;
+};
+
+struct jit_uni_reduce_post_kernel {
+    void (*ker_)(const jit_reduce_call_args *);
+
+    void operator()(const jit_reduce_call_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_reduce_post_kernel(jit_reduce_config_params jcp, const mkldnn_primitive_attr &attr) : ker_(nullptr), jcp_(jcp), attr_(attr) {}
+    virtual ~jit_uni_reduce_post_kernel() {}
+
+    jit_reduce_config_params jcp_;
+    const mkldnn_primitive_attr &attr_;
+};
+
+class MKLDNNReduceNode : public MKLDNNNode {
+public:
+    MKLDNNReduceNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+    ~MKLDNNReduceNode() override = default;
+
+    void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    bool created() const override;
+    void execute(mkldnn::stream strm) override;
+    bool canBeInPlace() const override {
+        return false;
+    }
+
+    /**
+     * @brief Returns true if the node may be executed on the nChw8c/nChw16c layouts, i.e. the reduction axes are
+     * constant, the channel axis is kept and the rank is preserved. Only such nodes accept fused post operations.
+     */
+    bool canUseBlockedLayout() const;
+    bool canFuse() const;
+
+private:
+    template <typename src_t, typename dst_t>
+    void reduce_type(const src_t *src_data, dst_t *dst_data, const InferenceEngine::SizeVector &dims,
+                     const std::vector<bool> &is_reduced, size_t dst_size);
+
+    template <typename src_t, typename dst_t>
+    void reduce_row(const src_t *src, dst_t *dst, size_t len, bool reduce_w);
+
+    template <typename dst_t>
+    void reduce_post(dst_t *dst_data, size_t dst_size, size_t reduced_size, const InferenceEngine::SizeVector &dst_blk_dims);
+
+    template <typename src_t>
+    void reduce_to_u8(const src_t *src_data, uint8_t *dst_data, const InferenceEngine::SizeVector &dims,
+                      const std::vector<bool> &is_reduced, size_t dst_size, size_t reduced_size,
+                      const InferenceEngine::SizeVector &dst_blk_dims);
+
+    std::vector<int32_t> getConstAxes() const;
+
+    void setPostOps(mkldnn::primitive_attr &attr, bool initWeights = false);
+
+    ReduceMode reduceMode = ReduceMode::Sum;
+    bool keep_dims = true;
+    bool planar_layout = true;
+    size_t blk_size = 1;
+    size_t vec_size = 1;
+
+    InferenceEngine::Precision input_prec, output_prec;
+
+    mkldnn::primitive_attr attr;
+
+    std::vector<MKLDNNMemoryPtr> PostOpsIntBlobMemory;
+
+    std::shared_ptr<jit_uni_reduce_kernel> reduce_kernel;
+    std::shared_ptr<jit_uni_reduce_post_kernel> reduce_post_kernel;
+
+    std::vector<float> accum_buf;
+
+    static const size_t REDUCE_DATA = 0;
+    static const size_t REDUCE_INDEXES = 1;
+};
+
+}  // namespace MKLDNNPlugin
+
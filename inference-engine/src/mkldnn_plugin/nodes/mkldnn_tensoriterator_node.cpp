@@ -6,14 +6,18 @@
 #include "desc_iterator.hpp"
 #include <ie_layers.h>
 #include <ie_layers_internal.hpp>
+#include <ie_algorithm.hpp>
+#include <net_pass.h>
 #include <string>
 #include <vector>
 #include <map>
+#include <algorithm>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
 #include <ie_memcpy.h>
 #include "details/caseless.hpp"
 #include "graph_transformer.h"
+#include "ie_parallel.hpp"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -49,10 +53,40 @@ static LayerConfig make_plain_config(const CNNLayerPtr &layer) {
     return config;
 }
 
+/**
+ * Returns memory of all body edges which hold the data of the port edge. The data may be rebound to another buffer
+ * only if no node shares it in-place with other edges, otherwise an empty vector is returned.
+ */
+static std::vector<mkldnn::memory> get_port_views(const MKLDNNEdgePtr &port_edge) {
+    auto parent = port_edge->getParent();
+    const void *data = port_edge->getMemory().GetData();
+
+    for (size_t i = 0; i < parent->getParentEdges().size(); i++)
+        if (parent->getParentEdgeAt(i)->getMemory().GetData() == data)
+            return {};
+
+    std::vector<mkldnn::memory> views;
+    for (auto &edge : parent->getChildEdgesAtPort(port_edge->getInputNum())) {
+        auto child = edge->getChild();
+        for (size_t i = 0; i < child->getChildEdges().size(); i++)
+            if (child->getChildEdgeAt(i)->getMemory().GetData() == data)
+                return {};
+
+        views.push_back(edge->getMemory().GetPrimitive());
+    }
+    return views;
+}
+
+static void rebind_views(std::vector<mkldnn::memory> &views, void *data) {
+    for (auto &view : views)
+        view.set_data_handle(data);
+}
+
 class PortIteratorHelper : public PortMapHelper {
 public:
-    PortIteratorHelper(const MKLDNNMemoryPtr &from, const MKLDNNMemoryPtr &to,
-            bool as_input, const TensorIterator::PortMap &port_map, const mkldnn::engine& eng, int n_iter) : as_input(as_input) {
+    PortIteratorHelper(const MKLDNNMemoryPtr &from, const MKLDNNMemoryPtr &to, bool as_input,
+            const TensorIterator::PortMap &port_map, const std::vector<mkldnn::memory> &part_views,
+            const mkldnn::engine& eng, int n_iter) : as_input(as_input) {
         const auto &full_blob = as_input ? from : to;
         const auto &part_blob = !as_input ? from : to;
 
@@ -62,7 +96,6 @@ public:
         auto full_dims = full_blob->GetDims();
         auto part_dims = part_blob->GetDims();
 
-        bool simple_copy = port_map.axis == -1;
         if (port_map.axis == -1) {
             // simple copy mode. No iteration through this tensor
             reorders.emplace_back(from->GetPrimitive(), to->GetPrimitive());
@@ -84,9 +117,6 @@ public:
             chunk_desc.data.layout_desc.blocking.padding_dims[axis] = abs_stride;  // TODO: asamption that plain tensor
 
             mem_holder.push_back(full_blob->GetPrimitive());
-            auto full_mem_handler = full_blob->GetPrimitive().get_data_handle();
-            mem_holder.emplace_back(mkldnn::memory::primitive_desc(chunk_desc, eng), full_mem_handler);
-            auto &chunk_mem_prim = mem_holder.back();
 
             auto elem_size = MKLDNNExtensionUtils::sizeOfDataType(mkldnn::memory::data_type(chunk_desc.data.data_type));
 
@@ -94,6 +124,24 @@ public:
             chunk_offset_in_byte = sign_of_stride < 0 ? (iter_count - 1) * chunk_stride_in_byte : 0;
             chunk_stride_in_byte *= sign_of_stride;
 
+            // A chunk of the plain tensor is dense if all outer dimensions are 1. If the body keeps the same
+            // layout for it, the body memory is pointed directly to the chunk and no reorder is needed.
+            auto full_format = MKLDNNMemoryDesc(chunk_desc).getFormat();
+            bool dense_chunk = MKLDNNMemory::IsPlainFormat(full_format) && full_format != memory::blocked;
+            for (int i = 0; i < axis; i++)
+                dense_chunk = dense_chunk && full_dims[i] == 1;
+
+            if (!part_views.empty() && dense_chunk &&
+                    MKLDNNMemoryDesc(part_blob->GetDescriptor()) == MKLDNNMemoryDesc({part_dims.begin(), part_dims.end()},
+                            MKLDNNMemoryDesc(chunk_desc).getDataType(), full_format)) {
+                views = part_views;
+                return;
+            }
+
+            auto full_mem_handler = full_blob->GetPrimitive().get_data_handle();
+            mem_holder.emplace_back(mkldnn::memory::primitive_desc(chunk_desc, eng), full_mem_handler);
+            auto &chunk_mem_prim = mem_holder.back();
+
             if (as_input) {
                 reorders.emplace_back(chunk_mem_prim, to->GetPrimitive());
             } else {
@@ -107,10 +155,16 @@ public:
             IE_ASSERT(n_iter < iter_count);
 
             auto full_mem = mem_holder[FULL_DATA];
-            auto chunk_mem = mem_holder[CHUNK_DATA];
+            auto chunk_data = static_cast<uint8_t *>(full_mem.get_data_handle()) +
+                    chunk_offset_in_byte + chunk_stride_in_byte * n_iter;
 
-            chunk_mem.set_data_handle(static_cast<uint8_t *>(full_mem.get_data_handle()) +
-                    chunk_offset_in_byte + chunk_stride_in_byte * n_iter);
+            if (!views.empty()) {
+                rebind_views(views, chunk_data);
+                return;
+            }
+
+            auto chunk_mem = mem_holder[CHUNK_DATA];
+            chunk_mem.set_data_handle(chunk_data);
 
             strm.submit({reorders.begin(), reorders.end()});
         } else {
@@ -130,23 +184,45 @@ private:
 
 class BackEdgePortHelper : public PortMapHelper {
 public:
-    BackEdgePortHelper(const MKLDNNMemoryPtr &from, const MKLDNNMemoryPtr &to, const mkldnn::engine& eng, int n_iter) {
-        auto mem_desc =  from->GetDescriptor();
-
+    BackEdgePortHelper(const MKLDNNMemoryPtr &from, const MKLDNNMemoryPtr &to,
+            const std::vector<mkldnn::memory> &from_views, const std::vector<mkldnn::memory> &to_views,
+            const mkldnn::engine& eng, int n_iter) {
+        iter_count = n_iter;
 
-        mem_holder.emplace_back(mkldnn::memory::primitive_desc(mem_desc, eng));
-        auto &temp_mem = mem_holder.back();
+        // Ping-pong mode: the body reads the state from one buffer and writes the next state to another one.
+        // Buffers are swapped after each iteration instead of copying the state.
+        if (!from_views.empty() && !to_views.empty() &&
+                MKLDNNMemoryDesc(from->GetDescriptor()) == MKLDNNMemoryDesc(to->GetDescriptor())) {
+            auto mem_desc = from->GetDescriptor();
+            mem_holder.emplace_back(mkldnn::memory::primitive_desc(mem_desc, eng));
+            mem_holder.emplace_back(mkldnn::memory::primitive_desc(mem_desc, eng));
+
+            views = from_views;
+            to_mem_views = to_views;
+            rebind_views(views, mem_holder[0].get_data_handle());
+            rebind_views(to_mem_views, mem_holder[1].get_data_handle());
+            return;
+        }
 
         reorders.emplace_back(from->GetPrimitive(), to->GetPrimitive());
-
-        iter_count = n_iter;
     }
 
     void execute(int n_iter, mkldnn::stream strm) override {
         if (n_iter < iter_count - 1) {
+            if (!views.empty()) {
+                out_buf = 1 - out_buf;
+                rebind_views(to_mem_views, mem_holder[1 - out_buf].get_data_handle());
+                rebind_views(views, mem_holder[out_buf].get_data_handle());
+                return;
+            }
+
             strm.submit({reorders.begin(), reorders.end()});
         }
     };
+
+private:
+    std::vector<mkldnn::memory> to_mem_views;
+    int out_buf = 0;  // index of the buffer the body writes the state to
 };
 
 }  // namespace MKLDNNPlugin
@@ -161,7 +237,11 @@ void MKLDNNTensorIteratorNode::getSupportedDescriptors() {
 
     n_iter = getNumIteration(*ti);
     MKLDNNGraph::ApplyUnrollPasses(ti->body);
-    sub_graph.CreateGraph(ti->body, ext_mng, weightCache);
+
+    // the layer is shared between graphs of all streams, so the body is modified on a copy only
+    auto body = NetPass::CopyTIBody(ti->body);
+    hoistInputProjections(*ti, body);
+    sub_graph.CreateGraph(body, ext_mng, weightCache);
 
     // Try to detect inputs and outputs by indexes
     std::map<std::string, MKLDNNNodePtr> in_map, out_map;
@@ -172,18 +252,138 @@ void MKLDNNTensorIteratorNode::getSupportedDescriptors() {
     for (auto node : sub_graph.GetOutputNodes())
         out_map[node->getName().substr(4)] = node;  // remove "out_" prefix
 
-    for (const auto &in_data : ti->body.inputs) {
+    for (const auto &in_data : body.inputs) {
         if (in_data->getName() == "const_holder") continue;
 
         auto &in_node = in_map[in_data->getName()];
-        auto in_mem = in_node->getChildEdgeAt(0)->getMemoryPtr();
-        input_mem.push_back(in_mem);
+        auto in_edge = in_node->getChildEdgeAt(0);
+        input_mem.push_back(in_edge->getMemoryPtr());
+        input_edges.push_back(in_edge);
     }
 
-    for (const auto &out_data : ti->body.outputs) {
+    for (const auto &out_data : body.outputs) {
         auto &out_node = out_map[out_data->getName()];
-        auto out_mem = out_node->getParentEdgeAt(0)->getMemoryPtr();
-        output_mem.push_back(out_mem);
+        auto out_edge = out_node->getParentEdgeAt(0);
+        output_mem.push_back(out_edge->getMemoryPtr());
+        output_edges.push_back(out_edge);
+    }
+}
+
+void MKLDNNTensorIteratorNode::hoistInputProjections(const TensorIterator &ti, TensorIterator::Body &body) {
+    static const caseless_set<std::string> reshape_types = {"Reshape", "Flatten", "Squeeze", "Unsqueeze"};
+
+    auto is_body_output = [&](const DataPtr &data) {
+        return std::find(body.outputs.begin(), body.outputs.end(), data) != body.outputs.end();
+    };
+
+    // port maps address body inputs without const holder
+    std::vector<size_t> input_idx;
+    for (size_t i = 0; i < body.inputs.size(); i++)
+        if (body.inputs[i]->getName() != "const_holder")
+            input_idx.push_back(i);
+
+    for (size_t rule_idx = 0; rule_idx < ti.input_port_map.size(); rule_idx++) {
+        const auto &rule = ti.input_port_map[rule_idx];
+        if (rule.axis == -1)
+            continue;
+
+        auto same_input = [&](const TensorIterator::PortMap &r) { return r.to == rule.to; };
+        if (std::count_if(ti.input_port_map.begin(), ti.input_port_map.end(), same_input) != 1 ||
+                std::any_of(ti.back_edges.begin(), ti.back_edges.end(), same_input))
+            continue;
+
+        auto &in_data = body.inputs[input_idx[rule.to]];
+
+        // the input may be reshaped before FullyConnected
+        DataPtr fc_in_data = in_data;
+        CNNLayerPtr consumer;
+        while (fc_in_data->getInputTo().size() == 1 && !is_body_output(fc_in_data)) {
+            consumer = fc_in_data->getInputTo().begin()->second;
+            if (!reshape_types.count(consumer->type) || consumer->insData.size() != 1 || consumer->outData.size() != 1)
+                break;
+            fc_in_data = consumer->outData[0];
+            consumer = nullptr;
+        }
+
+        auto fc = std::dynamic_pointer_cast<FullyConnectedLayer>(consumer);
+        if (!fc || fc->insData.size() != 1 || fc->outData.size() != 1 || !fc->_weights)
+            continue;
+
+        auto out_data = fc->outData[0];
+        if (is_body_output(out_data) || in_data->getPrecision() != Precision::FP32 ||
+                out_data->getPrecision() != Precision::FP32 ||
+                fc->_weights->getTensorDesc().getPrecision() != Precision::FP32 ||
+                (fc->_biases && fc->_biases->getTensorDesc().getPrecision() != Precision::FP32))
+            continue;
+
+        // the whole external tensor has to be iterated
+        auto ext_data = ti.insData[rule.from].lock();
+        auto in_dims = in_data->getDims();
+        auto full_dims = in_dims;
+        full_dims[rule.axis] *= n_iter;
+        if (!ext_data || ext_data->getPrecision() != Precision::FP32 || ext_data->getDims() != full_dims ||
+                in_dims[rule.axis] != static_cast<size_t>(std::abs(rule.stride)))
+            continue;
+
+        auto out_dims = out_data->getDims();
+        if (out_dims.size() != 2)
+            continue;
+
+        size_t B = out_dims[0], O = out_dims[1];
+        size_t K = fc->_weights->size() / O;
+        if (fc->_weights->size() != K * O || (fc->_biases && fc->_biases->size() != O) ||
+                details::product(fc_in_data->getDims().begin(), fc_in_data->getDims().end()) != B * K)
+            continue;
+
+        // Every slice of the input is a set of FullyConnected rows. The product is stored iteration by iteration,
+        // so the rows of one slice are either contiguous in the input (no outer dims) or are taken one per outer index.
+        size_t outer = details::product(in_dims.begin(), in_dims.begin() + rule.axis);
+        size_t slice = details::product(in_dims.begin() + rule.axis, in_dims.end());
+        if (slice % K != 0 || outer * (slice / K) != B || (outer != 1 && slice != K))
+            continue;
+
+        InputProjection proj;
+        proj.rule = static_cast<int>(rule_idx);
+        proj.from = rule.from;
+        proj.outer = static_cast<int>(outer);
+        proj.rows = static_cast<int>(slice / K);
+        proj.K = static_cast<int>(K);
+        proj.O = static_cast<int>(O);
+        proj.weights = fc->_weights;
+        proj.biases = fc->_biases;
+        input_projections.push_back(proj);
+
+        // output of FullyConnected becomes the body input
+        out_data->getCreatorLayer().reset();
+        in_data = out_data;
+    }
+}
+
+void MKLDNNTensorIteratorNode::executeInputProjections() {
+    for (auto &proj : input_projections) {
+        auto src = reinterpret_cast<const float *>(getParentEdgesAtPort(proj.from)[0]->getMemory().GetData());
+        auto dst = reinterpret_cast<float *>(proj.mem->GetData());
+        auto weights = proj.weights->cbuffer().as<const float *>();
+        const int B = proj.outer * proj.rows;
+
+        if (proj.outer == 1) {
+            mkldnn_sgemm('N', 'T', n_iter * proj.rows, proj.O, proj.K, 1.0f, src, proj.K,
+                         weights, proj.K, 0.0f, dst, proj.O);
+        } else {
+            // one row per iteration for each outer index, the rows are interleaved to keep slices dense
+            for (int i = 0; i < proj.outer; i++)
+                mkldnn_sgemm('N', 'T', n_iter, proj.O, proj.K, 1.0f, src + i * n_iter * proj.K, proj.K,
+                             weights, proj.K, 0.0f, dst + i * proj.O, B * proj.O);
+        }
+
+        if (proj.biases) {
+            auto biases = proj.biases->cbuffer().as<const float *>();
+            parallel_for(n_iter * B, [&](int row) {
+                float *dst_row = dst + row * proj.O;
+                for (int o = 0; o < proj.O; o++)
+                    dst_row[o] += biases[o];
+            });
+        }
     }
 }
 
@@ -196,17 +396,49 @@ void MKLDNNTensorIteratorNode::initSupportedPrimitiveDescriptors() {
 }
 
 
+std::vector<mkldnn::memory> MKLDNNTensorIteratorNode::claimPortViews(const MKLDNNEdgePtr &port_edge) {
+    // each body buffer may be rebound by a single port mapper only, others keep copying through it
+    if (!claimed_ports.insert({port_edge->getParent().get(), port_edge->getInputNum()}).second)
+        return {};
+
+    return get_port_views(port_edge);
+}
+
 void MKLDNNTensorIteratorNode::createPrimitive() {
     auto ti = dynamic_cast<class TensorIterator*>(getCnnLayer().get());
     if (ti == nullptr)
         THROW_IE_EXCEPTION << "Cannot convert to TensorIterator layer.";
 
-    for (auto map_rule : ti->input_port_map) {
-        auto &extr_mem = getParentEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
+    // Back edges are rebound first, as they are executed on every iteration
+    std::vector<std::vector<mkldnn::memory>> back_edge_from_views, back_edge_to_views;
+    for (auto map_rule : ti->back_edges) {
+        back_edge_from_views.push_back(claimPortViews(output_edges[map_rule.from]));
+        back_edge_to_views.push_back(claimPortViews(input_edges[map_rule.to]));
+    }
+
+    for (size_t i = 0; i < ti->input_port_map.size(); i++) {
+        auto map_rule = ti->input_port_map[i];
+        auto extr_mem = getParentEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
         auto &intr_mem = input_mem[map_rule.to];
 
+        // hoisted projection is iterated instead of the input, a slice of it is [outer * rows, O]
+        for (auto &proj : input_projections) {
+            if (proj.rule != static_cast<int>(i))
+                continue;
+
+            const int B = proj.outer * proj.rows;
+            proj.mem = std::make_shared<MKLDNNMemory>(getEngine());
+            proj.mem->Create({n_iter * B, proj.O}, memory::f32, memory::nc);
+
+            extr_mem = proj.mem;
+            map_rule.axis = 0;
+            map_rule.stride = map_rule.stride < 0 ? -B : B;
+        }
+
+        auto intr_views = map_rule.axis == -1 ? std::vector<mkldnn::memory>() : claimPortViews(input_edges[map_rule.to]);
+
         auto mapper = std::shared_ptr<PortMapHelper>(
-                new PortIteratorHelper (extr_mem, intr_mem, true, map_rule, getEngine(), n_iter));
+                new PortIteratorHelper (extr_mem, intr_mem, true, map_rule, intr_views, getEngine(), n_iter));
 
         in_port_mappers.push_back(mapper);
     }
@@ -214,19 +446,21 @@ void MKLDNNTensorIteratorNode::createPrimitive() {
     for (auto map_rule : ti->output_port_map) {
         auto &extr_mem = getChildEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
         auto &intr_mem = output_mem[map_rule.to];
+        auto intr_views = map_rule.axis == -1 ? std::vector<mkldnn::memory>() : claimPortViews(output_edges[map_rule.to]);
 
         auto mapper = std::shared_ptr<PortMapHelper>(
-                new PortIteratorHelper (intr_mem, extr_mem, false, map_rule, getEngine(), n_iter));
+                new PortIteratorHelper (intr_mem, extr_mem, false, map_rule, intr_views, getEngine(), n_iter));
 
         out_port_mappers.push_back(mapper);
     }
 
-    for (auto map_rule : ti->back_edges) {
+    for (size_t i = 0; i < ti->back_edges.size(); i++) {
+        auto map_rule = ti->back_edges[i];
         auto from_mem = output_mem[map_rule.from];
         auto to_mem = input_mem[map_rule.to];
 
         auto mapper = std::shared_ptr<PortMapHelper>(
-                new BackEdgePortHelper(from_mem, to_mem, getEngine(), n_iter));
+                new BackEdgePortHelper(from_mem, to_mem, back_edge_from_views[i], back_edge_to_views[i], getEngine(), n_iter));
 
         out_port_mappers.push_back(mapper);
     }
@@ -235,6 +469,8 @@ void MKLDNNTensorIteratorNode::createPrimitive() {
 void MKLDNNTensorIteratorNode::execute(mkldnn::stream strm) {
     sub_graph.ResetInferCount();
 
+    executeInputProjections();
+
     for (int i = 0; i < n_iter; i++) {
         // copy data to subgraph iteration
         for (auto &mapper : in_port_mappers)
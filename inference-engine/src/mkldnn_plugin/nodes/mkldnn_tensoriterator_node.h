@@ -9,6 +9,8 @@
 #include <mkldnn_graph.h>
 #include <string>
 #include <memory>
+#include <set>
+#include <utility>
 #include <vector>
 
 namespace MKLDNNPlugin {
@@ -20,9 +22,24 @@ public:
 protected:
     std::vector<mkldnn::reorder> reorders;
     std::vector<mkldnn::memory> mem_holder;
+    std::vector<mkldnn::memory> views;  // body memory rebound to the data instead of reorders (zero-copy mode)
     int iter_count;
 };
 
+/**
+ * FullyConnected of the body which depends on an iterated input only. It's removed from the body and computed
+ * for all iterations at once, the body gets slices of the result instead of the input.
+ */
+struct InputProjection {
+    int rule;    // index in the input port map
+    int from;    // external input port
+    int outer;   // product of the input dims before the iteration axis
+    int rows;    // FullyConnected rows in one slice of the input
+    int K, O;    // FullyConnected input and output sizes
+    InferenceEngine::Blob::Ptr weights, biases;
+    MKLDNNMemoryPtr mem;  // [n_iter * outer * rows, O]
+};
+
 class MKLDNNTensorIteratorNode : public MKLDNNNode {
 public:
     MKLDNNTensorIteratorNode(InferenceEngine::CNNLayerPtr layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
@@ -36,12 +53,19 @@ public:
 
     void setExtManager(const MKLDNNExtensionManager::Ptr& extMgr) { ext_mng = extMgr; }
 private:
+    std::vector<mkldnn::memory> claimPortViews(const MKLDNNEdgePtr &port_edge);
+    void hoistInputProjections(const InferenceEngine::TensorIterator &ti, InferenceEngine::TensorIterator::Body &body);
+    void executeInputProjections();
+
     int n_iter = 0;
 
     MKLDNNExtensionManager::Ptr ext_mng;
     MKLDNNGraph sub_graph;
     std::vector<MKLDNNMemoryPtr> input_mem, output_mem;
+    std::vector<MKLDNNEdgePtr> input_edges, output_edges;
+    std::set<std::pair<MKLDNNNode*, int>> claimed_ports;
 
+    std::vector<InputProjection> input_projections;
     std::vector<std::shared_ptr<PortMapHelper>> in_port_mappers, out_port_mappers;
 };
 
@@ -12,6 +12,7 @@
 #include <limits>
 #include "ie_parallel.hpp"
 #include "common/simple_copy.h"
+#include "common/row_copy.h"
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -21,13 +22,17 @@ class ScatterImpl: public ExtLayerBase {
 public:
     explicit ScatterImpl(const CNNLayer* layer) {
         try {
-            if (layer->insData.size() != 3 || layer->outData.size() != 1)
+            //  Legacy IR passes axis as an attribute and has element-wise semantics,
+            //  opset3 ScatterUpdate/ScatterElementsUpdate take axis as the 4th input
+            if ((layer->insData.size() != 3 && layer->insData.size() != 4) || layer->outData.size() != 1)
                 THROW_IE_EXCEPTION << layer->name << " Incorrect number of input/output tensors!";
 
+            axisAsInput = layer->insData.size() == 4;
+            elementsUpdate = !axisAsInput || layer->type == "ScatterElementsUpdate";
 
             Precision inIdxPrecision = layer->insData[SCATTER_INDEXES].lock()->getTensorDesc().getPrecision();
-            if (inIdxPrecision != Precision::FP32 && inIdxPrecision != Precision::I32)
-                THROW_IE_EXCEPTION << layer->name << " Incorrect input 'Indexes' precision. Only FP32 or I32 are supported!";
+            if (inIdxPrecision != Precision::FP32 && inIdxPrecision != Precision::I32 && inIdxPrecision != Precision::I64)
+                THROW_IE_EXCEPTION << layer->name << " Incorrect input 'Indexes' precision. Only FP32, I32 or I64 are supported!";
 
             Precision inDataPrecision = layer->insData[SCATTER_DATA].lock()->getTensorDesc().getPrecision();
             if (inDataPrecision != layer->insData[SCATTER_UPDATES].lock()->getTensorDesc().getPrecision())
@@ -40,35 +45,46 @@ public:
                 layer->insData[SCATTER_DATA].lock()->getTensorDesc().getLayout() == Layout::SCALAR)
                     THROW_IE_EXCEPTION << layer->name << " 'Data' tensor rank should be >= 1";
 
-            axis = layer->GetParamAsInt("axis", 0);
+            if (!axisAsInput) {
+                axis = layer->GetParamAsInt("axis", 0);
 
-            IE_ASSERT(-static_cast<int>(data_dims.size()) <= axis && axis < static_cast<int>(data_dims.size()))
-                << layer->name << " Incorrect input parameters dimensions and axis number!";
+                IE_ASSERT(-static_cast<int>(data_dims.size()) <= axis && axis < static_cast<int>(data_dims.size()))
+                    << layer->name << " Incorrect input parameters dimensions and axis number!";
 
-            if (axis < 0)
-                axis += data_dims.size();
+                if (axis < 0)
+                    axis += data_dims.size();
+            }
 
             SizeVector dst_dims = layer->outData[0]->getTensorDesc().getDims();
             if (data_dims != dst_dims)
                 THROW_IE_EXCEPTION << layer->name << " Incorrect number of input/output dimensions!";
 
             SizeVector idx_dims = layer->insData[SCATTER_INDEXES].lock()->getTensorDesc().getDims();
-            if (idx_dims.size() == 0 ||
-                (idx_dims.size() == 1 && idx_dims[0] == 1) ||
-                layer->insData[SCATTER_INDEXES].lock()->getTensorDesc().getLayout() == Layout::SCALAR)
-                THROW_IE_EXCEPTION << layer->name << " 'Indexes' tensor rank should be >= 1";
-
             SizeVector upd_dims = layer->insData[SCATTER_UPDATES].lock()->getTensorDesc().getDims();
-            if (layer->insData[SCATTER_UPDATES].lock()->getTensorDesc().getLayout() == Layout::SCALAR)
-                THROW_IE_EXCEPTION << layer->name << " 'Indexes' tensor rank should be >= 1";
+            if (elementsUpdate) {
+                if (idx_dims.size() == 0 ||
+                    (idx_dims.size() == 1 && idx_dims[0] == 1) ||
+                    layer->insData[SCATTER_INDEXES].lock()->getTensorDesc().getLayout() == Layout::SCALAR)
+                    THROW_IE_EXCEPTION << layer->name << " 'Indexes' tensor rank should be >= 1";
 
-            if (idx_dims != upd_dims)
-                THROW_IE_EXCEPTION << layer->name << " Incorrect number of 'indexes' and 'updates' tensors dimension";
+                if (layer->insData[SCATTER_UPDATES].lock()->getTensorDesc().getLayout() == Layout::SCALAR)
+                    THROW_IE_EXCEPTION << layer->name << " 'Indexes' tensor rank should be >= 1";
 
-            for (size_t i = 0; i < idx_dims.size(); i++) {
-                if (i == static_cast<size_t>(axis)) continue;
-                if (idx_dims[i] > data_dims[i])
+                if (idx_dims != upd_dims)
+                    THROW_IE_EXCEPTION << layer->name << " Incorrect number of 'indexes' and 'updates' tensors dimension";
+
+                if (idx_dims.size() != data_dims.size())
                     THROW_IE_EXCEPTION << layer->name << " Incorrect number of data and indexes dimensions!";
+
+                //  with axis given as input this check is postponed to execution
+                for (size_t i = 0; i < idx_dims.size() && !axisAsInput; i++) {
+                    if (i == static_cast<size_t>(axis)) continue;
+                    if (idx_dims[i] > data_dims[i])
+                        THROW_IE_EXCEPTION << layer->name << " Incorrect number of data and indexes dimensions!";
+                }
+            } else {
+                if (upd_dims.size() != idx_dims.size() + data_dims.size() - 1)
+                    THROW_IE_EXCEPTION << layer->name << " Incorrect number of 'indexes' and 'updates' tensors dimension";
             }
 
             LayerConfig config;
@@ -85,6 +101,15 @@ public:
             updatesConfig.desc = TensorDesc(dataPrecision, upd_dims,
                                             layer->insData[SCATTER_UPDATES].lock()->getTensorDesc().getLayout());
             config.inConfs.push_back(updatesConfig);
+            if (axisAsInput) {
+                DataConfig axisConfig;
+                const TensorDesc& axisDesc = layer->insData[SCATTER_AXIS].lock()->getTensorDesc();
+                Precision inAxisPrecision = axisDesc.getPrecision();
+                if (inAxisPrecision != Precision::FP32 && inAxisPrecision != Precision::I32 && inAxisPrecision != Precision::I64)
+                    THROW_IE_EXCEPTION << layer->name << " Incorrect input 'Axis' precision. Only FP32, I32 or I64 are supported!";
+                axisConfig.desc = TensorDesc(inAxisPrecision, axisDesc.getDims(), axisDesc.getLayout());
+                config.inConfs.push_back(axisConfig);
+            }
 
             DataConfig outConfig;
             outConfig.desc = TensorDesc(dataPrecision, dst_dims, layer->outData[0]->getTensorDesc().getLayout());
@@ -99,12 +124,52 @@ public:
     }
 
     StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept override {
+        int scatterAxis = axis;
+        if (axisAsInput) {
+            const Blob::Ptr& axisBlob = inputs[SCATTER_AXIS];
+            const int rank = static_cast<int>(inputs[SCATTER_DATA]->getTensorDesc().getDims().size());
+            switch (axisBlob->getTensorDesc().getPrecision()) {
+                case Precision::FP32:
+                    scatterAxis = static_cast<int>(axisBlob->cbuffer().as<const float *>()[0]);
+                    break;
+                case Precision::I32:
+                    scatterAxis = axisBlob->cbuffer().as<const int32_t *>()[0];
+                    break;
+                case Precision::I64:
+                    scatterAxis = static_cast<int>(axisBlob->cbuffer().as<const int64_t *>()[0]);
+                    break;
+                default:
+                    return GENERAL_ERROR;
+            }
+            if (scatterAxis < 0)
+                scatterAxis += rank;
+            bool incorrectDims = scatterAxis < 0 || scatterAxis >= rank;
+            if (elementsUpdate && !incorrectDims) {
+                const SizeVector& data_dims = inputs[SCATTER_DATA]->getTensorDesc().getDims();
+                const SizeVector& idx_dims = inputs[SCATTER_INDEXES]->getTensorDesc().getDims();
+                for (int i = 0; i < rank; i++) {
+                    if (i != scatterAxis && idx_dims[i] > data_dims[i])
+                        incorrectDims = true;
+                }
+            }
+            if (incorrectDims) {
+                if (resp) {
+                    std::string errorMsg = "Scatter layer has incorrect 'axis' value or 'indexes' dimensions";
+                    errorMsg.copy(resp->msg, sizeof(resp->msg) - 1);
+                }
+                return GENERAL_ERROR;
+            }
+        }
+
         switch (inputs[SCATTER_INDEXES]->getTensorDesc().getPrecision()) {
             case Precision::FP32:
-                scatter<float>(inputs[SCATTER_DATA], inputs[SCATTER_INDEXES], inputs[SCATTER_UPDATES], outputs[0]);
+                scatter<float>(inputs[SCATTER_DATA], inputs[SCATTER_INDEXES], inputs[SCATTER_UPDATES], outputs[0], scatterAxis);
                 break;
             case Precision::I32:
-                scatter<int32_t>(inputs[SCATTER_DATA], inputs[SCATTER_INDEXES], inputs[SCATTER_UPDATES], outputs[0]);
+                scatter<int32_t>(inputs[SCATTER_DATA], inputs[SCATTER_INDEXES], inputs[SCATTER_UPDATES], outputs[0], scatterAxis);
+                break;
+            case Precision::I64:
+                scatter<int64_t>(inputs[SCATTER_DATA], inputs[SCATTER_INDEXES], inputs[SCATTER_UPDATES], outputs[0], scatterAxis);
                 break;
             default:
                 return GENERAL_ERROR;
@@ -114,18 +179,16 @@ public:
     }
 
 private:
+    //  Negative indices are mapped to values out of range and skipped
+    template <typename index_t>
+    static inline size_t toIndex(const index_t value) { return static_cast<size_t>(static_cast<int64_t>(value)); }
+
     template <typename index_t>
-    void scatter(Blob::Ptr data, Blob::Ptr indexes, Blob::Ptr updates, Blob::Ptr output) {
+    void scatter(Blob::Ptr data, Blob::Ptr indexes, Blob::Ptr updates, Blob::Ptr output, int axis) {
         const uint8_t *src_data = data->cbuffer().as<const uint8_t *>() + data->getTensorDesc().getBlockingDesc().getOffsetPadding();
-        const index_t *src_index = indexes->cbuffer().as<const index_t *>() + indexes->getTensorDesc().getBlockingDesc().getOffsetPadding();
-        const uint8_t *src_updates = updates->cbuffer().as<const uint8_t *>() + updates->getTensorDesc().getBlockingDesc().getOffsetPadding();
         uint8_t *dst_data = output->cbuffer().as<uint8_t*>() + output->getTensorDesc().getBlockingDesc().getOffsetPadding();
         size_t data_size = data->getTensorDesc().getPrecision().size();
 
-        InferenceEngine::SizeVector index_dims = indexes->getTensorDesc().getDims();
-        InferenceEngine::SizeVector data_dims = data->getTensorDesc().getDims();
-        InferenceEngine::SizeVector dataStrides = data->getTensorDesc().getBlockingDesc().getStrides();
-
         if (src_data != dst_data) {
             parallel_nt(0, [&](const int ithr, const int nthr) {
                 size_t start = 0, end = 0;
@@ -136,11 +199,117 @@ private:
             });
         }
 
+        if (elementsUpdate)
+            scatterElements<index_t>(data, indexes, updates, output, axis);
+        else
+            scatterUpdate<index_t>(data, indexes, updates, output, axis);
+    }
+
+    //  ScatterUpdate: updates[d_0..d_axis-1, i_0..i_k, d_axis+1..d_n] is a whole row of data at indexes[i_0..i_k]
+    template <typename index_t>
+    void scatterUpdate(Blob::Ptr data, Blob::Ptr indexes, Blob::Ptr updates, Blob::Ptr output, int axis) {
+        const index_t *src_index = indexes->cbuffer().as<const index_t *>() + indexes->getTensorDesc().getBlockingDesc().getOffsetPadding();
+        const uint8_t *src_updates = updates->cbuffer().as<const uint8_t *>() + updates->getTensorDesc().getBlockingDesc().getOffsetPadding();
+        uint8_t *dst_data = output->cbuffer().as<uint8_t*>() + output->getTensorDesc().getBlockingDesc().getOffsetPadding();
+
+        const SizeVector& data_dims = data->getTensorDesc().getDims();
+        size_t outer = 1, len = data->getTensorDesc().getPrecision().size();
+        for (int i = 0; i < axis; i++)
+            outer *= data_dims[i];
+        for (size_t i = axis + 1; i < data_dims.size(); i++)
+            len *= data_dims[i];
+        dispatch_row_copy(len, ScatterUpdateRows<index_t>{src_index, indexes->size(), src_updates, dst_data,
+                                                          outer, data_dims[axis]});
+    }
+
+    //  Arguments of the row loop, which dispatch_row_copy instantiates for the row size
+    template <typename index_t>
+    struct ScatterUpdateRows {
+        const index_t *src_index;
+        size_t indexesSize;
+        const uint8_t *src_updates;
+        uint8_t *dst_data;
+        size_t outer;
+        size_t indexRange;
+
+        template <typename row_copy_t>
+        void operator()(const row_copy_t &copy_row) const {
+            scatterUpdateRows(copy_row, src_index, indexesSize, src_updates, dst_data, outer, indexRange);
+        }
+    };
+
+    template <typename row_copy_t, typename index_t>
+    static void scatterUpdateRows(const row_copy_t &copy_row, const index_t *src_index, size_t indexesSize,
+                                  const uint8_t *src_updates, uint8_t *dst_data, size_t outer, size_t indexRange) {
+        const size_t len = copy_row.size();
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            splitter(outer * indexesSize, nthr, ithr, start, end);
+            if (start >= end)
+                return;
+
+            size_t i = start % indexesSize;
+            uint8_t *dst = dst_data + (start / indexesSize) * indexRange * len;
+            const uint8_t *upd = src_updates + start * len;
+            for (size_t iwork = start; iwork < end; iwork++, upd += len) {
+                size_t idx = toIndex(src_index[i]);
+                if (idx < indexRange)
+                    copy_row(dst + idx * len, upd);
+
+                if (++i == indexesSize) {
+                    i = 0;
+                    dst += indexRange * len;
+                }
+            }
+        });
+    }
+
+    //  ScatterElementsUpdate: every element of updates goes to the position of its own index along the axis
+    template <typename index_t>
+    void scatterElements(Blob::Ptr data, Blob::Ptr indexes, Blob::Ptr updates, Blob::Ptr output, int axis) {
+        const index_t *src_index = indexes->cbuffer().as<const index_t *>() + indexes->getTensorDesc().getBlockingDesc().getOffsetPadding();
+        const uint8_t *src_updates = updates->cbuffer().as<const uint8_t *>() + updates->getTensorDesc().getBlockingDesc().getOffsetPadding();
+        uint8_t *dst_data = output->cbuffer().as<uint8_t*>() + output->getTensorDesc().getBlockingDesc().getOffsetPadding();
+        size_t data_size = data->getTensorDesc().getPrecision().size();
+
+        const SizeVector& index_dims = indexes->getTensorDesc().getDims();
+        const SizeVector& data_dims = data->getTensorDesc().getDims();
+        const SizeVector& dataStrides = data->getTensorDesc().getBlockingDesc().getStrides();
+
+        dispatch_row_copy(data_size, ScatterElementsRows<index_t>{src_index, src_updates, dst_data,
+                                                                  index_dims, data_dims, dataStrides, axis});
+    }
+
+    template <typename index_t>
+    struct ScatterElementsRows {
+        const index_t *src_index;
+        const uint8_t *src_updates;
+        uint8_t *dst_data;
+        const SizeVector &index_dims;
+        const SizeVector &data_dims;
+        const SizeVector &dataStrides;
+        int axis;
+
+        template <typename row_copy_t>
+        void operator()(const row_copy_t &copy_elem) const {
+            scatterElementsRows(copy_elem, src_index, src_updates, dst_data, index_dims, data_dims, dataStrides, axis);
+        }
+    };
+
+    template <typename row_copy_t, typename index_t>
+    static void scatterElementsRows(const row_copy_t &copy_elem, const index_t *src_index, const uint8_t *src_updates,
+                                    uint8_t *dst_data, const SizeVector &index_dims, const SizeVector &data_dims,
+                                    const SizeVector &dataStrides, int axis) {
+        const size_t data_size = copy_elem.size();
+        size_t indexesSize = 1;
+        for (size_t dim : index_dims)
+            indexesSize *= dim;
+
         parallel_nt(0, [&](const int ithr, const int nthr) {
             int j;
             size_t i, dst_idx = 0, start = 0, end = 0;
             SizeVector counters(index_dims.size(), 0);
-            splitter(indexes->size(), nthr, ithr, start, end);
+            splitter(indexesSize, nthr, ithr, start, end);
             for (j = index_dims.size() - 1, i = start; j >= 0; j--) {
                 counters[j] = i % index_dims[j];
                 i /= index_dims[j];
@@ -152,15 +321,15 @@ private:
                 dst_idx += counters[i] * dataStrides[i];
 
             for (size_t iwork = start; iwork < end; iwork++) {
-                unsigned int idx = static_cast<unsigned int>(src_index[iwork]);
+                size_t idx = toIndex(src_index[iwork]);
                 if (idx < data_dims[axis])
-                    simple_copy(dst_data + data_size * (dst_idx + idx * dataStrides[axis]), data_size,
-                                src_updates + iwork * data_size, data_size);
+                    copy_elem(dst_data + data_size * (dst_idx + idx * dataStrides[axis]),
+                              src_updates + iwork * data_size);
 
                 for (j = index_dims.size() - 1; j >= 0; j--) {
                     counters[j]++;
                     if (counters[j] < index_dims[j]) {
-                        if (j != static_cast<size_t>(axis))
+                        if (j != axis)
                             dst_idx += dataStrides[j];
                         break;
                     } else {
@@ -176,12 +345,16 @@ private:
     }
 
     int axis = 0;
+    bool axisAsInput = false;
+    bool elementsUpdate = true;
     const size_t SCATTER_DATA = 0;
     const size_t SCATTER_INDEXES = 1;
     const size_t SCATTER_UPDATES = 2;
+    const size_t SCATTER_AXIS = 3;
 };
 
 REG_FACTORY_FOR(ScatterImpl, ScatterUpdate);
+REG_FACTORY_FOR(ScatterImpl, ScatterElementsUpdate);
 
 }  // namespace Cpu
 }  // namespace Extensions
@@ -0,0 +1,434 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "topk_imp.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <utility>
+#include <vector>
+#include <ie_parallel.hpp>
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#include "nodes/common/uni_simd.h"
+#endif
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+using Shape = std::vector<size_t>;
+
+#if defined(HAVE_AVX512F)
+    constexpr int block_size = 16;
+    constexpr int count_vec = 32;
+    typedef __m512 vec_type_f;
+    typedef __m512i vec_type_i;
+    typedef __mmask16 vmask_type;
+#elif defined(HAVE_AVX2)
+    constexpr int block_size = 8;
+    constexpr int count_vec = 16;
+    typedef __m256 vec_type_f;
+    typedef __m256i vec_type_i;
+    typedef __m256 vmask_type;
+#elif defined(HAVE_SSE42)
+    constexpr int block_size = 4;
+    constexpr int count_vec = 16;
+    typedef __m128 vec_type_f;
+    typedef __m128i vec_type_i;
+    typedef __m128 vmask_type;
+#endif
+
+// rows shorter than this are not split between threads
+constexpr int min_chunk_size = 4096;
+// columns of a non-innermost axis are transposed by blocks of this size
+constexpr int columns_block = 16;
+
+inline int count(const Shape& dims, size_t start_ind, size_t end_ind) {
+    size_t count = 1;
+    for (size_t i = start_ind; i < end_ind; i++)
+        count *= dims[i];
+    return static_cast<int>(count);
+}
+
+inline int div_up(int a, int b) {
+    return (a + b - 1) / b;
+}
+
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+template <bool mode_max>
+inline vmask_type cmp_better_ps(const vec_type_f value, const vec_type_f other) {
+    return mode_max ? _mm_uni_cmpgt_ps(value, other) : _mm_uni_cmpgt_ps(other, value);
+}
+#endif
+
+// Ties are resolved in favor of the smaller index, so the result doesn't depend on the processing order
+template <bool mode_max>
+struct better_item {
+    inline bool operator()(const std::pair<float, int>& a, const std::pair<float, int>& b) const {
+        if (a.first == b.first)
+            return a.second < b.second;
+        return mode_max ? a.first > b.first : a.first < b.first;
+    }
+};
+
+// Keeps the k best elements seen so far in a heap with the worst of them on top
+template <bool mode_max>
+class TopKSelector {
+public:
+    explicit TopKSelector(int k) : k_(k) {
+        heap_.reserve(k);
+    }
+
+    void clear() {
+        heap_.clear();
+    }
+
+    bool full() const {
+        return static_cast<int>(heap_.size()) == k_;
+    }
+
+    const std::vector<std::pair<float, int>>& items() const {
+        return heap_;
+    }
+
+    inline void push(float value, int index) {
+        std::pair<float, int> item(value, index);
+        if (!full()) {
+            heap_.push_back(item);
+            std::push_heap(heap_.begin(), heap_.end(), better);
+        } else if (better(item, heap_.front())) {
+            std::pop_heap(heap_.begin(), heap_.end(), better);
+            heap_.back() = item;
+            std::push_heap(heap_.begin(), heap_.end(), better);
+        }
+    }
+
+    // Scans the contiguous src[0, len), the index of src[0] is 'first'. Elements are visited in ascending
+    // index order, so the ones equal to the current worst value lose the tie and are filtered out with it.
+    void scan(const float* src, int len, int first) {
+        int i = 0;
+
+        // most of the row is kept anyway, selection is cheaper than filtering
+        if (heap_.empty() && 4 * k_ >= len) {
+            heap_.reserve(len);
+            for (; i < len; i++)
+                heap_.emplace_back(src[i], first + i);
+            if (len > k_) {
+                std::nth_element(heap_.begin(), heap_.begin() + (k_ - 1), heap_.end(), better);
+                heap_.resize(k_);
+            }
+            std::make_heap(heap_.begin(), heap_.end(), better);
+            return;
+        }
+
+        for (; i < len && !full(); i++)
+            push(src[i], first + i);
+
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+        if (full()) {
+            vec_type_f vthreshold = _mm_uni_set1_ps(heap_.front().first);
+#if defined(HAVE_AVX512F)
+            const vec_type_i viota = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+            float candidate_values[block_size];
+            int candidate_indexes[block_size];
+#endif
+            for (; i + block_size <= len; i += block_size) {
+                vec_type_f vsrc = _mm_uni_loadu_ps(src + i);
+                vmask_type vmask = cmp_better_ps<mode_max>(vsrc, vthreshold);
+#if defined(HAVE_AVX512F)
+                if (vmask) {
+                    _mm512_mask_compressstoreu_ps(candidate_values, vmask, vsrc);
+                    _mm512_mask_compressstoreu_epi32(candidate_indexes, vmask,
+                                                     _mm512_add_epi32(viota, _mm512_set1_epi32(first + i)));
+                    int candidates = 0;
+                    for (unsigned mask = vmask; mask; mask &= mask - 1)
+                        candidates++;
+                    for (int j = 0; j < candidates; j++)
+                        push(candidate_values[j], candidate_indexes[j]);
+                    vthreshold = _mm_uni_set1_ps(heap_.front().first);
+                }
+#else
+                int mask = _mm_uni_movemask_ps(vmask);
+                if (mask) {
+                    for (int j = 0; j < block_size; j++) {
+                        if (mask & (1 << j))
+                            push(src[i + j], first + i + j);
+                    }
+                    vthreshold = _mm_uni_set1_ps(heap_.front().first);
+                }
+#endif
+            }
+        }
+#endif
+        for (; i < len; i++)
+            push(src[i], first + i);
+    }
+
+    void store(float* dst_data, int* dst_idx, size_t stride, bool sort_value) {
+        if (sort_value) {
+            std::sort(heap_.begin(), heap_.end(), better);
+        } else {
+            std::sort(heap_.begin(), heap_.end(), [](const std::pair<float, int>& a, const std::pair<float, int>& b) {
+                return a.second < b.second;
+            });
+        }
+        for (size_t i = 0; i < heap_.size(); i++) {
+            if (dst_data)
+                dst_data[i * stride] = heap_[i].first;
+            if (dst_idx)
+                dst_idx[i * stride] = heap_[i].second;
+        }
+    }
+
+private:
+    int k_;
+    better_item<mode_max> better;
+    std::vector<std::pair<float, int>> heap_;
+};
+
+template <bool mode_max>
+void topk_last_axis(const float* src_data, float* dst_data, int* dst_idx, int rows, int dim, int src_k, bool sort_value) {
+    const int nthr = parallel_get_max_threads();
+    int chunks = 1;
+    if (rows < nthr)
+        chunks = (std::max)(1, (std::min)(div_up(nthr, rows), dim / min_chunk_size));
+
+    if (chunks == 1) {
+        parallel_for(rows, [&](int i0) {
+            TopKSelector<mode_max> selector(src_k);
+            selector.scan(src_data + static_cast<size_t>(i0) * dim, dim, 0);
+            selector.store(dst_data ? dst_data + static_cast<size_t>(i0) * src_k : nullptr,
+                           dst_idx ? dst_idx + static_cast<size_t>(i0) * src_k : nullptr, 1, sort_value);
+        });
+        return;
+    }
+
+    // few long rows: every row is split between threads and the partial results are merged
+    const int chunk_size = div_up(dim, chunks);
+    std::vector<std::pair<float, int>> candidates(static_cast<size_t>(rows) * chunks * src_k);
+    std::vector<int> candidates_num(static_cast<size_t>(rows) * chunks, 0);
+
+    parallel_for2d(rows, chunks, [&](int i0, int c) {
+        const int start = c * chunk_size;
+        const int len = (std::min)(chunk_size, dim - start);
+        if (len <= 0)
+            return;
+
+        TopKSelector<mode_max> selector(src_k);
+        selector.scan(src_data + static_cast<size_t>(i0) * dim + start, len, start);
+        const auto& items = selector.items();
+        std::copy(items.begin(), items.end(), candidates.begin() + (static_cast<size_t>(i0) * chunks + c) * src_k);
+        candidates_num[i0 * chunks + c] = static_cast<int>(items.size());
+    });
+
+    parallel_for(rows, [&](int i0) {
+        TopKSelector<mode_max> selector(src_k);
+        for (int c = 0; c < chunks; c++) {
+            const auto* items = &candidates[(static_cast<size_t>(i0) * chunks + c) * src_k];
+            for (int j = 0; j < candidates_num[i0 * chunks + c]; j++)
+                selector.push(items[j].first, items[j].second);
+        }
+        selector.store(dst_data ? dst_data + static_cast<size_t>(i0) * src_k : nullptr,
+                       dst_idx ? dst_idx + static_cast<size_t>(i0) * src_k : nullptr, 1, sort_value);
+    });
+}
+
+template <bool mode_max>
+void top1_axis(const float* src_data, float* dst_data, int* dst_idx, int before_num, int dim, int after_num) {
+    int first_index = 0;
+
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    parallel_for2d(before_num, after_num / block_size, [&](int i0, int ib1) {
+        int s_index = i0 * dim * after_num + ib1 * block_size;
+        vec_type_f vmax_val = _mm_uni_loadu_ps(src_data + s_index);
+        vec_type_i vindex_max_val = _mm_uni_setzero_si();
+        for (int i2 = 1; i2 < dim; i2++) {
+            s_index += after_num;
+            vec_type_f vsrc = _mm_uni_loadu_ps(src_data + s_index);
+            vmask_type vmask = cmp_better_ps<mode_max>(vsrc, vmax_val);
+            vmax_val = _mm_uni_blendv_ps(vmax_val, vsrc, vmask);
+
+            vec_type_i vindex_cur_val = _mm_uni_set1_epi32(i2);
+#if defined(HAVE_AVX512F)
+            vindex_max_val = _mm512_mask_blend_epi32(vmask, vindex_max_val, vindex_cur_val);
+#else
+            vindex_max_val = _mm_uni_blendv_epi8(vindex_max_val, vindex_cur_val, _mm_uni_castps_si(vmask));
+#endif
+        }
+        if (dst_data)
+            _mm_uni_storeu_ps(dst_data + i0 * after_num + ib1 * block_size, vmax_val);
+        if (dst_idx)
+            _mm_uni_storeu_si(reinterpret_cast<vec_type_i*>(dst_idx + i0 * after_num + ib1 * block_size), vindex_max_val);
+    });
+    first_index = after_num / block_size * block_size;
+#endif
+    int rest = after_num - first_index;
+    better_item<mode_max> better;
+    parallel_for2d(before_num, rest, [&](int i0, int i1) {
+        int index_max_val = 0;
+        int s_index = i0 * dim * after_num + first_index + i1;
+        float max_val = src_data[s_index];
+        for (int i2 = 1; i2 < dim; i2++) {
+            s_index += after_num;
+            if (better(std::make_pair(src_data[s_index], i2), std::make_pair(max_val, index_max_val))) {
+                max_val = src_data[s_index];
+                index_max_val = i2;
+            }
+        }
+        if (dst_data)
+            dst_data[i0 * after_num + first_index + i1] = max_val;
+        if (dst_idx)
+            dst_idx[i0 * after_num + first_index + i1] = index_max_val;
+    });
+}
+
+template <bool mode_max>
+void topk_axis(const float* src_data, float* dst_data, int* dst_idx, int before_num, int dim, int after_num,
+               int src_k, bool sort_value) {
+    int first_index = 0;
+
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    // small k: block_size neighbouring columns are processed at once with the sorted lists kept in registers
+    if (src_k < count_vec) {
+        parallel_for2d(before_num, after_num / block_size, [&](int i0, int ib1) {
+            vec_type_f vmax_values[count_vec];
+            vec_type_i vmax_indexes[count_vec];
+            vec_type_f vtmp;
+            vec_type_i vtmp_indexes;
+            vmask_type vmask;
+            int s_index = i0 * dim * after_num + ib1 * block_size;
+
+            auto vswap_func = [&](int index1, int index2) {
+                vtmp = vmax_values[index1];
+                vmax_values[index1] = _mm_uni_blendv_ps(vmax_values[index1], vmax_values[index2], vmask);
+                vmax_values[index2] = _mm_uni_blendv_ps(vmax_values[index2], vtmp, vmask);
+
+                vtmp_indexes = vmax_indexes[index1];
+#if defined(HAVE_AVX512F)
+                vmax_indexes[index1] = _mm512_mask_blend_epi32(vmask, vmax_indexes[index1], vmax_indexes[index2]);
+                vmax_indexes[index2] = _mm512_mask_blend_epi32(vmask, vmax_indexes[index2], vtmp_indexes);
+#else
+                vmax_indexes[index1] = _mm_uni_blendv_epi8(vmax_indexes[index1], vmax_indexes[index2], _mm_uni_castps_si(vmask));
+                vmax_indexes[index2] = _mm_uni_blendv_epi8(vmax_indexes[index2], vtmp_indexes, _mm_uni_castps_si(vmask));
+#endif
+            };
+
+            auto any = [](vmask_type mask) {
+#if defined(HAVE_AVX512F)
+                return mask != 0;
+#else
+                return _mm_uni_movemask_ps(mask) != 0;
+#endif
+            };
+
+            for (int i2 = 0; i2 < src_k; i2++) {
+                vmax_values[i2] = _mm_uni_loadu_ps(src_data + s_index);
+                vmax_indexes[i2] = _mm_uni_set1_epi32(i2);
+                s_index += after_num;
+            }
+            for (int i2 = 0; i2 < src_k - 1; i2++) {
+                for (int i3 = src_k - 1; i3 > i2; i3--) {
+                    vmask = cmp_better_ps<mode_max>(vmax_values[i3], vmax_values[i3 - 1]);
+                    if (any(vmask))
+                        vswap_func(i3, i3 - 1);
+                }
+            }
+            for (int i2 = src_k; i2 < dim; i2++) {
+                vmax_values[src_k] = _mm_uni_loadu_ps(src_data + s_index);
+                vmax_indexes[src_k] = _mm_uni_set1_epi32(i2);
+                for (int i3 = src_k; i3 > 0; i3--) {
+                    vmask = cmp_better_ps<mode_max>(vmax_values[i3], vmax_values[i3 - 1]);
+                    if (any(vmask))
+                        vswap_func(i3, i3 - 1);
+                    else
+                        break;
+                }
+                s_index += after_num;
+            }
+            if (!sort_value) {
+                // insertion sort, a lane stops moving as soon as its prefix is ordered
+                for (int i2 = 1; i2 < src_k; i2++) {
+                    for (int i3 = i2; i3 > 0; i3--) {
+                        vmask = _mm_uni_cmpgt_i32(vmax_indexes[i3 - 1], vmax_indexes[i3]);
+                        if (any(vmask))
+                            vswap_func(i3, i3 - 1);
+                        else
+                            break;
+                    }
+                }
+            }
+            if (dst_data) {
+                for (int i2 = 0; i2 < src_k; i2++)
+                    _mm_uni_storeu_ps(dst_data + (i0 * src_k + i2) * after_num + ib1 * block_size, vmax_values[i2]);
+            }
+            if (dst_idx) {
+                for (int i2 = 0; i2 < src_k; i2++)
+                    _mm_uni_storeu_si(reinterpret_cast<vec_type_i*>(dst_idx + (i0 * src_k + i2) * after_num + ib1 * block_size), vmax_indexes[i2]);
+            }
+        });
+        first_index = after_num / block_size * block_size;
+    }
+#endif
+
+    // the remaining columns are transposed by blocks, so the selection reads contiguous rows
+    // instead of walking the source with after_num stride
+    const int rest = after_num - first_index;
+    parallel_for2d(before_num, div_up(rest, columns_block), [&](int i0, int ib1) {
+        const int col = first_index + ib1 * columns_block;
+        const int cols = (std::min)(columns_block, after_num - col);
+
+        std::vector<float> columns(static_cast<size_t>(cols) * dim);
+        const float* src = src_data + static_cast<size_t>(i0) * dim * after_num + col;
+        for (int i2 = 0; i2 < dim; i2++) {
+            for (int c = 0; c < cols; c++)
+                columns[static_cast<size_t>(c) * dim + i2] = src[c];
+            src += after_num;
+        }
+
+        TopKSelector<mode_max> selector(src_k);
+        for (int c = 0; c < cols; c++) {
+            selector.clear();
+            selector.scan(&columns[static_cast<size_t>(c) * dim], dim, 0);
+
+            const size_t dst_offset = static_cast<size_t>(i0) * src_k * after_num + col + c;
+            selector.store(dst_data ? dst_data + dst_offset : nullptr, dst_idx ? dst_idx + dst_offset : nullptr,
+                           after_num, sort_value);
+        }
+    });
+}
+
+void topk_execute(const float* src_data, float* dst_data, int* dst_idx, std::vector<size_t> in_dims,
+                  int src_k, const topk_conf& conf) {
+    if (src_k <= 0)
+        return;
+
+    const int before_num = count(in_dims, 0, conf.axis);
+    const int dim = static_cast<int>(in_dims[conf.axis]);
+    const int after_num = count(in_dims, conf.axis + 1, in_dims.size());
+
+    if (after_num == 1) {
+        if (conf.mode_max)
+            topk_last_axis<true>(src_data, dst_data, dst_idx, before_num, dim, src_k, conf.sort_value);
+        else
+            topk_last_axis<false>(src_data, dst_data, dst_idx, before_num, dim, src_k, conf.sort_value);
+    } else if (src_k == 1) {
+        if (conf.mode_max)
+            top1_axis<true>(src_data, dst_data, dst_idx, before_num, dim, after_num);
+        else
+            top1_axis<false>(src_data, dst_data, dst_idx, before_num, dim, after_num);
+    } else {
+        if (conf.mode_max)
+            topk_axis<true>(src_data, dst_data, dst_idx, before_num, dim, after_num, src_k, conf.sort_value);
+        else
+            topk_axis<false>(src_data, dst_data, dst_idx, before_num, dim, after_num, src_k, conf.sort_value);
+    }
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
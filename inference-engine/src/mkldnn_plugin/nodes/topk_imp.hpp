@@ -0,0 +1,27 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstddef>
+#include <vector>
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+struct topk_conf {
+    size_t axis;
+    bool mode_max;
+    bool sort_value;
+};
+
+namespace XARCH {
+
+void topk_execute(const float* src_data, float* dst_data, int* dst_idx, std::vector<size_t> in_dims,
+                  int src_k, const topk_conf& conf);
+
+}  // namespace XARCH
+
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -0,0 +1,115 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "weights_compressor.h"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "details/caseless.hpp"
+#include "details/ie_cnn_network_tools.h"
+#include "ie_parallel.hpp"
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+using namespace InferenceEngine::details;
+
+constexpr size_t WeightsCompressor::int4GroupSize;
+constexpr const char* WeightsCompressor::compressedWeightsBlob;
+constexpr const char* WeightsCompressor::compressedScalesBlob;
+
+WeightsCompressor::WeightsCompressor(size_t bits): _bits(bits) {
+    if (bits != 8 && bits != 4)
+        THROW_IE_EXCEPTION << "Weights can be compressed only to 8 or 4 bits, got " << bits;
+}
+
+void WeightsCompressor::compress(CNNNetwork &network) const {
+    for (const auto &layer : CNNNetSortTopologically(network)) {
+        if (!canBeCompressed(*layer))
+            continue;
+
+        auto fcLayer = std::dynamic_pointer_cast<FullyConnectedLayer>(layer);
+        if (fcLayer == nullptr)
+            THROW_IE_EXCEPTION << "Cannot convert fully connected layer " << layer->name;
+        compress(*fcLayer);
+    }
+}
+
+bool WeightsCompressor::isCompressed(const CNNLayer &layer) {
+    return layer.blobs.find(compressedWeightsBlob) != layer.blobs.end();
+}
+
+bool WeightsCompressor::canBeCompressed(const CNNLayer &layer) const {
+    // INT8 and BF16 layers are already executed with narrow weights, the weights on inputs are not constant for the node
+    if (!CaselessEq<std::string>()(layer.type, "FullyConnected") || layer.insData.size() != 1 || layer.outData.size() != 1)
+        return false;
+
+    auto weights = layer.blobs.find("weights");
+    if (weights == layer.blobs.end() || weights->second == nullptr ||
+        weights->second->getTensorDesc().getPrecision() != Precision::FP32)
+        return false;
+
+    auto input = layer.insData[0].lock();
+    return input != nullptr && input->getPrecision() == Precision::FP32 &&
+           layer.outData[0]->getPrecision() == Precision::FP32;
+}
+
+void WeightsCompressor::compress(FullyConnectedLayer &layer) const {
+    const auto weights = layer.blobs["weights"];
+    const size_t outputChannels = layer._out_num;
+    if (outputChannels == 0 || weights->size() % outputChannels != 0)
+        THROW_IE_EXCEPTION << "Weights of layer " << layer.name << " don't match the number of output channels";
+
+    const size_t inputChannels = weights->size() / outputChannels;
+    const size_t groupSize = _bits == 8 ? inputChannels : int4GroupSize;
+    const size_t groups = (inputChannels + groupSize - 1) / groupSize;
+    const size_t rowSize = _bits == 8 ? inputChannels : (inputChannels + 1) / 2;
+    const float maxLevel = _bits == 8 ? 127.f : 7.f;
+
+    Blob::Ptr compressed = _bits == 8 ?
+        Blob::Ptr(make_shared_blob<int8_t>({Precision::I8, {outputChannels, rowSize}, Layout::NC})) :
+        Blob::Ptr(make_shared_blob<uint8_t>({Precision::U8, {outputChannels, rowSize}, Layout::NC}));
+    compressed->allocate();
+    auto scales = make_shared_blob<float>({Precision::FP32, {outputChannels, groups}, Layout::NC});
+    scales->allocate();
+
+    const float* src = weights->cbuffer().as<const float*>();
+    uint8_t* dst = compressed->buffer().as<uint8_t*>();
+    float* scalesData = scales->buffer().as<float*>();
+
+    parallel_for(outputChannels, [&](size_t oc) {
+        const float* row = src + oc * inputChannels;
+        uint8_t* dstRow = dst + oc * rowSize;
+        if (_bits == 4)
+            std::fill(dstRow, dstRow + rowSize, 0);
+
+        for (size_t g = 0; g < groups; g++) {
+            const size_t begin = g * groupSize;
+            const size_t end = std::min(begin + groupSize, inputChannels);
+
+            float maxAbs = 0.f;
+            for (size_t ic = begin; ic < end; ic++)
+                maxAbs = std::max(maxAbs, std::fabs(row[ic]));
+            const float scale = maxAbs > 0.f ? maxAbs / maxLevel : 1.f;
+            scalesData[oc * groups + g] = scale;
+
+            for (size_t ic = begin; ic < end; ic++) {
+                const auto value = static_cast<int8_t>(std::max(-maxLevel, std::min(maxLevel, std::round(row[ic] / scale))));
+                if (_bits == 8) {
+                    dstRow[ic] = static_cast<uint8_t>(value);
+                } else {
+                    dstRow[ic / 2] |= static_cast<uint8_t>((value & 0x0F) << (ic % 2 == 0 ? 0 : 4));
+                }
+            }
+        }
+    });
+
+    layer.blobs.erase("weights");
+    layer._weights = nullptr;
+    layer.blobs[compressedWeightsBlob] = compressed;
+    layer.blobs[compressedScalesBlob] = scales;
+    layer.params["weights_compression"] = _bits == 8 ? "I8" : "I4";
+}
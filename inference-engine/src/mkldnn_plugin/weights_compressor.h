@@ -0,0 +1,39 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+#include "inference_engine.hpp"
+
+namespace MKLDNNPlugin {
+
+/**
+ * Stores FP32 weights of FullyConnected layers as symmetric 8 or 4 bit integers with FP32 scales.
+ *
+ * INT8 weights have a scale per output channel, INT4 weights are packed by two values per byte, the lower
+ * nibble goes first, and have a scale per group of int4GroupSize input channels of each output channel.
+ * The compressed weights and the scales replace the "weights" blob of the layer, so the FP32 weights are not
+ * kept by the executable network.
+ */
+class WeightsCompressor {
+public:
+    static constexpr size_t int4GroupSize = 32;
+    static constexpr const char* compressedWeightsBlob = "compressed_weights";
+    static constexpr const char* compressedScalesBlob = "compressed_weights_scales";
+
+    explicit WeightsCompressor(size_t bits);
+
+    void compress(InferenceEngine::CNNNetwork &network) const;
+
+    static bool isCompressed(const InferenceEngine::CNNLayer &layer);
+
+private:
+    bool canBeCompressed(const InferenceEngine::CNNLayer &layer) const;
+    void compress(InferenceEngine::FullyConnectedLayer &layer) const;
+
+    size_t _bits;
+};
+
+}  // namespace MKLDNNPlugin
@@ -8,7 +8,9 @@
 #include <memory>
 #include <string>
 
+#include "cpp_interfaces/base/ie_memory_state_base.hpp"
 #include "cpp_interfaces/exception2status.hpp"
+#include "cpp_interfaces/interface/ie_imemory_state_internal.hpp"
 #include "ie_iinfer_request.hpp"
 #include "ie_preprocess.hpp"
 #include "ie_profiling.hpp"
@@ -87,6 +89,21 @@ public:
         TO_STATUS(_impl->SetBatch(batch_size));
     }
 
+    StatusCode QueryState(IMemoryState::Ptr& pState, size_t idx, ResponseDesc* resp) noexcept override {
+        try {
+            auto v = _impl->QueryState();
+            if (idx >= v.size()) {
+                return OUT_OF_BOUNDS;
+            }
+            pState = std::make_shared<MemoryStateBase<IMemoryStateInternal>>(v[idx]);
+            return OK;
+        } catch (const std::exception& ex) {
+            return InferenceEngine::DescriptionBuffer(GENERAL_ERROR, resp) << ex.what();
+        } catch (...) {
+            return InferenceEngine::DescriptionBuffer(UNEXPECTED);
+        }
+    }
+
 private:
     ~InferRequestBase() = default;
 };
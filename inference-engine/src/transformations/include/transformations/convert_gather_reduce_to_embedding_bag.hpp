@@ -0,0 +1,35 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <vector>
+#include <memory>
+
+#include <ie_api.h>
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ngraph {
+namespace pass {
+
+class INFERENCE_ENGINE_API_CLASS(ConvertGatherReduceToEmbeddingBag);
+
+}  // namespace pass
+}  // namespace ngraph
+
+/**
+ * @brief Fuses Gather(table, indices[B, N], axis=0) followed by ReduceSum/ReduceMean over axis 1
+ * into EmbeddingBagPackedSum, so the [B, N, emb_dim] gathered tensor is never materialized.
+ * ReduceMean is expressed with constant per sample weights equal to 1/N.
+ */
+class ngraph::pass::ConvertGatherReduceToEmbeddingBag: public ngraph::pass::GraphRewrite {
+public:
+    ConvertGatherReduceToEmbeddingBag() : GraphRewrite() {
+        convert_gather_reduce_to_embedding_bag();
+    }
+
+private:
+    void convert_gather_reduce_to_embedding_bag();
+};
@@ -0,0 +1,91 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformations/convert_gather_reduce_to_embedding_bag.hpp"
+
+#include <memory>
+#include <vector>
+
+#include <ngraph/opsets/opset3.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/validation_util.hpp>
+
+void ngraph::pass::ConvertGatherReduceToEmbeddingBag::convert_gather_reduce_to_embedding_bag() {
+    auto data = std::make_shared<pattern::op::Label>(element::f32, Shape{1, 1, 1});
+    auto axes = std::make_shared<pattern::op::Label>(element::i64, Shape{1});
+    auto reduce_sum = std::make_shared<ngraph::opset3::ReduceSum>(data, axes);
+    auto reduce_mean = std::make_shared<ngraph::opset3::ReduceMean>(data, axes);
+
+    ngraph::graph_rewrite_callback callback = [](pattern::Matcher& m) {
+        auto reduce = std::dynamic_pointer_cast<ngraph::op::util::ArithmeticReductionKeepDims>(m.get_match_root());
+        if (!reduce || reduce->get_keep_dims()) {
+            return false;
+        }
+
+        auto gather = std::dynamic_pointer_cast<ngraph::opset3::Gather>(reduce->input_value(0).get_node_shared_ptr());
+        // the gathered tensor must not be needed by anybody else, otherwise it is materialized anyway
+        if (!gather || gather->output(0).get_target_inputs().size() != 1) {
+            return false;
+        }
+
+        auto gather_axis = std::dynamic_pointer_cast<ngraph::opset3::Constant>(gather->input_value(2).get_node_shared_ptr());
+        auto reduce_axes = std::dynamic_pointer_cast<ngraph::opset3::Constant>(reduce->input_value(1).get_node_shared_ptr());
+        if (!gather_axis || !reduce_axes || shape_size(gather_axis->get_shape()) != 1 || shape_size(reduce_axes->get_shape()) != 1) {
+            return false;
+        }
+
+        const auto table_pshape = gather->get_input_partial_shape(0);
+        const auto indices_pshape = gather->get_input_partial_shape(1);
+        const auto& table_type = gather->get_input_element_type(0);
+        if (table_pshape.rank().is_dynamic() || table_pshape.rank().get_length() < 2 ||
+            indices_pshape.rank().is_dynamic() || indices_pshape.rank().get_length() != 2 ||
+            !table_type.is_real()) {
+            return false;
+        }
+
+        const auto gather_axis_value = ngraph::normalize_axes(gather->get_friendly_name(),
+                                                              gather_axis->cast_vector<int64_t>(),
+                                                              table_pshape.rank())[0];
+        const auto reduce_axis_value = ngraph::normalize_axes(reduce->get_friendly_name(),
+                                                              reduce_axes->cast_vector<int64_t>(),
+                                                              reduce->get_input_partial_shape(0).rank())[0];
+        // Gather over rows of the table, then reduction over the bag dimension of indices
+        if (gather_axis_value != 0 || reduce_axis_value != 1) {
+            return false;
+        }
+
+        NodeVector new_ops;
+        std::shared_ptr<ngraph::Node> embedding_bag;
+        if (std::dynamic_pointer_cast<ngraph::opset3::ReduceMean>(reduce)) {
+            if (indices_pshape.is_dynamic()) {
+                return false;
+            }
+            const auto indices_shape = indices_pshape.to_shape();
+            if (indices_shape[1] == 0) {
+                return false;
+            }
+            auto weights = ngraph::opset3::Constant::create(table_type, indices_shape,
+                    std::vector<float>(shape_size(indices_shape), 1.f / indices_shape[1]));
+            new_ops.push_back(weights);
+            embedding_bag = std::make_shared<ngraph::opset3::EmbeddingBagPackedSum>(gather->input_value(0),
+                                                                                    gather->input_value(1),
+                                                                                    weights);
+        } else {
+            embedding_bag = std::make_shared<ngraph::opset3::EmbeddingBagPackedSum>(gather->input_value(0),
+                                                                                    gather->input_value(1));
+        }
+        new_ops.push_back(embedding_bag);
+
+        embedding_bag->set_friendly_name(reduce->get_friendly_name());
+        ngraph::copy_runtime_info({gather, reduce}, new_ops);
+        ngraph::replace_node(reduce, embedding_bag);
+        return true;
+    };
+
+    auto m_sum = std::make_shared<ngraph::pattern::Matcher>(reduce_sum, "ConvertGatherReduceSumToEmbeddingBag");
+    this->add_matcher(m_sum, callback, PassProperty::CHANGE_DYNAMIC_STATE);
+
+    auto m_mean = std::make_shared<ngraph::pattern::Matcher>(reduce_mean, "ConvertGatherReduceMeanToEmbeddingBag");
+    this->add_matcher(m_mean, callback, PassProperty::CHANGE_DYNAMIC_STATE);
+}
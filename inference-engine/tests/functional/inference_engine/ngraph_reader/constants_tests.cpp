@@ -0,0 +1,128 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <sstream>
+#include <vector>
+
+#include <ngraph/opsets/opset1.hpp>
+
+#include "ngraph_reader_tests.hpp"
+#include "../transformations/ngraph_test_utils.hpp"
+
+TEST_F(NGraphReaderTests, ReadNetworkWithManyConstants) {
+    // Constants are created in parallel by the reader, the network is compared with the one
+    // built from the same weights constant by constant
+    const size_t constantsCount = 256;
+    const size_t constantSize = 4;
+    const size_t constantByteSize = constantSize * sizeof(float);
+
+    std::ostringstream model;
+    model << R"V0G0N(
+<net name="Network" version="10">
+    <layers>
+        <layer id="0" name="input" type="Parameter" version="opset1">
+            <data element_type="f32" shape="4"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>)V0G0N";
+    for (size_t i = 0; i < constantsCount; i++) {
+        const size_t constId = 2 * i + 1, addId = 2 * i + 2;
+        model << R"V0G0N(
+        <layer id=")V0G0N" << constId << R"V0G0N(" name="const_)V0G0N" << i << R"V0G0N(" type="Const" version="opset1">
+            <data offset=")V0G0N" << i * constantByteSize << R"V0G0N(" size=")V0G0N" << constantByteSize << R"V0G0N("/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id=")V0G0N" << addId << R"V0G0N(" name="add_)V0G0N" << i << R"V0G0N(" type="Add" version="opset1">
+            <input>
+                <port id="0">
+                    <dim>4</dim>
+                </port>
+                <port id="1">
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2" precision="FP32">
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>)V0G0N";
+    }
+    model << R"V0G0N(
+        <layer id=")V0G0N" << 2 * constantsCount + 1 << R"V0G0N(" name="output" type="Result" version="opset1">
+            <input>
+                <port id="0">
+                    <dim>4</dim>
+                </port>
+            </input>
+        </layer>
+    </layers>
+    <edges>)V0G0N";
+    for (size_t i = 0; i < constantsCount; i++) {
+        const size_t constId = 2 * i + 1, addId = 2 * i + 2;
+        const size_t prevId = i == 0 ? 0 : addId - 2;
+        const size_t prevPort = i == 0 ? 0 : 2;
+        model << R"V0G0N(
+        <edge from-layer=")V0G0N" << prevId << R"V0G0N(" from-port=")V0G0N" << prevPort
+              << R"V0G0N(" to-layer=")V0G0N" << addId << R"V0G0N(" to-port="0"/>
+        <edge from-layer=")V0G0N" << constId << R"V0G0N(" from-port="0" to-layer=")V0G0N" << addId
+              << R"V0G0N(" to-port="1"/>)V0G0N";
+    }
+    model << R"V0G0N(
+        <edge from-layer=")V0G0N" << 2 * constantsCount << R"V0G0N(" from-port="2" to-layer=")V0G0N"
+          << 2 * constantsCount + 1 << R"V0G0N(" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+    Blob::Ptr weights = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {constantsCount * constantByteSize}, Layout::C));
+    weights->allocate();
+    auto weightsData = weights->buffer().as<float *>();
+    for (size_t i = 0; i < constantsCount * constantSize; i++)
+        weightsData[i] = static_cast<float>(i) + 0.5f;
+
+    Core reader;
+    auto network = reader.ReadNetwork(model.str(), weights);
+    auto function = network.getFunction();
+    ASSERT_NE(nullptr, function);
+
+    std::shared_ptr<ngraph::Function> reference;
+    {
+        auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{constantSize});
+        std::shared_ptr<ngraph::Node> last = input;
+        for (size_t i = 0; i < constantsCount; i++) {
+            std::vector<float> values(weightsData + i * constantSize, weightsData + (i + 1) * constantSize);
+            auto constant = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{constantSize}, values);
+            last = std::make_shared<ngraph::opset1::Add>(last, constant);
+        }
+        reference = std::make_shared<ngraph::Function>(ngraph::NodeVector{last}, ngraph::ParameterVector{input});
+    }
+
+    auto res = compare_functions(function, reference);
+    ASSERT_TRUE(res.first) << res.second;
+
+    // Walk both Add chains from the result and compare the constant added at every step
+    auto node = function->get_results()[0]->input_value(0).get_node_shared_ptr();
+    auto refNode = reference->get_results()[0]->input_value(0).get_node_shared_ptr();
+    size_t checked = 0;
+    while (std::dynamic_pointer_cast<ngraph::opset1::Add>(node)) {
+        auto constant = std::dynamic_pointer_cast<ngraph::opset1::Constant>(node->input_value(1).get_node_shared_ptr());
+        auto refConstant = std::dynamic_pointer_cast<ngraph::opset1::Constant>(refNode->input_value(1).get_node_shared_ptr());
+        ASSERT_NE(nullptr, constant);
+        ASSERT_NE(nullptr, refConstant);
+        ASSERT_EQ(refConstant->cast_vector<float>(), constant->cast_vector<float>()) << "constant " << checked;
+        node = node->input_value(0).get_node_shared_ptr();
+        refNode = refNode->input_value(0).get_node_shared_ptr();
+        checked++;
+    }
+    ASSERT_EQ(constantsCount, checked);
+}
@@ -164,3 +164,63 @@ TEST_F(NGraphReaderTests, ConvertNGraphFromIterator) {
     IE_SUPPRESS_DEPRECATED_END
     ASSERT_EQ(layersCount, 2);
 }
+
+TEST_F(NGraphReaderTests, ReadNetworkWithIncorrectWeightsOfOneOfConstants) {
+    std::string model = R"V0G0N(
+<net name="Network" version="10">
+    <layers>
+        <layer id="0" name="const_1" type="Const" version="opset1">
+            <data offset="0" size="16"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="1" name="const_2" type="Const" version="opset1">
+            <data offset="16" size="16"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="2" name="add" type="Add" version="opset1">
+            <input>
+                <port id="0">
+                    <dim>4</dim>
+                </port>
+                <port id="1">
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2" precision="FP32">
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="3" name="output" type="Result" version="opset1">
+            <input>
+                <port id="0">
+                    <dim>4</dim>
+                </port>
+            </input>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="2" to-port="1"/>
+        <edge from-layer="2" from-port="2" to-layer="3" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+    // The weights of the second constant are out of the blob
+    Blob::Ptr weights = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {24}, Layout::C));
+    weights->allocate();
+    CommonTestUtils::fill_data(weights->buffer().as<float *>(), weights->size() / sizeof(float));
+
+    Core reader;
+    ASSERT_THROW(reader.ReadNetwork(model, weights), InferenceEngine::details::InferenceEngineException);
+}
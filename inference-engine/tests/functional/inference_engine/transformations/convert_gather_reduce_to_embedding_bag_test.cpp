@@ -0,0 +1,136 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <memory>
+#include <vector>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset3.hpp>
+#include <transformations/convert_gather_reduce_to_embedding_bag.hpp>
+#include <transformations/init_node_info.hpp>
+#include <transformations/utils/utils.hpp>
+
+#include "ngraph_test_utils.hpp"
+
+using namespace testing;
+
+TEST(TransformationTests, ConvertGatherReduceSumToEmbeddingBag) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto table = std::make_shared<ngraph::opset3::Parameter>(ngraph::element::f32, ngraph::Shape{1000, 64});
+        auto indices = std::make_shared<ngraph::opset3::Parameter>(ngraph::element::i32, ngraph::Shape{16, 20});
+        auto axis = ngraph::opset3::Constant::create(ngraph::element::i64, ngraph::Shape{}, {0});
+        auto gather = std::make_shared<ngraph::opset3::Gather>(table, indices, axis);
+        auto axes = ngraph::opset3::Constant::create(ngraph::element::i64, ngraph::Shape{1}, {1});
+        auto reduce = std::make_shared<ngraph::opset3::ReduceSum>(gather, axes, false);
+        reduce->set_friendly_name("reduce");
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{reduce}, ngraph::ParameterVector{table, indices});
+
+        ngraph::pass::InitNodeInfo().run_on_function(f);
+        ngraph::pass::ConvertGatherReduceToEmbeddingBag().run_on_function(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto table = std::make_shared<ngraph::opset3::Parameter>(ngraph::element::f32, ngraph::Shape{1000, 64});
+        auto indices = std::make_shared<ngraph::opset3::Parameter>(ngraph::element::i32, ngraph::Shape{16, 20});
+        auto embedding_bag = std::make_shared<ngraph::opset3::EmbeddingBagPackedSum>(table, indices);
+
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{embedding_bag}, ngraph::ParameterVector{table, indices});
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+
+    auto embedding_bag = f->get_output_op(0)->input_value(0).get_node_shared_ptr();
+    ASSERT_TRUE(embedding_bag->get_friendly_name() == "reduce") << "Transformation should keep output names.\n";
+}
+
+TEST(TransformationTests, ConvertGatherReduceMeanToEmbeddingBag) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto table = std::make_shared<ngraph::opset3::Parameter>(ngraph::element::f32, ngraph::Shape{1000, 64});
+        auto indices = std::make_shared<ngraph::opset3::Parameter>(ngraph::element::i32, ngraph::Shape{16, 4});
+        auto axis = ngraph::opset3::Constant::create(ngraph::element::i64, ngraph::Shape{}, {0});
+        auto gather = std::make_shared<ngraph::opset3::Gather>(table, indices, axis);
+        auto axes = ngraph::opset3::Constant::create(ngraph::element::i64, ngraph::Shape{1}, {1});
+        auto reduce = std::make_shared<ngraph::opset3::ReduceMean>(gather, axes, false);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{reduce}, ngraph::ParameterVector{table, indices});
+
+        ngraph::pass::InitNodeInfo().run_on_function(f);
+        ngraph::pass::ConvertGatherReduceToEmbeddingBag().run_on_function(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto table = std::make_shared<ngraph::opset3::Parameter>(ngraph::element::f32, ngraph::Shape{1000, 64});
+        auto indices = std::make_shared<ngraph::opset3::Parameter>(ngraph::element::i32, ngraph::Shape{16, 4});
+        auto weights = ngraph::opset3::Constant::create(ngraph::element::f32, ngraph::Shape{16, 4}, std::vector<float>(64, 0.25f));
+        auto embedding_bag = std::make_shared<ngraph::opset3::EmbeddingBagPackedSum>(table, indices, weights);
+
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{embedding_bag}, ngraph::ParameterVector{table, indices});
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+// the negative axis is normalized over the rank of the Gather output
+TEST(TransformationTests, ConvertGatherReduceMeanNegativeAxisToEmbeddingBag) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto table = std::make_shared<ngraph::opset3::Parameter>(ngraph::element::f32, ngraph::Shape{1000, 64});
+        auto indices = std::make_shared<ngraph::opset3::Parameter>(ngraph::element::i32, ngraph::Shape{16, 4});
+        auto axis = ngraph::opset3::Constant::create(ngraph::element::i64, ngraph::Shape{}, {0});
+        auto gather = std::make_shared<ngraph::opset3::Gather>(table, indices, axis);
+        auto axes = ngraph::opset3::Constant::create(ngraph::element::i64, ngraph::Shape{1}, {-2});
+        auto reduce = std::make_shared<ngraph::opset3::ReduceMean>(gather, axes, false);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{reduce}, ngraph::ParameterVector{table, indices});
+
+        ngraph::pass::InitNodeInfo().run_on_function(f);
+        ngraph::pass::ConvertGatherReduceToEmbeddingBag().run_on_function(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto table = std::make_shared<ngraph::opset3::Parameter>(ngraph::element::f32, ngraph::Shape{1000, 64});
+        auto indices = std::make_shared<ngraph::opset3::Parameter>(ngraph::element::i32, ngraph::Shape{16, 4});
+        auto weights = ngraph::opset3::Constant::create(ngraph::element::f32, ngraph::Shape{16, 4}, std::vector<float>(64, 0.25f));
+        auto embedding_bag = std::make_shared<ngraph::opset3::EmbeddingBagPackedSum>(table, indices, weights);
+
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{embedding_bag}, ngraph::ParameterVector{table, indices});
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+// reduction over the embedding dimension can't be expressed with EmbeddingBag
+TEST(TransformationTests, ConvertGatherReduceToEmbeddingBagNegative) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    auto get_function = []() {
+        auto table = std::make_shared<ngraph::opset3::Parameter>(ngraph::element::f32, ngraph::Shape{1000, 64});
+        auto indices = std::make_shared<ngraph::opset3::Parameter>(ngraph::element::i32, ngraph::Shape{16, 20});
+        auto axis = ngraph::opset3::Constant::create(ngraph::element::i64, ngraph::Shape{}, {0});
+        auto gather = std::make_shared<ngraph::opset3::Gather>(table, indices, axis);
+        auto axes = ngraph::opset3::Constant::create(ngraph::element::i64, ngraph::Shape{1}, {2});
+        auto reduce = std::make_shared<ngraph::opset3::ReduceSum>(gather, axes, false);
+        return std::make_shared<ngraph::Function>(ngraph::NodeVector{reduce}, ngraph::ParameterVector{table, indices});
+    };
+
+    f = get_function();
+    ngraph::pass::InitNodeInfo().run_on_function(f);
+    ngraph::pass::ConvertGatherReduceToEmbeddingBag().run_on_function(f);
+    ASSERT_NO_THROW(check_rt_info(f));
+
+    f_ref = get_function();
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
@@ -0,0 +1,61 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ie_core.hpp>
+#include <auto-batch/auto_batch_config.hpp>
+
+#include "functional_test_utils/blob_utils.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+class AutoBatchInferTest : public ::testing::TestWithParam<size_t> {};
+
+TEST_P(AutoBatchInferTest, requestsMatchNonBatchedInference) {
+    const size_t numRequests = GetParam();
+    auto ie = PluginCache::get().ie();
+    CNNNetwork network(ngraph::builder::subgraph::makeSplitConvConcat());
+
+    auto refNetwork = ie->LoadNetwork(network, "CPU");
+    auto batchNetwork = ie->LoadNetwork(network, "BATCH:CPU(4)",
+                                        {{AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT, "1"}});
+
+    const auto inputName = network.getInputsInfo().begin()->first;
+    const auto outputName = network.getOutputsInfo().begin()->first;
+    const auto& inputDesc = network.getInputsInfo().begin()->second->getTensorDesc();
+
+    std::vector<InferRequest> requests;
+    std::vector<Blob::Ptr> inputs;
+    for (size_t i = 0; i < numRequests; i++) {
+        inputs.push_back(FuncTestUtils::createAndFillBlob(inputDesc, 10, -static_cast<int32_t>(i)));
+        requests.push_back(batchNetwork.CreateInferRequest());
+        requests.back().SetBlob(inputName, inputs.back());
+    }
+    for (auto& request : requests) {
+        request.StartAsync();
+    }
+    for (size_t i = 0; i < numRequests; i++) {
+        ASSERT_EQ(StatusCode::OK, requests[i].Wait(IInferRequest::WaitMode::RESULT_READY));
+
+        auto refRequest = refNetwork.CreateInferRequest();
+        refRequest.SetBlob(inputName, inputs[i]);
+        refRequest.Infer();
+        FuncTestUtils::compareBlobs(requests[i].GetBlob(outputName), refRequest.GetBlob(outputName));
+    }
+}
+
+// 4 fills the batch, 6 leaves an incomplete batch that is flushed by the timeout
+INSTANTIATE_TEST_CASE_P(smoke_AutoBatch, AutoBatchInferTest, ::testing::Values(4, 6));
+
+}  // namespace
@@ -0,0 +1,124 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "bfloat16_helpers.hpp"
+
+#include <memory>
+#include <tuple>
+#include <vector>
+#include <string>
+#include <functional>
+#include <map>
+#include <utility>
+
+#include <ie_core.hpp>
+
+#include "functional_test_utils/blob_utils.hpp"
+#include "common_test_utils/common_utils.hpp"
+
+#include "ngraph/opsets/opset1.hpp"
+
+using namespace std;
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace LayerTestsDefinitions {
+
+class ConvFqConvReluConv : public BasicBF16Test {
+protected:
+    std::shared_ptr<ngraph::Function> createGraph(InferenceEngine::Precision netPrecision) override {
+        //                relu (FP32)
+        //                  |
+        //                Conv1 (BF16)
+        //                  |
+        //              FakeQuantize (U8)
+        //                  |
+        //                Conv2 (INT8, dequantization and relu are fused, the output is reordered to BF16)
+        //                  |
+        //                Conv3 (BF16)
+
+        ngraph::element::Type ntype = ngraph::element::f32;
+        auto channelsCount = inputShapes[1];
+
+        auto input1 = std::make_shared<opset1::Parameter>(ntype, ngraph::Shape{inputShapes});
+        input1->set_friendly_name("Input_1");
+
+        auto makeConvolution = [&](const ngraph::Output<ngraph::Node>& in, const ngraph::Output<ngraph::Node>& weights) {
+            return std::make_shared<ngraph::opset1::Convolution>(
+                in, weights,
+                ngraph::Strides({ 1, 1 }),   // strides
+                ngraph::CoordinateDiff({ 1, 1 }),  // pad begin
+                ngraph::CoordinateDiff({ 1, 1 }),   // pad end
+                ngraph::Strides({ 1, 1 }),        // dilation
+                ngraph::op::PadType::EXPLICIT);   // pad type
+        };
+        auto makeFakeQuantize = [&](const ngraph::Output<ngraph::Node>& in, size_t levels, float low, float high) {
+            auto lowNode = opset1::Constant::create(ntype, Shape{1}, { low });
+            auto highNode = opset1::Constant::create(ntype, Shape{1}, { high });
+            return std::make_shared<opset1::FakeQuantize>(in, lowNode, highNode, lowNode, highNode, levels);
+        };
+
+        ngraph::Shape convFilterShape = { channelsCount, channelsCount, 3, 3 };  // out channel, /input channels, kernel h, kernel w
+        std::vector<float> weightValues(channelsCount * channelsCount * 3 * 3);
+        FuncTestUtils::fillInputsBySinValues(weightValues.data(), weightValues.size());
+
+        // convolution 1, the output is converted to FP32 for quantization by the convolution itself
+        auto weightsNode1 = std::make_shared<ngraph::opset1::Constant>(ntype, convFilterShape, weightValues);
+        auto reluNode1 = std::make_shared<opset1::Relu>(input1);
+        reluNode1->set_friendly_name("RELU_1");
+        auto convNode1 = makeConvolution(reluNode1, weightsNode1);
+        convNode1->set_friendly_name("CONV_1");
+
+        // quantization of activations and weights of the convolution 2
+        auto fqNode1 = makeFakeQuantize(convNode1, 256, 0.f, 25.5f);
+        fqNode1->set_friendly_name("FQ_1");
+        auto weightsNode2 = std::make_shared<ngraph::opset1::Constant>(ntype, convFilterShape, weightValues);
+        auto fqNode2 = makeFakeQuantize(weightsNode2, 255, -1.27f, 1.27f);
+        fqNode2->set_friendly_name("FQ_2");
+
+        auto convNode2 = makeConvolution(fqNode1, fqNode2);
+        convNode2->set_friendly_name("CONV_2");
+
+        auto reluNode2 = std::make_shared<opset1::Relu>(convNode2);
+        reluNode2->set_friendly_name("RELU_2");
+
+        // convolution 3 gets BF16 input from the INT8 region
+        auto weightsNode3 = std::make_shared<ngraph::opset1::Constant>(ntype, convFilterShape, weightValues);
+        auto convNode3 = makeConvolution(reluNode2, weightsNode3);
+        convNode3->set_friendly_name("CONV_3");
+
+        return std::make_shared<ngraph::Function>(ngraph::NodeVector{convNode3}, ngraph::ParameterVector{input1});
+    }
+    void SetUp() override {
+        std::tie(inputPrecision, netPrecision, inputShapes, newInputShapes, targetDevice) = this->GetParam();
+        fnPtr = createGraph(netPrecision);
+
+        // STAGE1:
+        // reference network is executed with the same INT8 region, the difference comes from BF16 rounding of
+        // CONV_3 inputs and a few CONV_1 outputs moved to the neighbour quantization level (0.1)
+        threshold = 0.5f;
+        // STAGE2:
+        // filling of expected precision of layer execution defined by precisoin of input tensor to the primitive and reflected in
+        // performance counters, U8 input of INT8 convolution is reported as I8
+        expectedPrecisions["RELU_1"] = "FP32";
+        expectedPrecisions["CONV_1"] = "BF16";
+        expectedPrecisions["CONV_2"] = "I8";
+        expectedPrecisions["CONV_3"] = "BF16";
+    }
+};
+
+TEST_P(ConvFqConvReluConv, CompareWithRefImpl) {
+    test();
+};
+
+INSTANTIATE_TEST_CASE_P(FP32_bfloat16_NoReshape, ConvFqConvReluConv,
+                        ::testing::Combine(
+                                ::testing::Values(Precision::FP32),
+                                ::testing::Values(Precision::FP32),
+                                ::testing::Values(SizeVector({ 1, 3, 40, 40 })),
+                                ::testing::Values(SizeVector()),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        ConvFqConvReluConv::getTestCaseName);
+
+}  // namespace LayerTestsDefinitions
@@ -0,0 +1,84 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ie_calibration.hpp>
+#include <ie_core.hpp>
+
+#include "functional_test_utils/blob_utils.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+class CalibratorTest : public ::testing::TestWithParam<CalibrationConfig::RangeAlgorithm> {};
+
+TEST_P(CalibratorTest, quantizedNetworkIsCloseToFloatOne) {
+    auto ie = PluginCache::get().ie();
+    CNNNetwork network(ngraph::builder::subgraph::makeSplitConvConcat({1, 4, 20, 20}));
+    const auto inputName = network.getInputsInfo().begin()->first;
+    const auto outputName = network.getOutputsInfo().begin()->first;
+    const auto& inputDesc = network.getInputsInfo().begin()->second->getTensorDesc();
+
+    CalibrationConfig config;
+    config.algorithm = GetParam();
+    Calibrator calibrator(*ie, network, config);
+    std::vector<Blob::Ptr> samples;
+    for (size_t i = 0; i < 3; i++) {
+        samples.push_back(FuncTestUtils::createAndFillBlobFloat(inputDesc, 10, -5, 100, static_cast<int32_t>(i + 1)));
+        calibrator.Collect({{inputName, samples.back()}});
+    }
+    ASSERT_EQ(3, calibrator.GetSamplesCount());
+
+    // both activations of the convolutions and both weights are quantized
+    CNNNetwork quantized = calibrator.Quantize();
+    const auto ops = quantized.getFunction()->get_ops();
+    EXPECT_EQ(4, std::count_if(ops.begin(), ops.end(), [](const std::shared_ptr<ngraph::Node>& node) {
+        return ngraph::is_type<ngraph::opset1::FakeQuantize>(node);
+    }));
+
+    auto refRequest = ie->LoadNetwork(network, "CPU").CreateInferRequest();
+    auto request = ie->LoadNetwork(quantized, "CPU").CreateInferRequest();
+    for (const auto& sample : samples) {
+        refRequest.SetBlob(inputName, sample);
+        refRequest.Infer();
+        request.SetBlob(inputName, sample);
+        request.Infer();
+
+        auto ref = refRequest.GetBlob(outputName);
+        auto out = request.GetBlob(outputName);
+        ASSERT_EQ(ref->size(), out->size());
+        const auto refData = ref->cbuffer().as<const float*>();
+        const auto outData = out->cbuffer().as<const float*>();
+        float maxMagnitude = 0.f;
+        for (size_t i = 0; i < ref->size(); i++)
+            maxMagnitude = std::max(maxMagnitude, std::fabs(refData[i]));
+        for (size_t i = 0; i < ref->size(); i++) {
+            ASSERT_NEAR(refData[i], outData[i], 0.1f * maxMagnitude) << "element " << i;
+        }
+    }
+}
+
+TEST(CalibratorNegativeTest, quantizeThrowsWithoutSamples) {
+    auto ie = PluginCache::get().ie();
+    CNNNetwork network(ngraph::builder::subgraph::makeSingleConv());
+    Calibrator calibrator(*ie, network);
+    ASSERT_THROW(calibrator.Quantize(), details::InferenceEngineException);
+}
+
+INSTANTIATE_TEST_CASE_P(smoke_Calibration, CalibratorTest,
+                        ::testing::Values(CalibrationConfig::RangeAlgorithm::MinMax,
+                                          CalibrationConfig::RangeAlgorithm::Percentile,
+                                          CalibrationConfig::RangeAlgorithm::KL));
+
+}  // namespace
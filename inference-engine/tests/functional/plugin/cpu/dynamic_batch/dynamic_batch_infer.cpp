@@ -0,0 +1,283 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ie_core.hpp>
+#include <ie_iextension.h>
+#include <ie_plugin_config.hpp>
+#include <ngraph/opsets/opset.hpp>
+
+#include "functional_test_utils/blob_utils.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+constexpr size_t maxBatch = 8;
+
+// Element-wise y = 2 * x + 1 implemented by an extension, which may declare the dynamic batch support
+class DynBatchTestOp : public ngraph::op::Op {
+public:
+    static constexpr ngraph::NodeTypeInfo type_info{"DynBatchTestOp", 0};
+    const ngraph::NodeTypeInfo& get_type_info() const override { return type_info; }
+
+    DynBatchTestOp() = default;
+    explicit DynBatchTestOp(const ngraph::Output<ngraph::Node>& arg): Op({arg}) {
+        constructor_validate_and_infer_types();
+    }
+
+    void validate_and_infer_types() override {
+        set_output_type(0, get_input_element_type(0), get_input_partial_shape(0));
+    }
+
+    std::shared_ptr<ngraph::Node> copy_with_new_args(const ngraph::NodeVector& new_args) const override {
+        if (new_args.size() != 1) {
+            throw ngraph::ngraph_error("Incorrect number of new arguments");
+        }
+        return std::make_shared<DynBatchTestOp>(new_args.at(0));
+    }
+
+    bool visit_attributes(ngraph::AttributeVisitor& visitor) override {
+        return true;
+    }
+};
+
+constexpr ngraph::NodeTypeInfo DynBatchTestOp::type_info;
+
+class DynBatchTestImpl : public ILayerExecImpl {
+public:
+    DynBatchTestImpl(const std::shared_ptr<ngraph::Node>& node, bool dynBatchSupport)
+        : shape(node->get_output_shape(0)), dynBatchSupport(dynBatchSupport) {}
+
+    StatusCode getSupportedConfigurations(std::vector<LayerConfig>& conf, ResponseDesc* resp) noexcept override {
+        DataConfig data;
+        data.desc = TensorDesc(Precision::FP32, shape, TensorDesc::getLayoutByDims(shape));
+        LayerConfig config;
+        config.inConfs.push_back(data);
+        config.outConfs.push_back(data);
+        config.dynBatchSupport = dynBatchSupport;
+        conf.push_back(config);
+        return OK;
+    }
+
+    StatusCode init(LayerConfig& config, ResponseDesc* resp) noexcept override {
+        return OK;
+    }
+
+    StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs,
+                       ResponseDesc* resp) noexcept override {
+        const auto src = inputs[0]->cbuffer().as<const float*>();
+        auto dst = outputs[0]->buffer().as<float*>();
+        for (size_t i = 0; i < outputs[0]->size(); i++)
+            dst[i] = 2.f * src[i] + 1.f;
+        return OK;
+    }
+
+private:
+    ngraph::Shape shape;
+    bool dynBatchSupport;
+};
+
+class DynBatchTestExtension : public IExtension {
+public:
+    explicit DynBatchTestExtension(bool dynBatchSupport): dynBatchSupport(dynBatchSupport) {}
+
+    void GetVersion(const Version*& versionInfo) const noexcept override {
+        static Version version = {{2, 0}, "2.0", "dyn-batch-test-ext"};
+        versionInfo = &version;
+    }
+    void Unload() noexcept override {}
+    void Release() noexcept override {}
+
+    std::map<std::string, ngraph::OpSet> getOpSets() override {
+        ngraph::OpSet opset;
+        opset.insert<DynBatchTestOp>();
+        return {{"dyn_batch_test", opset}};
+    }
+
+    std::vector<std::string> getImplTypes(const std::shared_ptr<ngraph::Node>& node) override {
+        if (std::dynamic_pointer_cast<DynBatchTestOp>(node))
+            return {"CPU"};
+        return {};
+    }
+
+    ILayerImpl::Ptr getImplementation(const std::shared_ptr<ngraph::Node>& node, const std::string& implType) override {
+        if (std::dynamic_pointer_cast<DynBatchTestOp>(node) && implType == "CPU")
+            return std::make_shared<DynBatchTestImpl>(node, dynBatchSupport);
+        return nullptr;
+    }
+
+private:
+    bool dynBatchSupport;
+};
+
+std::shared_ptr<ngraph::Function> makeConvExtension(const std::vector<size_t>& inputShape) {
+    auto params = ngraph::builder::makeParams(ngraph::element::f32, {inputShape});
+    auto conv = ngraph::builder::makeConvolution(params[0], ngraph::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1},
+                                                 {1, 1}, ngraph::op::PadType::EXPLICIT, 8);
+    auto ext = std::make_shared<DynBatchTestOp>(conv);
+    auto relu = std::make_shared<ngraph::opset1::Relu>(ext);
+    ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(relu)};
+    return std::make_shared<ngraph::Function>(results, params, "ConvExtension");
+}
+
+std::shared_ptr<ngraph::Function> makeFakeQuantizeConv(const std::vector<size_t>& inputShape) {
+    auto params = ngraph::builder::makeParams(ngraph::element::f32, {inputShape});
+    auto fq = ngraph::builder::makeFakeQuantize(params[0], ngraph::element::f32, 256, {1}, {0.f}, {10.f}, {0.f}, {10.f});
+    auto conv = ngraph::builder::makeConvolution(fq, ngraph::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1},
+                                                 {1, 1}, ngraph::op::PadType::EXPLICIT, 8);
+    auto relu = std::make_shared<ngraph::opset1::Relu>(conv);
+    ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(relu)};
+    return std::make_shared<ngraph::Function>(results, params, "FakeQuantizeConv");
+}
+
+enum class TestNetwork {
+    SplitConvConcat,
+    FakeQuantizeConv,
+    ConvExtension
+};
+
+std::ostream& operator<<(std::ostream& os, TestNetwork network) {
+    switch (network) {
+        case TestNetwork::SplitConvConcat: return os << "SplitConvConcat";
+        case TestNetwork::FakeQuantizeConv: return os << "FakeQuantizeConv";
+        case TestNetwork::ConvExtension: return os << "ConvExtension";
+    }
+    return os;
+}
+
+using DynamicBatchInferParams = std::tuple<TestNetwork, size_t>;
+
+class DynamicBatchInferTest : public ::testing::TestWithParam<DynamicBatchInferParams> {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<DynamicBatchInferParams>& obj) {
+        TestNetwork network;
+        size_t batch;
+        std::tie(network, batch) = obj.param;
+        std::ostringstream result;
+        result << network << "_batch=" << batch;
+        return result.str();
+    }
+};
+
+TEST_P(DynamicBatchInferTest, processedBatchMatchesFullBatchInference) {
+    TestNetwork testNetwork;
+    size_t batch;
+    std::tie(testNetwork, batch) = GetParam();
+
+    // The extension is registered in a separate core, so it doesn't affect other tests
+    std::shared_ptr<Core> ie;
+    std::shared_ptr<ngraph::Function> function;
+    switch (testNetwork) {
+        case TestNetwork::SplitConvConcat:
+            ie = PluginCache::get().ie();
+            function = ngraph::builder::subgraph::makeSplitConvConcat({maxBatch, 4, 20, 20});
+            break;
+        case TestNetwork::FakeQuantizeConv:
+            ie = PluginCache::get().ie();
+            function = makeFakeQuantizeConv({maxBatch, 4, 20, 20});
+            break;
+        case TestNetwork::ConvExtension:
+            ie = std::make_shared<Core>();
+            ie->AddExtension(std::make_shared<DynBatchTestExtension>(true), "CPU");
+            function = makeConvExtension({maxBatch, 4, 20, 20});
+            break;
+    }
+    CNNNetwork network(function);
+
+    auto refNetwork = ie->LoadNetwork(network, "CPU");
+    auto dynNetwork = ie->LoadNetwork(network, "CPU",
+                                      {{PluginConfigParams::KEY_DYN_BATCH_ENABLED, PluginConfigParams::YES}});
+
+    const auto inputName = network.getInputsInfo().begin()->first;
+    const auto outputName = network.getOutputsInfo().begin()->first;
+    auto input = FuncTestUtils::createAndFillBlob(network.getInputsInfo().begin()->second->getTensorDesc());
+
+    auto refRequest = refNetwork.CreateInferRequest();
+    refRequest.SetBlob(inputName, input);
+    refRequest.Infer();
+    auto ref = refRequest.GetBlob(outputName);
+
+    // The same request is inferred twice to check that switching the batch back and forth keeps the results
+    auto dynRequest = dynNetwork.CreateInferRequest();
+    dynRequest.SetBlob(inputName, input);
+    for (size_t processed : {maxBatch, batch}) {
+        dynRequest.SetBatch(static_cast<int>(processed));
+        dynRequest.Infer();
+        auto out = dynRequest.GetBlob(outputName);
+
+        const size_t sliceSize = ref->size() / maxBatch * processed;
+        const auto refData = ref->cbuffer().as<const float*>();
+        const auto outData = out->cbuffer().as<const float*>();
+        for (size_t i = 0; i < sliceSize; i++) {
+            ASSERT_NEAR(refData[i], outData[i], 1e-4f) << "batch " << processed << ", element " << i;
+        }
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(smoke_DynamicBatch, DynamicBatchInferTest,
+                        ::testing::Combine(
+                                ::testing::Values(TestNetwork::SplitConvConcat, TestNetwork::FakeQuantizeConv,
+                                                  TestNetwork::ConvExtension),
+                                ::testing::Values(1, 2, 3, 5, 7, 8)),
+                        DynamicBatchInferTest::getTestCaseName);
+
+TEST(DynamicBatchSharedGraphTest, requestWithoutBatchLimitProcessesWholeBatch) {
+    auto ie = PluginCache::get().ie();
+    CNNNetwork network(ngraph::builder::subgraph::makeSplitConvConcat({maxBatch, 4, 20, 20}));
+
+    auto refNetwork = ie->LoadNetwork(network, "CPU");
+    auto dynNetwork = ie->LoadNetwork(network, "CPU",
+                                      {{PluginConfigParams::KEY_DYN_BATCH_ENABLED, PluginConfigParams::YES}});
+
+    const auto inputName = network.getInputsInfo().begin()->first;
+    const auto outputName = network.getOutputsInfo().begin()->first;
+    auto input = FuncTestUtils::createAndFillBlob(network.getInputsInfo().begin()->second->getTensorDesc());
+
+    auto refRequest = refNetwork.CreateInferRequest();
+    refRequest.SetBlob(inputName, input);
+    refRequest.Infer();
+    auto ref = refRequest.GetBlob(outputName);
+
+    // Both requests are inferred on the same stream, so they share the graph
+    auto limitedRequest = dynNetwork.CreateInferRequest();
+    limitedRequest.SetBlob(inputName, input);
+    limitedRequest.SetBatch(2);
+    limitedRequest.Infer();
+
+    // The request never sets the batch, the limit left by the previous one must not apply to it
+    auto fullRequest = dynNetwork.CreateInferRequest();
+    fullRequest.SetBlob(inputName, input);
+    fullRequest.Infer();
+    auto out = fullRequest.GetBlob(outputName);
+
+    ASSERT_EQ(ref->size(), out->size());
+    const auto refData = ref->cbuffer().as<const float*>();
+    const auto outData = out->cbuffer().as<const float*>();
+    for (size_t i = 0; i < ref->size(); i++) {
+        ASSERT_NEAR(refData[i], outData[i], 1e-4f) << "element " << i;
+    }
+}
+
+TEST(DynamicBatchExtensionTest, extensionWithoutDynamicBatchSupportIsRejected) {
+    Core ie;
+    ie.AddExtension(std::make_shared<DynBatchTestExtension>(false), "CPU");
+    CNNNetwork network(makeConvExtension({maxBatch, 4, 20, 20}));
+
+    ASSERT_NO_THROW(ie.LoadNetwork(network, "CPU"));
+    ASSERT_THROW(ie.LoadNetwork(network, "CPU", {{PluginConfigParams::KEY_DYN_BATCH_ENABLED, PluginConfigParams::YES}}),
+                 details::InferenceEngineException);
+}
+
+}  // namespace
@@ -0,0 +1,130 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ie_core.hpp>
+#include <ngraph/opsets/opset3.hpp>
+
+#include "functional_test_utils/blob_utils.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+class MemoryStatesInferTest : public ::testing::Test {
+protected:
+    // Accumulates the inputs in the state: out = in + state, state = out
+    void SetUp() override {
+        auto param = std::make_shared<ngraph::opset3::Parameter>(ngraph::element::f32, ngraph::Shape{1, size});
+        auto readValue = std::make_shared<ngraph::opset3::ReadValue>(param, "accumulator");
+        auto add = std::make_shared<ngraph::opset3::Add>(param, readValue);
+        auto assign = std::make_shared<ngraph::opset3::Assign>(add, "accumulator");
+        auto result = std::make_shared<ngraph::opset3::Result>(add);
+        assign->add_control_dependency(readValue);
+        result->add_control_dependency(assign);
+        auto function = std::make_shared<ngraph::Function>(ngraph::ResultVector{result},
+                                                           ngraph::ParameterVector{param}, "Accumulator");
+
+        CNNNetwork network(function);
+        inputName = network.getInputsInfo().begin()->first;
+        outputName = network.getOutputsInfo().begin()->first;
+        execNetwork = PluginCache::get().ie()->LoadNetwork(network, "CPU");
+    }
+
+    Blob::Ptr makeBlob(float value) {
+        auto blob = make_shared_blob<float>({Precision::FP32, {1, size}, Layout::NC});
+        blob->allocate();
+        std::fill_n(blob->buffer().as<float*>(), size, value);
+        return blob;
+    }
+
+    static void checkValue(const Blob::CPtr &blob, float value) {
+        const auto data = blob->cbuffer().as<const float*>();
+        for (size_t i = 0; i < blob->size(); i++) {
+            ASSERT_EQ(value, data[i]) << "element " << i;
+        }
+    }
+
+    void infer(InferRequest &request, float input, float expected) {
+        request.SetBlob(inputName, makeBlob(input));
+        request.Infer();
+        checkValue(request.GetBlob(outputName), expected);
+    }
+
+    static constexpr size_t size = 16;
+    ExecutableNetwork execNetwork;
+    std::string inputName, outputName;
+};
+
+constexpr size_t MemoryStatesInferTest::size;
+
+TEST_F(MemoryStatesInferTest, requestsKeepOwnStates) {
+    auto first = execNetwork.CreateInferRequest();
+    auto second = execNetwork.CreateInferRequest();
+
+    infer(first, 1.f, 1.f);
+    infer(first, 1.f, 2.f);
+    infer(second, 5.f, 5.f);
+    infer(first, 1.f, 3.f);
+
+    ASSERT_EQ(1u, first.QueryState().size());
+    checkValue(first.QueryState()[0].GetLastState(), 3.f);
+    checkValue(second.QueryState()[0].GetLastState(), 5.f);
+
+    first.QueryState()[0].Reset();
+    infer(first, 1.f, 1.f);
+    infer(second, 5.f, 10.f);
+}
+
+TEST_F(MemoryStatesInferTest, networkStateResetAppliesToAllRequests) {
+    auto first = execNetwork.CreateInferRequest();
+    auto second = execNetwork.CreateInferRequest();
+    infer(first, 1.f, 1.f);
+    infer(second, 2.f, 2.f);
+
+    auto states = execNetwork.QueryState();
+    ASSERT_EQ(1u, states.size());
+    // The network state reports the state of the earliest created request
+    checkValue(states[0].GetLastState(), 1.f);
+
+    states[0].Reset();
+    infer(first, 1.f, 1.f);
+    infer(second, 2.f, 2.f);
+}
+
+TEST_F(MemoryStatesInferTest, networkStateSetStateAppliesToAllAndNewRequests) {
+    auto first = execNetwork.CreateInferRequest();
+    auto second = execNetwork.CreateInferRequest();
+    infer(first, 1.f, 1.f);
+
+    auto states = execNetwork.QueryState();
+    ASSERT_EQ(1u, states.size());
+    states[0].SetState(makeBlob(7.f));
+    checkValue(first.QueryState()[0].GetLastState(), 7.f);
+    checkValue(second.QueryState()[0].GetLastState(), 7.f);
+
+    auto third = execNetwork.CreateInferRequest();
+    infer(third, 1.f, 8.f);
+    infer(first, 2.f, 9.f);
+    infer(second, 3.f, 10.f);
+}
+
+TEST_F(MemoryStatesInferTest, networkStateWithoutRequestsSetsInitialValue) {
+    auto states = execNetwork.QueryState();
+    ASSERT_EQ(1u, states.size());
+    states[0].SetState(makeBlob(3.f));
+    checkValue(states[0].GetLastState(), 3.f);
+
+    auto request = execNetwork.CreateInferRequest();
+    infer(request, 1.f, 4.f);
+    checkValue(states[0].GetLastState(), 4.f);
+}
+
+}  // namespace
@@ -0,0 +1,123 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+
+#include "functional_test_utils/blob_utils.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+class ShapeVariantsInferTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        ie = PluginCache::get().ie();
+        function = ngraph::builder::subgraph::makeSplitConvConcat({2, 4, 20, 20});
+        network = CNNNetwork(function);
+        inputName = network.getInputsInfo().begin()->first;
+        outputName = network.getOutputsInfo().begin()->first;
+    }
+
+    ExecutableNetwork loadNetwork(const std::string &cacheSize, const std::string &bucket) {
+        return ie->LoadNetwork(network, "CPU", {{PluginConfigParams::KEY_CPU_SHAPE_CACHE_SIZE, cacheSize},
+                                                {PluginConfigParams::KEY_CPU_SHAPE_BUCKET, bucket}});
+    }
+
+    // Infers the input on the network reshaped to its exact shape
+    Blob::Ptr reference(const Blob::Ptr &input) {
+        CNNNetwork refNetwork(function);
+        refNetwork.reshape({{inputName, input->getTensorDesc().getDims()}});
+        auto refRequest = ie->LoadNetwork(refNetwork, "CPU").CreateInferRequest();
+        refRequest.SetBlob(inputName, input);
+        refRequest.Infer();
+        return refRequest.GetBlob(outputName);
+    }
+
+    void inferAndCompare(InferRequest &request, const SizeVector &dims) {
+        auto input = FuncTestUtils::createAndFillBlob({Precision::FP32, dims, Layout::NCHW});
+        request.SetBlob(inputName, input);
+        request.Infer();
+        auto out = request.GetBlob(outputName);
+        auto ref = reference(input);
+
+        ASSERT_EQ(ref->getTensorDesc().getDims(), out->getTensorDesc().getDims());
+        const auto refData = ref->cbuffer().as<const float*>();
+        const auto outData = out->cbuffer().as<const float*>();
+        for (size_t i = 0; i < ref->size(); i++) {
+            ASSERT_NEAR(refData[i], outData[i], 1e-4f) << "element " << i;
+        }
+    }
+
+    std::shared_ptr<Core> ie;
+    std::shared_ptr<ngraph::Function> function;
+    CNNNetwork network;
+    std::string inputName, outputName;
+};
+
+TEST_F(ShapeVariantsInferTest, cachedAndEvictedVariantsMatchReshapedNetwork) {
+    auto execNetwork = loadNetwork("2", "1");
+    auto request = execNetwork.CreateInferRequest();
+
+    // The cache keeps two variants: the shapes are compiled, reused, evicted and compiled again,
+    // the network shape is served by the original graph
+    const std::vector<SizeVector> shapes = {
+        {2, 4, 16, 16}, {2, 4, 24, 24}, {2, 4, 16, 16}, {1, 4, 30, 20}, {2, 4, 24, 24}, {2, 4, 20, 20}, {1, 4, 30, 20}
+    };
+    for (const auto &dims : shapes) {
+        SCOPED_TRACE(::testing::PrintToString(dims));
+        inferAndCompare(request, dims);
+    }
+}
+
+TEST_F(ShapeVariantsInferTest, paddedBatchGivesOutputsOfInputBatch) {
+    auto execNetwork = loadNetwork("2", "4");
+    auto request = execNetwork.CreateInferRequest();
+
+    // Batches 3 and 4 share the variant of batch 4, batch 1 runs on the network of batch 2
+    for (size_t batch : {3, 4, 1, 3, 6, 2}) {
+        SCOPED_TRACE(batch);
+        inferAndCompare(request, {batch, 4, 20, 20});
+    }
+}
+
+TEST_F(ShapeVariantsInferTest, requestsOfSameNewShapeRunConcurrently) {
+    auto execNetwork = loadNetwork("1", "1");
+    const SizeVector dims = {2, 4, 28, 28};
+
+    std::vector<InferRequest> requests;
+    std::vector<Blob::Ptr> inputs;
+    for (int i = 0; i < 4; i++) {
+        requests.push_back(execNetwork.CreateInferRequest());
+        inputs.push_back(FuncTestUtils::createAndFillBlob({Precision::FP32, dims, Layout::NCHW}, 10, i));
+        requests.back().SetBlob(inputName, inputs.back());
+    }
+    for (auto &request : requests)
+        request.StartAsync();
+    for (auto &request : requests)
+        ASSERT_EQ(StatusCode::OK, request.Wait(IInferRequest::WaitMode::RESULT_READY));
+
+    for (size_t i = 0; i < requests.size(); i++) {
+        auto out = requests[i].GetBlob(outputName);
+        auto ref = reference(inputs[i]);
+        ASSERT_EQ(ref->getTensorDesc().getDims(), out->getTensorDesc().getDims());
+        const auto refData = ref->cbuffer().as<const float*>();
+        const auto outData = out->cbuffer().as<const float*>();
+        for (size_t j = 0; j < ref->size(); j++) {
+            ASSERT_NEAR(refData[j], outData[j], 1e-4f) << "request " << i << ", element " << j;
+        }
+    }
+}
+
+}  // namespace
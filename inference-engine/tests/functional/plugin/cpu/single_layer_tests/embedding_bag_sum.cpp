@@ -0,0 +1,186 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <tuple>
+#include <string>
+#include <vector>
+#include <memory>
+
+#include "functional_test_utils/layer_test_utils.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPULayerTestsDefinitions {
+
+enum class EmbeddingBagType {
+    Offsets,
+    OffsetsDefaultIndex,
+    OffsetsDefaultIndexWeights,
+    Packed,
+    PackedWeights
+};
+
+typedef std::tuple<
+        EmbeddingBagType,
+        bool,                   // Out of range indices
+        std::string> embeddingBagSumLayerCPUTestParamsSet;
+
+/*
+ * The nGraph interpreter has no EmbeddingBag reference, so the expected output is summed up here.
+ * Indices out of the embedding table select zero rows, as Gather does in the Gather+Reduce pattern.
+ */
+class EmbeddingBagSumLayerCPUTest : public testing::WithParamInterface<embeddingBagSumLayerCPUTestParamsSet>,
+                                    public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<embeddingBagSumLayerCPUTestParamsSet> obj) {
+        EmbeddingBagType bagType;
+        bool outOfRange;
+        std::string targetDevice;
+        std::tie(bagType, outOfRange, targetDevice) = obj.param;
+
+        std::ostringstream result;
+        result << "Type=" << typeName(bagType) << "_";
+        result << "outOfRangeIndices=" << outOfRange << "_";
+        result << "targetDevice=" << targetDevice;
+        return result.str();
+    }
+
+    InferenceEngine::Blob::Ptr GenerateInput(const InferenceEngine::InputInfo &info) const override {
+        // Weights are fractional to tell them apart from the counts of the repeated indices
+        if (info.name() == "per_sample_weights")
+            return FuncTestUtils::createAndFillBlob(info.getTensorDesc(), 3, -1, 4);
+        return FuncTestUtils::createAndFillBlob(info.getTensorDesc(), 20, -10);
+    }
+
+protected:
+    void SetUp() override {
+        bool outOfRange;
+        std::tie(bagType, outOfRange, targetDevice) = this->GetParam();
+
+        const bool packed = bagType == EmbeddingBagType::Packed || bagType == EmbeddingBagType::PackedWeights;
+        withWeights = bagType == EmbeddingBagType::OffsetsDefaultIndexWeights || bagType == EmbeddingBagType::PackedWeights;
+
+        // The offsets form has an empty bag, which is filled with the default row if any
+        if (packed) {
+            indices = {0, 2, 9, 4, 4, 1, 7, 3, 5};
+            indicesShape = {3, 3};
+            bags = {{0, 1, 2}, {3, 4, 5}, {6, 7, 8}};
+        } else {
+            indices = {0, 2, 9, 4, 4, 1, 7, 3};
+            indicesShape = {indices.size()};
+            offsets = {0, 2, 2, 5};
+            bags = {{0, 1}, {}, {2, 3, 4}, {5, 6, 7}};
+        }
+        if (outOfRange) {
+            indices[1] = static_cast<int32_t>(tableShape[0]) + 2;
+            indices[6] = -1;
+        }
+        if (bagType != EmbeddingBagType::Offsets)
+            defaultIndex = 8;
+
+        auto table = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape(tableShape));
+        table->set_friendly_name("emb_table");
+        auto indicesNode = ngraph::opset1::Constant::create(ngraph::element::i32, ngraph::Shape(indicesShape), indices);
+        ngraph::ParameterVector params{table};
+        std::shared_ptr<ngraph::opset1::Parameter> weights;
+        if (withWeights) {
+            weights = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape(indicesShape));
+            weights->set_friendly_name("per_sample_weights");
+            params.push_back(weights);
+        }
+
+        std::shared_ptr<ngraph::Node> embeddingBag;
+        if (packed) {
+            embeddingBag = withWeights ? std::make_shared<ngraph::op::v3::EmbeddingBagPackedSum>(table, indicesNode, weights)
+                                       : std::make_shared<ngraph::op::v3::EmbeddingBagPackedSum>(table, indicesNode);
+        } else {
+            auto offsetsNode = ngraph::opset1::Constant::create(ngraph::element::i32, ngraph::Shape{offsets.size()}, offsets);
+            if (bagType == EmbeddingBagType::Offsets) {
+                embeddingBag = std::make_shared<ngraph::op::v3::EmbeddingBagOffsetsSum>(table, indicesNode, offsetsNode);
+            } else {
+                auto defaultIndexNode = ngraph::opset1::Constant::create(ngraph::element::i32, ngraph::Shape{}, {defaultIndex});
+                embeddingBag = withWeights
+                        ? std::make_shared<ngraph::op::v3::EmbeddingBagOffsetsSum>(table, indicesNode, offsetsNode,
+                                                                                   defaultIndexNode, weights)
+                        : std::make_shared<ngraph::op::v3::EmbeddingBagOffsetsSum>(table, indicesNode, offsetsNode,
+                                                                                   defaultIndexNode);
+            }
+        }
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(embeddingBag)};
+        function = std::make_shared<ngraph::Function>(results, params, "EmbeddingBagSum");
+    }
+
+    std::vector<std::vector<std::uint8_t>> CalculateRefs() override {
+        // Inputs are ordered by name: the table goes before the weights
+        const auto table = inputs[0]->cbuffer().as<const float *>();
+        const auto weights = withWeights ? inputs[1]->cbuffer().as<const float *>() : nullptr;
+        const size_t tableRows = tableShape[0];
+        const size_t embDim = tableShape[1] * tableShape[2];
+
+        std::vector<float> expected(bags.size() * embDim, 0.f);
+        for (size_t b = 0; b < bags.size(); b++) {
+            float *dstRow = expected.data() + b * embDim;
+            if (bags[b].empty() && defaultIndex >= 0) {
+                std::copy(table + defaultIndex * embDim, table + (defaultIndex + 1) * embDim, dstRow);
+                continue;
+            }
+            for (size_t p : bags[b]) {
+                if (indices[p] < 0 || static_cast<size_t>(indices[p]) >= tableRows)
+                    continue;
+                const float w = weights ? weights[p] : 1.f;
+                for (size_t j = 0; j < embDim; j++)
+                    dstRow[j] += w * table[indices[p] * embDim + j];
+            }
+        }
+
+        const auto bytes = reinterpret_cast<const std::uint8_t *>(expected.data());
+        return {std::vector<std::uint8_t>(bytes, bytes + expected.size() * sizeof(float))};
+    }
+
+private:
+    static const char *typeName(EmbeddingBagType type) {
+        switch (type) {
+            case EmbeddingBagType::Offsets: return "Offsets";
+            case EmbeddingBagType::OffsetsDefaultIndex: return "OffsetsDefaultIndex";
+            case EmbeddingBagType::OffsetsDefaultIndexWeights: return "OffsetsDefaultIndexWeights";
+            case EmbeddingBagType::Packed: return "Packed";
+            case EmbeddingBagType::PackedWeights: return "PackedWeights";
+        }
+        return "";
+    }
+
+    EmbeddingBagType bagType = EmbeddingBagType::Offsets;
+    bool withWeights = false;
+    const std::vector<size_t> tableShape = {10, 3, 4};
+    std::vector<size_t> indicesShape;
+    std::vector<int32_t> indices;
+    std::vector<int32_t> offsets;
+    std::vector<std::vector<size_t>> bags;
+    int32_t defaultIndex = -1;
+};
+
+TEST_P(EmbeddingBagSumLayerCPUTest, CompareWithRefs) {
+    Run();
+}
+
+namespace {
+
+INSTANTIATE_TEST_CASE_P(smoke_EmbeddingBagSum_CPU, EmbeddingBagSumLayerCPUTest,
+                        ::testing::Combine(
+                                ::testing::Values(EmbeddingBagType::Offsets,
+                                                  EmbeddingBagType::OffsetsDefaultIndex,
+                                                  EmbeddingBagType::OffsetsDefaultIndexWeights,
+                                                  EmbeddingBagType::Packed,
+                                                  EmbeddingBagType::PackedWeights),
+                                ::testing::Values(false, true),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        EmbeddingBagSumLayerCPUTest::getTestCaseName);
+
+}  // namespace
+
+}  // namespace CPULayerTestsDefinitions
@@ -0,0 +1,159 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <tuple>
+#include <string>
+#include <vector>
+#include <memory>
+
+#include "functional_test_utils/layer_test_utils.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "network_serializer.h"
+
+using namespace InferenceEngine;
+
+namespace CPULayerTestsDefinitions {
+
+enum class ReduceType {
+    Mean,
+    Sum,
+    Max
+};
+
+typedef std::tuple<
+        ReduceType,
+        std::vector<int64_t>,   // Axes
+        bool,                   // Fuse Relu
+        std::vector<size_t>,    // Input shape
+        std::string> reduceU8LayerCPUTestParamsSet;
+
+/*
+ * The reduced values (a sum of up to 16 inputs in [0, 200)) don't fit u8 while the result of the operation does,
+ * so the output is only correct if the node accumulates in a wider type and converts the result once.
+ */
+class ReduceU8OutputLayerCPUTest : public testing::WithParamInterface<reduceU8LayerCPUTestParamsSet>,
+                                   public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<reduceU8LayerCPUTestParamsSet> obj) {
+        ReduceType reduceType;
+        std::vector<int64_t> axes;
+        bool fuseRelu;
+        std::vector<size_t> inputShape;
+        std::string targetDevice;
+        std::tie(reduceType, axes, fuseRelu, inputShape, targetDevice) = obj.param;
+
+        std::ostringstream result;
+        result << "Type=" << (reduceType == ReduceType::Mean ? "Mean" : reduceType == ReduceType::Sum ? "Sum" : "Max") << "_";
+        result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        result << "axes=" << CommonTestUtils::vec2str(axes) << "_";
+        result << "fuseRelu=" << fuseRelu << "_";
+        result << "targetDevice=" << targetDevice;
+        return result.str();
+    }
+
+    InferenceEngine::Blob::Ptr GenerateInput(const InferenceEngine::InputInfo &info) const override {
+        // Sum is checked on small values only, its exact result has to fit u8 as well
+        const uint32_t range = reduceType == ReduceType::Sum ? 15 : 200;
+        return FuncTestUtils::createAndFillBlob(info.getTensorDesc(), range);
+    }
+
+    void Compare(const std::vector<std::uint8_t> &expected, const InferenceEngine::Blob::Ptr &actual) override {
+        ASSERT_EQ(Precision::U8, actual->getTensorDesc().getPrecision());
+        ASSERT_EQ(expected.size(), actual->byteSize());
+
+        auto memory = InferenceEngine::as<InferenceEngine::MemoryBlob>(actual);
+        IE_ASSERT(memory);
+        const auto lockedMemory = memory->rmap();
+        const auto actualBuffer = lockedMemory.as<const std::uint8_t *>();
+
+        // the reference truncates Mean to u8 while the plugin rounds it
+        for (size_t i = 0; i < expected.size(); i++) {
+            ASSERT_LE(std::abs(static_cast<int>(expected[i]) - static_cast<int>(actualBuffer[i])), 1)
+                << "at index " << i << " expected: " << static_cast<int>(expected[i])
+                << " actual: " << static_cast<int>(actualBuffer[i]);
+        }
+    }
+
+protected:
+    void SetUp() override {
+        std::vector<int64_t> axes;
+        std::vector<size_t> inputShape;
+        std::tie(reduceType, axes, fuseRelu, inputShape, targetDevice) = this->GetParam();
+
+        auto ngPrc = ngraph::element::f32;
+        auto params = ngraph::builder::makeParams(ngPrc, {inputShape});
+        auto axesNode = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{axes.size()}, axes);
+
+        std::shared_ptr<ngraph::Node> reduce;
+        switch (reduceType) {
+            case ReduceType::Mean:
+                reduce = std::make_shared<ngraph::opset1::ReduceMean>(params[0], axesNode, true);
+                break;
+            case ReduceType::Sum:
+                reduce = std::make_shared<ngraph::opset1::ReduceSum>(params[0], axesNode, true);
+                break;
+            case ReduceType::Max:
+                reduce = std::make_shared<ngraph::opset1::ReduceMax>(params[0], axesNode, true);
+                break;
+        }
+
+        std::shared_ptr<ngraph::Node> output = reduce;
+        if (fuseRelu)
+            output = std::make_shared<ngraph::opset1::Relu>(reduce);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(output)};
+        function = std::make_shared<ngraph::Function>(results, params, "ReduceU8Output");
+
+        outPrc = Precision::U8;
+    }
+
+    ReduceType reduceType = ReduceType::Mean;
+    bool fuseRelu = false;
+};
+
+TEST_P(ReduceU8OutputLayerCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    IE_SUPPRESS_DEPRECATED_START
+    InferenceEngine::CNNNetwork execGraphInfo = executableNetwork.GetExecGraphInfo();
+    auto nodes = InferenceEngine::Serialization::TopologicalSort(execGraphInfo);
+    size_t reduceCount = 0, activationCount = 0;
+    for (auto &node : nodes) {
+        if (node->type == "Reduce")
+            reduceCount++;
+        if (node->type == "Activation")
+            activationCount++;
+    }
+    IE_SUPPRESS_DEPRECATED_END
+
+    ASSERT_EQ(1, reduceCount);
+    // Relu has to be fused into Reduce
+    ASSERT_EQ(0, activationCount);
+}
+
+namespace {
+
+// the axes are not consecutive, so the operation is not converted to Pooling, and the channels are kept, so the
+// node accepts fused operations
+const std::vector<std::vector<int64_t>> axes = {
+        {0, 3},
+        {0, 2},
+};
+
+INSTANTIATE_TEST_CASE_P(Reduce_U8_Output, ReduceU8OutputLayerCPUTest,
+                        ::testing::Combine(
+                                ::testing::Values(ReduceType::Mean, ReduceType::Sum, ReduceType::Max),
+                                ::testing::ValuesIn(axes),
+                                ::testing::Values(false, true),
+                                ::testing::Values(std::vector<size_t>({2, 16, 8, 8}), std::vector<size_t>({2, 19, 8, 8})),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        ReduceU8OutputLayerCPUTest::getTestCaseName);
+
+} // namespace
+
+} // namespace CPULayerTestsDefinitions
@@ -0,0 +1,91 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+
+#include "functional_test_utils/blob_utils.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+#include "ngraph/opsets/opset1.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+// compression mode, maximal error relative to the maximal magnitude of the reference output
+using WeightsCompressionParams = std::tuple<std::string, float>;
+
+class FullyConnectedWeightsCompressionTest : public ::testing::TestWithParam<WeightsCompressionParams> {
+protected:
+    static std::shared_ptr<ngraph::Function> makeFullyConnected(size_t batch, size_t inputChannels, size_t outputChannels) {
+        auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{batch, inputChannels});
+
+        std::vector<float> weightsValues(inputChannels * outputChannels);
+        FuncTestUtils::fillInputsBySinValues(weightsValues.data(), weightsValues.size());
+        auto weights = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{inputChannels, outputChannels}, weightsValues);
+        auto matMul = std::make_shared<ngraph::opset1::MatMul>(input, weights);
+
+        std::vector<float> biasValues(outputChannels, 0.5f);
+        auto bias = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{1, outputChannels}, biasValues);
+        auto add = std::make_shared<ngraph::opset1::Add>(matMul, bias);
+        auto relu = std::make_shared<ngraph::opset1::Relu>(add);
+
+        return std::make_shared<ngraph::Function>(ngraph::NodeVector{relu}, ngraph::ParameterVector{input});
+    }
+};
+
+TEST_P(FullyConnectedWeightsCompressionTest, compressedWeightsGiveCloseResults) {
+    std::string compression;
+    float threshold;
+    std::tie(compression, threshold) = GetParam();
+
+    constexpr size_t batch = 3;
+    // the number of input channels is not a multiple of the INT4 group to check the partial group
+    CNNNetwork network(makeFullyConnected(batch, 100, 48));
+    auto ie = PluginCache::get().ie();
+    auto refNetwork = ie->LoadNetwork(network, "CPU");
+    auto compressedNetwork = ie->LoadNetwork(network, "CPU", {{PluginConfigParams::KEY_CPU_WEIGHTS_COMPRESSION, compression}});
+
+    const auto inputName = network.getInputsInfo().begin()->first;
+    const auto outputName = network.getOutputsInfo().begin()->first;
+    auto input = make_shared_blob<float>(network.getInputsInfo().begin()->second->getTensorDesc());
+    input->allocate();
+    FuncTestUtils::fillInputsBySinValues(input->buffer().as<float*>(), input->size());
+
+    auto refRequest = refNetwork.CreateInferRequest();
+    refRequest.SetBlob(inputName, input);
+    refRequest.Infer();
+    auto ref = refRequest.GetBlob(outputName);
+
+    auto request = compressedNetwork.CreateInferRequest();
+    request.SetBlob(inputName, input);
+    request.Infer();
+    auto out = request.GetBlob(outputName);
+
+    ASSERT_EQ(ref->size(), out->size());
+    const auto refData = ref->cbuffer().as<const float*>();
+    const auto outData = out->cbuffer().as<const float*>();
+    float maxMagnitude = 0.f;
+    for (size_t i = 0; i < ref->size(); i++)
+        maxMagnitude = std::max(maxMagnitude, std::fabs(refData[i]));
+    for (size_t i = 0; i < ref->size(); i++) {
+        ASSERT_NEAR(refData[i], outData[i], threshold * maxMagnitude) << "element " << i;
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(smoke_WeightsCompression, FullyConnectedWeightsCompressionTest,
+                        ::testing::Values(std::make_tuple(PluginConfigParams::NO, 1e-5f),
+                                          std::make_tuple(PluginConfigParams::I8, 0.02f),
+                                          std::make_tuple(PluginConfigParams::I4, 0.15f)));
+
+}  // namespace
@@ -0,0 +1,96 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cmath>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ie_core.hpp>
+#include <gna/gna_config.hpp>
+#include <ngraph/opsets/opset1.hpp>
+
+#include "functional_test_utils/blob_utils.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+std::shared_ptr<ngraph::Node> makeWeights(size_t rows, size_t columns) {
+    std::vector<float> values(rows * columns);
+    for (size_t i = 0; i < values.size(); i++)
+        values[i] = 0.1f * std::sin(static_cast<float>(i));
+    return ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{rows, columns}, values);
+}
+
+std::shared_ptr<ngraph::Function> makeAffineRelu() {
+    auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 64});
+    auto matMul1 = std::make_shared<ngraph::opset1::MatMul>(param, makeWeights(64, 32));
+    auto relu = std::make_shared<ngraph::opset1::Relu>(matMul1);
+    auto matMul2 = std::make_shared<ngraph::opset1::MatMul>(relu, makeWeights(32, 16));
+    return std::make_shared<ngraph::Function>(ngraph::ResultVector{std::make_shared<ngraph::opset1::Result>(matMul2)},
+                                              ngraph::ParameterVector{param}, "AffineRelu");
+}
+
+class GnaSwFp32ParallelRequestsTest : public ::testing::TestWithParam<size_t> {};
+
+TEST_P(GnaSwFp32ParallelRequestsTest, parallelRequestsMatchSerialExecution) {
+    const size_t numRequests = GetParam();
+    CNNNetwork network(makeAffineRelu());
+    const auto inputName = network.getInputsInfo().begin()->first;
+    const auto outputName = network.getOutputsInfo().begin()->first;
+    const auto& inputDesc = network.getInputsInfo().begin()->second->getTensorDesc();
+
+    std::vector<Blob::Ptr> inputs;
+    for (size_t i = 0; i < numRequests; i++)
+        inputs.push_back(FuncTestUtils::createAndFillBlob(inputDesc, 10, static_cast<int32_t>(i)));
+
+    auto ie = PluginCache::get().ie();
+    auto serialNetwork = ie->LoadNetwork(network, "GNA", {{GNA_CONFIG_KEY(DEVICE_MODE), GNAConfigParams::GNA_SW_FP32}});
+    auto serialRequest = serialNetwork.CreateInferRequest();
+    std::vector<Blob::Ptr> references;
+    for (auto& input : inputs) {
+        serialRequest.SetBlob(inputName, input);
+        serialRequest.Infer();
+        auto output = serialRequest.GetBlob(outputName);
+        auto reference = make_blob_with_precision(output->getTensorDesc());
+        reference->allocate();
+        std::copy_n(output->cbuffer().as<const float*>(), output->size(), reference->buffer().as<float*>());
+        references.push_back(reference);
+    }
+
+    auto parallelNetwork = ie->LoadNetwork(network, "GNA", {{GNA_CONFIG_KEY(DEVICE_MODE), GNAConfigParams::GNA_SW_FP32},
+                                                           {GNA_CONFIG_KEY(LIB_N_THREADS), std::to_string(numRequests)}});
+    std::vector<InferRequest> requests;
+    for (size_t i = 0; i < numRequests; i++) {
+        requests.push_back(parallelNetwork.CreateInferRequest());
+        requests.back().SetBlob(inputName, inputs[i]);
+    }
+    // Two rounds check that the requests are reused with their own intermediate buffers
+    for (int round = 0; round < 2; round++) {
+        for (auto& request : requests)
+            request.StartAsync();
+        for (auto& request : requests)
+            ASSERT_EQ(StatusCode::OK, request.Wait(IInferRequest::WaitMode::RESULT_READY));
+
+        for (size_t i = 0; i < numRequests; i++) {
+            auto output = requests[i].GetBlob(outputName);
+            ASSERT_EQ(references[i]->size(), output->size());
+            const auto refData = references[i]->cbuffer().as<const float*>();
+            const auto outData = output->cbuffer().as<const float*>();
+            for (size_t j = 0; j < output->size(); j++) {
+                ASSERT_NEAR(refData[j], outData[j], 1e-5f) << "request " << i << ", element " << j;
+            }
+        }
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(smoke_GnaSwFp32ParallelRequests, GnaSwFp32ParallelRequestsTest,
+                        ::testing::Values(2, 4));
+
+}  // namespace
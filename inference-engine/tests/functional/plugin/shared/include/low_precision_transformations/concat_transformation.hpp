@@ -11,7 +11,7 @@
 
 namespace LayerTestsDefinitions {
 
-class ConcatTransformation : public LayerTestsUtils::LayerTransformation {
+class ConcatTransformation : public testing::WithParamInterface<LayerTestsUtils::basicParams>, public LayerTestsUtils::LayerTransformation {
 public:
     static std::string getTestCaseName(testing::TestParamInfo<LayerTestsUtils::basicParams> obj);
 
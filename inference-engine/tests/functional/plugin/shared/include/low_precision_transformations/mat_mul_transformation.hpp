@@ -0,0 +1,43 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+#include <memory>
+#include <tuple>
+
+#include "functional_test_utils/low_precision_transformations/layer_transformation.hpp"
+
+namespace LayerTestsDefinitions {
+
+typedef std::tuple<
+    InferenceEngine::Precision,
+    InferenceEngine::SizeVector,
+    std::string,
+    bool,   // weights on the second input
+    bool    // per channel quantization of activations
+> MatMulTransformationParams;
+
+class MatMulTransformation : public testing::WithParamInterface<MatMulTransformationParams>, public LayerTestsUtils::LayerTransformation {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<MatMulTransformationParams> obj);
+
+protected:
+    void SetUp() override;
+
+    void validateExecution();
+
+private:
+    std::shared_ptr<ngraph::opset1::FakeQuantize> makeFakeQuantize(
+        const ngraph::Output<ngraph::Node>& output,
+        const std::vector<float>& low,
+        const std::vector<float>& high,
+        size_t levels);
+    void validate();
+
+    bool onWeights = false;
+};
+
+}  // namespace LayerTestsDefinitions
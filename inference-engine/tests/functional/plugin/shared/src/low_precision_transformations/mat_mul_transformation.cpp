@@ -0,0 +1,172 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <tuple>
+#include <vector>
+#include <string>
+
+#include <ie_core.hpp>
+
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+#include "functional_test_utils/layer_test_utils.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+
+#include "ngraph_functions/pass/convert_prc.hpp"
+#include "network_serializer.h"
+
+#include "low_precision_transformations/mat_mul_transformation.hpp"
+
+
+namespace LayerTestsDefinitions {
+
+std::string MatMulTransformation::getTestCaseName(testing::TestParamInfo<MatMulTransformationParams> obj) {
+    InferenceEngine::Precision netPrecision;
+    InferenceEngine::SizeVector inputShapes;
+    std::string targetDevice;
+    bool onWeights;
+    bool perChannel;
+    std::tie(netPrecision, inputShapes, targetDevice, onWeights, perChannel) = obj.param;
+
+    std::ostringstream result;
+    result << "inputShapes=" << CommonTestUtils::vec2str(inputShapes) << "_";
+    result << "netPrecision=" << netPrecision.name() << "_";
+    result << "onWeights=" << onWeights << "_";
+    result << "perChannel=" << perChannel << "_";
+    result << "targetDevice=" << targetDevice;
+    return result.str();
+}
+
+void MatMulTransformation::SetUp() {
+    SetRefMode(LayerTestsUtils::RefMode::IE);
+
+    InferenceEngine::SizeVector inputShape;
+    InferenceEngine::Precision netPrecision;
+    bool perChannel;
+    std::tie(netPrecision, inputShape, targetDevice, onWeights, perChannel) = this->GetParam();
+    auto ngPrc = FuncTestUtils::PrecisionUtils::convertIE2nGraphPrc(netPrecision);
+
+    // quantization intervals differ per channel, channels are the batch dimension of the 4D Gemm
+    const size_t channels = perChannel ? inputShape[1] : 1ul;
+    std::vector<float> low1(channels, 0.f), high1(channels);
+    std::vector<float> low2(channels), high2(channels);
+    for (size_t channel = 0; channel < channels; ++channel) {
+        high1[channel] = 25.5f * (channel + 1) / channels;
+        high2[channel] = 1.27f * (channel + 1) / channels;
+        low2[channel] = -high2[channel];
+    }
+
+    // unsigned activations on the first input
+    const auto paramNode1 = std::make_shared<ngraph::opset1::Parameter>(ngPrc, ngraph::Shape(inputShape));
+    const auto fakeQuantize1 = makeFakeQuantize(paramNode1->output(0), low1, high1, 256ul);
+
+    // signed activations or weights quantized per tensor on the second input
+    ngraph::ParameterVector parameters { paramNode1 };
+    std::shared_ptr<ngraph::opset1::FakeQuantize> fakeQuantize2;
+    if (onWeights) {
+        const size_t weightsSize = ngraph::shape_size(inputShape);
+        std::vector<float> weights(weightsSize);
+        for (size_t i = 0; i < weightsSize; ++i) {
+            weights[i] = static_cast<float>(static_cast<int>(i % 255ul) - 127) / 100.f;
+        }
+        const auto weightsNode = std::make_shared<ngraph::opset1::Constant>(ngPrc, ngraph::Shape(inputShape), weights);
+        fakeQuantize2 = makeFakeQuantize(weightsNode->output(0), { -1.27f }, { 1.27f }, 255ul);
+    } else {
+        const auto paramNode2 = std::make_shared<ngraph::opset1::Parameter>(ngPrc, ngraph::Shape(inputShape));
+        fakeQuantize2 = makeFakeQuantize(paramNode2->output(0), low2, high2, 255ul);
+        parameters.push_back(paramNode2);
+    }
+
+    const auto matMul = std::make_shared<ngraph::opset1::MatMul>(fakeQuantize1->output(0), fakeQuantize2->output(0), false, true);
+
+    ngraph::ResultVector results {std::make_shared<ngraph::opset1::Result>(matMul)};
+    function = std::make_shared<ngraph::Function>(results, parameters, "MatMulTransformation");
+
+    // TODO: move to some another place
+    validate();
+}
+
+std::shared_ptr<ngraph::opset1::FakeQuantize> MatMulTransformation::makeFakeQuantize(
+    const ngraph::Output<ngraph::Node>& input,
+    const std::vector<float>& low,
+    const std::vector<float>& high,
+    const size_t levels) {
+    const ngraph::Shape shape { 1, low.size(), 1, 1 };
+    auto lowConst = std::make_shared<ngraph::op::Constant>(ngraph::element::f32, shape, low);
+    auto highConst = std::make_shared<ngraph::op::Constant>(ngraph::element::f32, shape, high);
+    auto fakeQuantize = std::make_shared<ngraph::opset1::FakeQuantize>(input, lowConst, highConst, lowConst, highConst, levels);
+    return fakeQuantize;
+}
+
+void MatMulTransformation::validate() {
+    const InferenceEngine::CNNNetwork network = transform();
+
+    IE_SUPPRESS_DEPRECATED_START
+
+    InferenceEngine::OutputsDataMap outputs = network.getOutputsInfo();
+    EXPECT_EQ(1, outputs.size());
+
+    std::map<std::string, InferenceEngine::DataPtr>::iterator it = outputs.begin();
+    const InferenceEngine::CNNLayerPtr outputLayer = it->second->getCreatorLayer().lock();
+    EXPECT_TRUE(outputLayer != nullptr);
+    EXPECT_EQ("ScaleShift", outputLayer->type);
+
+    const InferenceEngine::CNNLayerPtr gemm = outputLayer->insData[0].lock()->getCreatorLayer().lock();
+    EXPECT_TRUE(gemm != nullptr);
+    EXPECT_EQ("Gemm", gemm->type);
+
+    EXPECT_EQ(InferenceEngine::Precision::U8, gemm->insData[0].lock()->getPrecision());
+    EXPECT_EQ(InferenceEngine::Precision::I8, gemm->insData[1].lock()->getPrecision());
+    if (onWeights) {
+        const InferenceEngine::CNNLayerPtr weights = gemm->insData[1].lock()->getCreatorLayer().lock();
+        EXPECT_TRUE(weights != nullptr);
+        EXPECT_EQ("Const", weights->type);
+    }
+
+    IE_SUPPRESS_DEPRECATED_END
+}
+
+void MatMulTransformation::validateExecution() {
+    // the Gemm of the executable graph reads low precision data produced by quantization or constant weights
+    InferenceEngine::CNNNetwork execGraphInfo = executableNetwork.GetExecGraphInfo();
+    auto nodes = InferenceEngine::Serialization::TopologicalSort(execGraphInfo);
+
+    IE_SUPPRESS_DEPRECATED_START
+
+    size_t gemmsCount = 0;
+    for (auto &node : nodes) {
+        if (node->type != "Gemm") {
+            continue;
+        }
+        gemmsCount++;
+
+        ASSERT_EQ(2ul, node->insData.size());
+        const std::vector<std::string> expectedPrecisions { "U8", "I8" };
+        for (size_t i = 0; i < node->insData.size(); i++) {
+            const InferenceEngine::CNNLayerPtr parent = node->insData[i].lock()->getCreatorLayer().lock();
+            ASSERT_TRUE(parent != nullptr);
+            auto precision = parent->params.find("outputPrecisions");
+            ASSERT_NE(parent->params.end(), precision);
+            EXPECT_EQ(expectedPrecisions[i], precision->second) << "input " << i << " of " << node->name;
+        }
+    }
+    EXPECT_EQ(1ul, gemmsCount);
+
+    IE_SUPPRESS_DEPRECATED_END
+}
+
+TEST_P(MatMulTransformation, CompareWithRefImpl) {
+    Run();
+
+    if (targetDevice == std::string{CommonTestUtils::DEVICE_CPU}) {
+        validateExecution();
+    }
+
+    if (targetDevice == std::string{CommonTestUtils::DEVICE_GPU}) {
+        PluginCache::get().reset();
+    }
+};
+
+}  // namespace LayerTestsDefinitions
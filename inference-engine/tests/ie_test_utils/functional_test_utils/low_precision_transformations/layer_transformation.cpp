@@ -19,6 +19,7 @@
 #include "ie_util_internal.hpp"
 #include "functional_test_utils/low_precision_transformations/layer_transformation.hpp"
 #include "low_precision_transformations/convolution.hpp"
+#include "low_precision_transformations/gemm.hpp"
 #include "low_precision_transformations/scaleshift_to_convolution.hpp"
 
 
@@ -29,6 +30,7 @@ namespace LayerTestsUtils {
             return InferenceEngine::details::LowPrecisionTransformer::getAllTransformations(params).
                 add<InferenceEngine::details::ConvolutionTransformation>(InferenceEngine::details::LayerTransformation::Params(params).
                     setPrecisionsOnActivations({ InferenceEngine::Precision::U8 }), "Convolution").
+                add<InferenceEngine::details::GemmTransformation>(params, "Gemm").
                 addCleanup<InferenceEngine::details::ScaleShiftToConvolutionTransformation>(
                     InferenceEngine::details::LayerTransformation::Params(params).setPrecisionsOnActivations({ InferenceEngine::Precision::U8 }),
                     "ScaleShift");
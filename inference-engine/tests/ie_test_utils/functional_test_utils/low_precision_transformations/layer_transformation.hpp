@@ -9,7 +9,7 @@
 
 namespace LayerTestsUtils {
 
-class LayerTransformation : public testing::WithParamInterface<LayerTestsUtils::basicParams>, public LayerTestsUtils::LayerTestsCommon {
+class LayerTransformation : public LayerTestsUtils::LayerTestsCommon {
 public:
     InferenceEngine::details::LowPrecisionTransformations getLowPrecisionTransformations(
         const InferenceEngine::details::LayerTransformation::Params& params) const;
@@ -0,0 +1,156 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ie_streaming_session.hpp"
+
+#include "unit_test_utils/mocks/mock_iexecutable_network.hpp"
+#include "unit_test_utils/mocks/mock_iinfer_request.hpp"
+#include "unit_test_utils/mocks/mock_ie_imemory_state.hpp"
+
+using testing::_;
+using testing::Invoke;
+using testing::NiceMock;
+
+namespace {
+
+constexpr size_t frameSize = 2;
+
+// A request of an accumulating network: the state is the sum of all frames, the score is the updated state
+struct AccumulatorRequest {
+    std::shared_ptr<NiceMock<MockIInferRequest>> request = std::make_shared<NiceMock<MockIInferRequest>>();
+    std::shared_ptr<NiceMock<MockIMemoryState>> state = std::make_shared<NiceMock<MockIMemoryState>>();
+    Blob::Ptr input = make_shared_blob<float>({Precision::FP32, {1, frameSize}, Layout::NC});
+    Blob::Ptr output = make_shared_blob<float>({Precision::FP32, {1, frameSize}, Layout::NC});
+    Blob::Ptr stateBlob = make_shared_blob<float>({Precision::FP32, {1, frameSize}, Layout::NC});
+
+    AccumulatorRequest() {
+        input->allocate();
+        output->allocate();
+        stateBlob->allocate();
+        std::memset(stateBlob->buffer(), 0, stateBlob->byteSize());
+
+        ON_CALL(*request, GetBlob(_, _, _)).WillByDefault(Invoke([this](const char* name, Blob::Ptr& data, ResponseDesc*) {
+            data = std::string(name) == "input" ? input : output;
+            return OK;
+        }));
+        ON_CALL(*request, QueryState(_, _, _)).WillByDefault(Invoke([this](IMemoryState::Ptr& pState, size_t idx, ResponseDesc*) {
+            if (idx > 0)
+                return OUT_OF_BOUNDS;
+            pState = state;
+            return OK;
+        }));
+        ON_CALL(*request, Infer(_)).WillByDefault(Invoke([this](ResponseDesc*) {
+            auto stateData = stateBlob->buffer().as<float*>();
+            for (size_t i = 0; i < frameSize; i++) {
+                stateData[i] += input->cbuffer().as<const float*>()[i];
+                output->buffer().as<float*>()[i] = stateData[i];
+            }
+            return OK;
+        }));
+
+        ON_CALL(*state, GetName(_, _, _)).WillByDefault(Invoke([](char* name, size_t len, ResponseDesc*) {
+            std::strncpy(name, "sum", len);
+            return OK;
+        }));
+        ON_CALL(*state, Reset(_)).WillByDefault(Invoke([this](ResponseDesc*) {
+            std::memset(stateBlob->buffer(), 0, stateBlob->byteSize());
+            return OK;
+        }));
+        ON_CALL(*state, GetLastState(_, _)).WillByDefault(Invoke([this](Blob::CPtr& lastState, ResponseDesc*) {
+            lastState = stateBlob;
+            return OK;
+        }));
+        ON_CALL(*state, SetState(_, _)).WillByDefault(Invoke([this](Blob::Ptr newState, ResponseDesc*) {
+            std::memcpy(stateBlob->buffer(), newState->cbuffer().as<const void*>(), stateBlob->byteSize());
+            return OK;
+        }));
+    }
+};
+
+class StreamingSessionTests : public ::testing::Test {
+protected:
+    std::shared_ptr<NiceMock<MockIExecutableNetwork>> mockIExeNet_p = std::make_shared<NiceMock<MockIExecutableNetwork>>();
+    std::vector<std::unique_ptr<AccumulatorRequest>> requests;
+
+    ExecutableNetwork CreateNetwork(size_t numRequests) {
+        for (size_t i = 0; i < numRequests; i++)
+            requests.emplace_back(new AccumulatorRequest);
+
+        const TensorDesc desc(Precision::FP32, {1, frameSize}, Layout::NC);
+        auto inputInfo = std::make_shared<InputInfo>();
+        inputInfo->setInputData(std::make_shared<Data>("input", desc));
+        ConstInputsDataMap inputs = {{"input", inputInfo}};
+        ConstOutputsDataMap outputs = {{"output", std::make_shared<Data>("output", desc)}};
+
+        ON_CALL(*mockIExeNet_p, GetInputsInfo(_, _)).WillByDefault(Invoke([inputs](ConstInputsDataMap& info, ResponseDesc*) {
+            info = inputs;
+            return OK;
+        }));
+        ON_CALL(*mockIExeNet_p, GetOutputsInfo(_, _)).WillByDefault(Invoke([outputs](ConstOutputsDataMap& info, ResponseDesc*) {
+            info = outputs;
+            return OK;
+        }));
+        size_t created = 0;
+        ON_CALL(*mockIExeNet_p, CreateInferRequest(_, _)).WillByDefault(Invoke([this, created](IInferRequest::Ptr& req, ResponseDesc*) mutable {
+            req = requests[created++]->request;
+            return OK;
+        }));
+        return ExecutableNetwork(mockIExeNet_p);
+    }
+};
+
+TEST_F(StreamingSessionTests, sessionsSharingRequestKeepOwnStates) {
+    StreamingPool pool(CreateNetwork(1), 1);
+    auto first = pool.OpenSession();
+    auto second = pool.OpenSession();
+    ASSERT_EQ(frameSize, first->GetFrameSize());
+    ASSERT_EQ(frameSize, first->GetScoreSize());
+
+    const std::vector<float> firstFrame = {1.f, 2.f};
+    const std::vector<float> secondFrame = {10.f, 20.f};
+    std::vector<float> firstScores, secondScores;
+    // The only request is passed between the sessions, the states are swapped every time
+    for (int i = 0; i < 2; i++) {
+        ASSERT_EQ(1, first->Push(firstFrame.data(), 1, firstScores));
+        ASSERT_EQ(1, second->Push(secondFrame.data(), 1, secondScores));
+    }
+
+    EXPECT_EQ(std::vector<float>({1.f, 2.f, 2.f, 4.f}), firstScores);
+    EXPECT_EQ(std::vector<float>({10.f, 20.f, 20.f, 40.f}), secondScores);
+}
+
+TEST_F(StreamingSessionTests, contextFramesAreRepeatedAndScoresDelayed) {
+    StreamingConfig config;
+    config.leftContext = 1;
+    config.rightContext = 1;
+    StreamingPool pool(CreateNetwork(1), 1, config);
+    auto session = pool.OpenSession();
+
+    const std::vector<float> frames = {1.f, 1.f, 2.f, 2.f, 3.f, 3.f};
+    std::vector<float> scores;
+    // Inferred frames: 1 1 2 | 3 | 3 on finish, the first two scores are dropped
+    EXPECT_EQ(1, session->Push(frames.data(), 2, scores));
+    EXPECT_EQ(1, session->Push(frames.data() + 2 * frameSize, 1, scores));
+    EXPECT_EQ(1, session->Finish(scores));
+    EXPECT_EQ(std::vector<float>({4.f, 4.f, 7.f, 7.f, 10.f, 10.f}), scores);
+
+    // Finish resets the session for the next stream
+    scores.clear();
+    EXPECT_EQ(0, session->Push(frames.data(), 1, scores));
+    EXPECT_EQ(1, session->Finish(scores));
+    EXPECT_EQ(std::vector<float>({3.f, 3.f}), scores);
+}
+
+TEST_F(StreamingSessionTests, throwsForNetworkWithoutRequests) {
+    ASSERT_THROW(StreamingPool(CreateNetwork(0), 0), details::InferenceEngineException);
+}
+
+}  // namespace
@@ -13,3 +13,11 @@ ti_test_params ti_test_cases[] = {{std::string("CPU"), 1, InferenceEngine::Preci
 RUN_CASE_P_WITH_SUFFIX(CPU, _smoke, TITest, ti_test_cases);
 
 RUN_CASE_P_WITH_SUFFIX(CPU, _smoke, TITest2, ti_test_cases);
+
+ti_test_params ti_fp32_test_cases[] = {{std::string("CPU"), 1, InferenceEngine::Precision(InferenceEngine::Precision::FP32)},
+                                       {std::string("CPU"), 8, InferenceEngine::Precision(InferenceEngine::Precision::FP32)},
+                                       {std::string("CPU"), 64, InferenceEngine::Precision(InferenceEngine::Precision::FP32)}};
+
+RUN_CASE_P_WITH_SUFFIX(CPU, _smoke, TITest3, ti_fp32_test_cases);
+
+RUN_CASE_P_WITH_SUFFIX(CPU, _smoke, TITest4, ti_fp32_test_cases);
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <vector>
 #include <string>
 #include <gtest/gtest.h>
@@ -329,3 +330,354 @@ protected:
 using TITest2  = TITest2Base;
 
 TEST_P(TITest2, TestsWitCopy) { RunTITest(); }
+
+/*
+  TI with recurrent state and both per iteration and final outputs. Checks values on repeated inference.
+
+         ______________main_ti__________________
+  in1 --|~~ iter  -> add -> plus_one -> next1   |-- out2
+  in2 --|~~ prev1 -> add -> out_iter ~~~~~~~~~~~|-- out1
+         ---------------------------------------
+*/
+
+class TITest3Base: public PlgTest<ti_test_params> {
+    std::string model_t = R"V0G0N(
+<net batch="1" name="frozen" version="5">
+	<layers>
+		<layer id="0" name="in1" precision="_PRC_" type="Input">
+			<output>
+				<port id="0">
+                    <dim>_IN_</dim>
+                    <dim>_INPUT_SIZE_</dim>
+				</port>
+			</output>
+		</layer>
+		<layer id="1" name="in2" precision="_PRC_" type="Input">
+			<output>
+				<port id="0">
+                    <dim>_IN_</dim>
+                    <dim>_CHUNK_SIZE_</dim>
+				</port>
+			</output>
+		</layer>
+        <layer id="2" name="main_ti" type="TensorIterator" precision="_PRC_">
+            <input>
+                <port id="0">
+                    <dim>_IN_</dim>
+                    <dim>_INPUT_SIZE_</dim>
+                </port>
+                <port id="1">
+                    <dim>_IN_</dim>
+                    <dim>_CHUNK_SIZE_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>_IN_</dim>
+                    <dim>_INPUT_SIZE_</dim>
+                </port>
+                <port id="3">
+                    <dim>_IN_</dim>
+                    <dim>_CHUNK_SIZE_</dim>
+                </port>
+            </output>
+            <port_map>
+				<input external_port_id="0" internal_layer_id="0" internal_port_id="0" axis="1" stride="_CHUNK_SIZE_"/>
+				<input external_port_id="1" internal_layer_id="0" internal_port_id="1"/>
+				<output external_port_id="2" internal_layer_id="0" internal_port_id="2" axis="1" stride="_CHUNK_SIZE_"/>
+				<output external_port_id="3" internal_layer_id="1" internal_port_id="1"/>
+			</port_map>
+			<back_edges>
+				<edge from-layer="1" from-port="1" to-layer="0" to-port="1"/>
+			</back_edges>
+            <body>
+                <layers>
+                    <layer id="0" name="add" precision="_PRC_" type="Eltwise">
+                        <data operation="sum"/>
+                        <input>
+                            <port id="0">
+                                <dim>_IN_</dim>
+                                <dim>_CHUNK_SIZE_</dim>
+                            </port>
+                            <port id="1">
+                                <dim>_IN_</dim>
+                                <dim>_CHUNK_SIZE_</dim>
+                            </port>
+                        </input>
+                        <output>
+                            <port id="2">
+                                <dim>_IN_</dim>
+                                <dim>_CHUNK_SIZE_</dim>
+                            </port>
+                        </output>
+                    </layer>
+                    <layer id="1" name="plus_one" precision="_PRC_" type="Power">
+                        <data scale="1" shift="1" power="1"/>
+                        <input>
+                            <port id="0">
+                                <dim>_IN_</dim>
+                                <dim>_CHUNK_SIZE_</dim>
+                            </port>
+                        </input>
+                        <output>
+                            <port id="1">
+                                <dim>_IN_</dim>
+                                <dim>_CHUNK_SIZE_</dim>
+                            </port>
+                        </output>
+                    </layer>
+                </layers>
+                <edges>
+                    <edge from-layer="0" from-port="2" to-layer="1" to-port="0"/>
+                </edges>
+            </body>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="2" to-port="1"/>
+    </edges>
+</net>
+)V0G0N";
+
+    const std::size_t iteration_count = 5;
+
+    std::string getModel(const ti_test_params & p) {
+        std::string model = model_t;
+
+        REPLACE_WITH_NUM(model, "_IN_", 1);
+        REPLACE_WITH_NUM(model, "_INPUT_SIZE_", iteration_count * p.tensorSize);
+        REPLACE_WITH_NUM(model, "_CHUNK_SIZE_", p.tensorSize);
+        REPLACE_WITH_STR(model, "_PRC_", p.precision.name());
+
+        return model;
+    }
+
+protected:
+    void RunTITest(const std::map<std::string, std::string> & config = {}) {
+        try {
+            ti_test_params p = param();
+            std::string model = getModel(p);
+
+            Core ie;
+            auto net = ie.ReadNetwork(model, Blob::CPtr());
+            auto exec = ie.LoadNetwork(net, device_name, config);
+            auto req = exec.CreateInferRequest();
+
+            // state: s_0 = in2, out_iter_i = in1_i + s_i, s_(i+1) = out_iter_i + 1
+            // the second inference has to start from in2 again
+            for (int infer = 0; infer < 2; infer++) {
+                setValuesInBlob(req.GetBlob("in1"), 1.0f);
+                setValuesInBlob(req.GetBlob("in2"), 1.0f);
+                req.Infer();
+
+                auto out_iter = req.GetBlob("main_ti.2")->buffer().as<float *>();
+                auto out_state = req.GetBlob("main_ti.3")->buffer().as<float *>();
+
+                float state = 1.0f;
+                for (std::size_t i = 0; i < iteration_count; i++) {
+                    for (std::size_t j = 0; j < p.tensorSize; j++)
+                        ASSERT_FLOAT_EQ(1.0f + state, out_iter[i * p.tensorSize + j]) << "iteration " << i;
+                    state = 1.0f + state + 1.0f;
+                }
+                for (std::size_t j = 0; j < p.tensorSize; j++)
+                    ASSERT_FLOAT_EQ(state, out_state[j]);
+            }
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+using TITest3  = TITest3Base;
+
+TEST_P(TITest3, TestsWithStateValues) { RunTITest(); }
+
+/*
+  TI body with FullyConnected depending on the iterated input only (input projection of a recurrent cell)
+
+         ______________main_ti__________________________
+  in1 --|~~ iter  -> fc -> add -> plus_one -> next1     |
+  in2 --|~~ prev1 -------> add -> out_iter ~~~~~~~~~~~~~|-- out1
+         -----------------------------------------------
+*/
+
+class TITest4Base: public PlgTest<ti_test_params> {
+    std::string model_t = R"V0G0N(
+<net batch="1" name="frozen" version="5">
+	<layers>
+		<layer id="0" name="in1" precision="_PRC_" type="Input">
+			<output>
+				<port id="0">
+                    <dim>_IN_</dim>
+                    <dim>_INPUT_SIZE_</dim>
+				</port>
+			</output>
+		</layer>
+		<layer id="1" name="in2" precision="_PRC_" type="Input">
+			<output>
+				<port id="0">
+                    <dim>_IN_</dim>
+                    <dim>_CHUNK_SIZE_</dim>
+				</port>
+			</output>
+		</layer>
+        <layer id="2" name="main_ti" type="TensorIterator" precision="_PRC_">
+            <input>
+                <port id="0">
+                    <dim>_IN_</dim>
+                    <dim>_INPUT_SIZE_</dim>
+                </port>
+                <port id="1">
+                    <dim>_IN_</dim>
+                    <dim>_CHUNK_SIZE_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>_IN_</dim>
+                    <dim>_INPUT_SIZE_</dim>
+                </port>
+            </output>
+            <port_map>
+				<input external_port_id="0" internal_layer_id="0" internal_port_id="0" axis="1" stride="_CHUNK_SIZE_"/>
+				<input external_port_id="1" internal_layer_id="1" internal_port_id="1"/>
+				<output external_port_id="2" internal_layer_id="1" internal_port_id="2" axis="1" stride="_CHUNK_SIZE_"/>
+			</port_map>
+			<back_edges>
+				<edge from-layer="2" from-port="1" to-layer="1" to-port="1"/>
+			</back_edges>
+            <body>
+                <layers>
+                    <layer id="0" name="fc" precision="_PRC_" type="FullyConnected">
+                        <data out-size="_CHUNK_SIZE_"/>
+                        <input>
+                            <port id="0">
+                                <dim>_IN_</dim>
+                                <dim>_CHUNK_SIZE_</dim>
+                            </port>
+                        </input>
+                        <output>
+                            <port id="1">
+                                <dim>_IN_</dim>
+                                <dim>_CHUNK_SIZE_</dim>
+                            </port>
+                        </output>
+                        <blobs>
+                            <weights offset="0" size="_WSZ_"/>
+                            <biases offset="_WSZ_" size="_BSZ_"/>
+                        </blobs>
+                    </layer>
+                    <layer id="1" name="add" precision="_PRC_" type="Eltwise">
+                        <data operation="sum"/>
+                        <input>
+                            <port id="0">
+                                <dim>_IN_</dim>
+                                <dim>_CHUNK_SIZE_</dim>
+                            </port>
+                            <port id="1">
+                                <dim>_IN_</dim>
+                                <dim>_CHUNK_SIZE_</dim>
+                            </port>
+                        </input>
+                        <output>
+                            <port id="2">
+                                <dim>_IN_</dim>
+                                <dim>_CHUNK_SIZE_</dim>
+                            </port>
+                        </output>
+                    </layer>
+                    <layer id="2" name="plus_one" precision="_PRC_" type="Power">
+                        <data scale="1" shift="1" power="1"/>
+                        <input>
+                            <port id="0">
+                                <dim>_IN_</dim>
+                                <dim>_CHUNK_SIZE_</dim>
+                            </port>
+                        </input>
+                        <output>
+                            <port id="1">
+                                <dim>_IN_</dim>
+                                <dim>_CHUNK_SIZE_</dim>
+                            </port>
+                        </output>
+                    </layer>
+                </layers>
+                <edges>
+                    <edge from-layer="0" from-port="1" to-layer="1" to-port="0"/>
+                    <edge from-layer="1" from-port="2" to-layer="2" to-port="0"/>
+                </edges>
+            </body>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="2" to-port="1"/>
+    </edges>
+</net>
+)V0G0N";
+
+    const std::size_t iteration_count = 4;
+    const std::size_t batch = 2;
+
+    std::string getModel(const ti_test_params & p) {
+        std::string model = model_t;
+
+        REPLACE_WITH_NUM(model, "_IN_", batch);
+        REPLACE_WITH_NUM(model, "_INPUT_SIZE_", iteration_count * p.tensorSize);
+        REPLACE_WITH_NUM(model, "_CHUNK_SIZE_", p.tensorSize);
+        REPLACE_WITH_STR(model, "_PRC_", p.precision.name());
+        REPLACE_WITH_NUM(model, "_WSZ_", sizeof(float) * p.tensorSize * p.tensorSize);
+        REPLACE_WITH_NUM(model, "_BSZ_", sizeof(float) * p.tensorSize);
+
+        return model;
+    }
+
+protected:
+    void RunTITest(const std::map<std::string, std::string> & config = {}) {
+        try {
+            ti_test_params p = param();
+            std::string model = getModel(p);
+            const std::size_t chunk = p.tensorSize;
+
+            // all weights are 1, biases are 0.5
+            auto weights = make_shared_blob<uint8_t>(TensorDesc {Precision::U8, {sizeof(float) * (chunk * chunk + chunk)}, C});
+            weights->allocate();
+            auto weights_ptr = weights->buffer().as<float *>();
+            std::fill(weights_ptr, weights_ptr + chunk * chunk, 1.0f);
+            std::fill(weights_ptr + chunk * chunk, weights_ptr + chunk * chunk + chunk, 0.5f);
+
+            Core ie;
+            auto net = ie.ReadNetwork(model, weights);
+            auto exec = ie.LoadNetwork(net, device_name, config);
+            auto req = exec.CreateInferRequest();
+
+            // in1[b, t, c] = (b + 1) * (t + 1)
+            auto in1 = req.GetBlob("in1")->buffer().as<float *>();
+            for (std::size_t b = 0; b < batch; b++)
+                for (std::size_t t = 0; t < iteration_count; t++)
+                    for (std::size_t c = 0; c < chunk; c++)
+                        in1[(b * iteration_count + t) * chunk + c] = static_cast<float>((b + 1) * (t + 1));
+            setValuesInBlob(req.GetBlob("in2"), 1.0f);
+            req.Infer();
+
+            auto out = req.GetBlob("main_ti")->buffer().as<float *>();
+            for (std::size_t b = 0; b < batch; b++) {
+                float state = 1.0f;
+                for (std::size_t t = 0; t < iteration_count; t++) {
+                    float ref = static_cast<float>(chunk * (b + 1) * (t + 1)) + 0.5f + state;
+                    for (std::size_t c = 0; c < chunk; c++)
+                        ASSERT_NEAR(ref, out[(b * iteration_count + t) * chunk + c], 1e-3f * ref)
+                            << "batch " << b << " iteration " << t;
+                    state = ref + 1.0f;
+                }
+            }
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+using TITest4  = TITest4Base;
+
+TEST_P(TITest4, TestsWithInputProjection) { RunTITest(); }
@@ -27,11 +27,14 @@ struct gather_test_params {
     int selectedType;
 
     std::vector<std::function<void(MKLDNNPlugin::PrimitiveDescInfo)>> comp;
+
+    int batch_dims;
 };
 
 template <typename data_t>
-void ref_gather(InferenceEngine::TBlob<data_t> &srcIdx, InferenceEngine::TBlob<float> &srcDct, InferenceEngine::TBlob<float> &dst, size_t axis) {
-    size_t i, j;
+void ref_gather(InferenceEngine::TBlob<data_t> &srcIdx, InferenceEngine::TBlob<float> &srcDct, InferenceEngine::TBlob<float> &dst,
+                size_t axis, size_t batch_dims = 0) {
+    size_t i, j, b;
     const data_t *src_dataIdx = srcIdx.data();
     float* src_dataDict = srcDct.data();
     float *dst_data = dst.data();
@@ -39,29 +42,33 @@ void ref_gather(InferenceEngine::TBlob<data_t> &srcIdx, InferenceEngine::TBlob<f
 
     std::vector<size_t> dictionary_dims = srcDct.getTensorDesc().getDims();
 
-    //  Find number of dictionaries, index range and data length
+    //  Find number of batches, dictionaries, index range and data length
+    size_t batchSize = 1;
+    for (i = 0; i < batch_dims; i++)
+        batchSize *= dictionary_dims[i];
     size_t numDictionaries = 1;
-    for (i = 0; i < axis; i++)
+    for (i = batch_dims; i < axis; i++)
         numDictionaries *= dictionary_dims[i];
     size_t indexRange = dictionary_dims[axis];
     size_t dataLength = 1;
     for (i = axis + 1; i < dictionary_dims.size(); i++)
         dataLength *= dictionary_dims[i];
+    size_t indexesPerBatch = src_size / batchSize;
 
     //  The gathering process
-    for (i = 0; i < src_size; i++) {
-        unsigned int idx = static_cast<unsigned int>(src_dataIdx[i]);
-
-        //  Index clipping
-        if (idx < indexRange) {
-            //  Copying data to destination from Dictionary
-            for (j = 0; j < numDictionaries; j++) {
-                memcpy(&dst_data[dataLength * (i + j * src_size)],
-                       &src_dataDict[dataLength * (idx + j * indexRange)], sizeof(float) * dataLength);
-            }
-        } else {
-            for (j = 0; j < numDictionaries; j++) {
-                std::fill_n(&dst_data[dataLength * (i + j * src_size)], dataLength, 0.0f);
+    for (b = 0; b < batchSize; b++) {
+        for (i = 0; i < indexesPerBatch; i++) {
+            unsigned int idx = static_cast<unsigned int>(src_dataIdx[b * indexesPerBatch + i]);
+
+            for (j = b * numDictionaries; j < (b + 1) * numDictionaries; j++) {
+                float *dst_row = &dst_data[dataLength * (i + j * indexesPerBatch)];
+                //  Index clipping
+                if (idx < indexRange) {
+                    //  Copying data to destination from Dictionary
+                    memcpy(dst_row, &src_dataDict[dataLength * (idx + j * indexRange)], sizeof(float) * dataLength);
+                } else {
+                    std::fill_n(dst_row, dataLength, 0.0f);
+                }
             }
         }
     }
@@ -86,7 +93,7 @@ class MKLDNNCPUExtGatherTests: public TestsCommon, public WithParamInterface<gat
             </output>
         </layer>
         <layer name="gather" id="3" type="Gather" precision="FP32">
-            <data axis="_AX_"/>
+            <data axis="_AX_" batch_dims="_BD_"/>
             <input>
                 <port id="1">
                     _IDICT_
@@ -134,6 +141,7 @@ class MKLDNNCPUExtGatherTests: public TestsCommon, public WithParamInterface<gat
         REPLACE_WITH_STR(model, "_IIDX_", inIdx);
         REPLACE_WITH_STR(model, "_IDICT_", inDict);
         REPLACE_WITH_NUM(model, "_AX_", p.axis);
+        REPLACE_WITH_NUM(model, "_BD_", p.batch_dims);
         REPLACE_WITH_STR(model, "_OUT_", out);
 
         return model;
@@ -154,6 +162,7 @@ protected:
             TestsCommon::SetUp();
             gather_test_params p = ::testing::WithParamInterface<gather_test_params>::GetParam();
             std::string model = getModel(p);
+            size_t batch_dims = p.batch_dims < 0 ? p.batch_dims + p.inIdx.size() : p.batch_dims;
 
                         InferenceEngine::Core core;
             InferenceEngine::CNNNetwork network;
@@ -212,7 +221,18 @@ protected:
                     FAIL() << "Cannot cast blob to TBlob<int32_t>.";
 
                 // Check results
-                ref_gather(*srcIdxPtr, *srcDictPtr, dst_ref, p.axis);
+                ref_gather(*srcIdxPtr, *srcDictPtr, dst_ref, p.axis, batch_dims);
+            }
+            else if (p.inIdxPrecision == "I64") {
+                srcIdx = InferenceEngine::make_shared_blob<int64_t>({ InferenceEngine::Precision::I64, p.inIdx, InferenceEngine::TensorDesc::getLayoutByDims(p.inIdx) });
+                srcIdx->allocate();
+                fill_data_dbgval(static_cast<int64_t*>(srcIdx->buffer()), srcIdx->size());
+                auto * srcIdxPtr = dynamic_cast<InferenceEngine::TBlob<int64_t>*>(srcIdx.get());
+                if (srcIdxPtr == nullptr)
+                    FAIL() << "Cannot cast blob to TBlob<int64_t>.";
+
+                // Check results
+                ref_gather(*srcIdxPtr, *srcDictPtr, dst_ref, p.axis, batch_dims);
             }
             else if (p.inIdxPrecision == "FP32") {
                 srcIdx = InferenceEngine::make_shared_blob<float>({ InferenceEngine::Precision::FP32, p.inIdx, InferenceEngine::TensorDesc::getLayoutByDims(p.inIdx) });
@@ -223,7 +243,7 @@ protected:
                     FAIL() << "Cannot cast blob to TBlob<float>.";
 
                 // Check results
-                ref_gather(*srcIdxPtr, *srcDictPtr, dst_ref, p.axis);
+                ref_gather(*srcIdxPtr, *srcDictPtr, dst_ref, p.axis, batch_dims);
             }
             else if (p.inIdxPrecision == "U16") {
                 srcIdx = InferenceEngine::make_shared_blob<uint16_t>({ InferenceEngine::Precision::U16, p.inIdx, InferenceEngine::TensorDesc::getLayoutByDims(p.inIdx) });
@@ -234,7 +254,7 @@ protected:
                     FAIL() << "Cannot cast blob to TBlob<uint16_t>.";
 
                 // Check results
-                ref_gather(*srcIdxPtr, *srcDictPtr, dst_ref, p.axis);
+                ref_gather(*srcIdxPtr, *srcDictPtr, dst_ref, p.axis, batch_dims);
             }
             else if (p.inIdxPrecision == "I16") {
                 srcIdx = InferenceEngine::make_shared_blob<int16_t>({ InferenceEngine::Precision::I16, p.inIdx, InferenceEngine::TensorDesc::getLayoutByDims(p.inIdx) });
@@ -245,7 +265,7 @@ protected:
                     FAIL() << "Cannot cast blob to TBlob<int16_t>.";
 
                 // Check results
-                ref_gather(*srcIdxPtr, *srcDictPtr, dst_ref, p.axis);
+                ref_gather(*srcIdxPtr, *srcDictPtr, dst_ref, p.axis, batch_dims);
             }
             else if (p.inIdxPrecision == "U8") {
                 srcIdx = InferenceEngine::make_shared_blob<uint8_t>({ InferenceEngine::Precision::U8, p.inIdx, InferenceEngine::TensorDesc::getLayoutByDims(p.inIdx) });
@@ -256,7 +276,7 @@ protected:
                     FAIL() << "Cannot cast blob to TBlob<uint8_t>.";
 
                 // Check results
-                ref_gather(*srcIdxPtr, *srcDictPtr, dst_ref, p.axis);
+                ref_gather(*srcIdxPtr, *srcDictPtr, dst_ref, p.axis, batch_dims);
             }
             else if (p.inIdxPrecision == "I8") {
                 srcIdx = InferenceEngine::make_shared_blob<int8_t>({ InferenceEngine::Precision::I8, p.inIdx, InferenceEngine::TensorDesc::getLayoutByDims(p.inIdx) });
@@ -267,7 +287,7 @@ protected:
                     FAIL() << "Cannot cast blob to TBlob<int8_t>.";
 
                 // Check results
-                ref_gather(*srcIdxPtr, *srcDictPtr, dst_ref, p.axis);
+                ref_gather(*srcIdxPtr, *srcDictPtr, dst_ref, p.axis, batch_dims);
             }
             else {
                 return;
@@ -304,7 +324,24 @@ INSTANTIATE_TEST_CASE_P(
                 gather_test_params{ "FP32", {71, 16}, {1, 12, 256}, 1, {1, 71, 12, 256}, 1, MKLDNNPlugin::impl_desc_type::unknown },
                 gather_test_params{  "I32", {2, 5, 6}, {1, 1, 3, 4}, 1, {2, 3, 4, 6}, 1, MKLDNNPlugin::impl_desc_type::unknown },
                 gather_test_params{  "I32", {2, 5, 6}, {1, 1, 3, 4}, 2, {2, 5, 3, 4}, 1, MKLDNNPlugin::impl_desc_type::unknown },
-                gather_test_params{  "I32", {6, 13, 10, 3}, {12, 4, 9, 8}, 1, {6, 12, 4, 9, 8, 10, 3}, 1, MKLDNNPlugin::impl_desc_type::unknown }
+                gather_test_params{  "I32", {6, 13, 10, 3}, {12, 4, 9, 8}, 1, {6, 12, 4, 9, 8, 10, 3}, 1, MKLDNNPlugin::impl_desc_type::unknown },
+                // rows of 4/8/16/32/64 elements use fixed size copies
+                gather_test_params{  "I32", {1000, 4}, {3, 333}, 0, {3, 333, 4}, 1, MKLDNNPlugin::impl_desc_type::unknown },
+                gather_test_params{  "I32", {1000, 8}, {3, 333}, 0, {3, 333, 8}, 1, MKLDNNPlugin::impl_desc_type::unknown },
+                gather_test_params{ "FP32", {2, 500, 32}, {5, 41}, 1, {2, 5, 41, 32}, 1, MKLDNNPlugin::impl_desc_type::unknown },
+                gather_test_params{  "I32", {500, 64}, {1, 999}, 0, {1, 999, 64}, 1, MKLDNNPlugin::impl_desc_type::unknown },
+                // rows of sizes without a fixed size copy
+                gather_test_params{ "FP32", {2, 50, 3}, {7, 5}, 1, {2, 7, 5, 3}, 1, MKLDNNPlugin::impl_desc_type::unknown },
+                gather_test_params{  "I32", {100, 129}, {40}, 0, {40, 129}, 1, MKLDNNPlugin::impl_desc_type::unknown },
+                // I64 indices
+                gather_test_params{  "I64", {71, 16}, {12, 256}, 0, {12, 256, 16}, 1, MKLDNNPlugin::impl_desc_type::unknown },
+                gather_test_params{  "I64", {2, 5, 6}, {1, 1, 3, 4}, 2, {2, 5, 3, 4}, 1, MKLDNNPlugin::impl_desc_type::unknown },
+                // batch_dims
+                gather_test_params{  "I32", {2, 50, 6}, {2, 30}, 1, {2, 30, 6}, 1, MKLDNNPlugin::impl_desc_type::unknown, {}, 1 },
+                gather_test_params{ "FP32", {3, 4, 40, 8}, {3, 4, 11}, 2, {3, 4, 11, 8}, 1, MKLDNNPlugin::impl_desc_type::unknown, {}, 2 },
+                gather_test_params{  "I32", {3, 4, 40, 5}, {3, 2, 7}, 2, {3, 4, 2, 7, 5}, 1, MKLDNNPlugin::impl_desc_type::unknown, {}, 1 },
+                gather_test_params{  "I64", {2, 3, 70, 16}, {2, 3, 9, 4}, 2, {2, 3, 9, 4, 16}, 1, MKLDNNPlugin::impl_desc_type::unknown, {}, 2 },
+                gather_test_params{  "I64", {4, 64, 4}, {4, 100}, 1, {4, 100, 4}, 1, MKLDNNPlugin::impl_desc_type::unknown, {}, -1 }
             ));
 
 
@@ -344,7 +381,7 @@ class MKLDNNCPUExtGatherTFTests : public TestsCommon, public WithParamInterface<
             </output>
         </layer>
         <layer name="gather" id="3" type="Gather" precision="FP32">
-            <data axis="_AX_"/>
+            <data axis="_AX_" batch_dims="_BD_"/>
             <input>
                 <port id="1">
                     _IDICT_
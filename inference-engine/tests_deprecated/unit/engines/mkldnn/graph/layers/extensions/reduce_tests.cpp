@@ -531,5 +531,13 @@ INSTANTIATE_TEST_CASE_P(
                 reduce_test_params{ "ReduceSumSquare", true,{ 10, 10, 2 },"FP32",{},{ 2 },{ 10, 10, 1 },{} },
                 reduce_test_params{ "ReduceSumSquare", true, { 3, 2, 2 },"FP32",{},{ 1 },{ 3, 1, 2 },{ 10, 20, 74, 100, 202, 244 } },
                 reduce_test_params{ "ReduceSumSquare", false, { 3, 2, 2 },"FP32",{},{ 1 },{ 3, 2 },{ 10, 20, 74, 100, 202, 244 } },
-                reduce_test_params{ "ReduceSumSquare", false, { 3, 2, 2 },"FP32",{},{ 0, 1, 2 },{ },{ 650 } }
+                reduce_test_params{ "ReduceSumSquare", false, { 3, 2, 2 },"FP32",{},{ 0, 1, 2 },{ },{ 650 } },
+                // shapes with vector tails, non adjacent axes and a single long reduced row
+                reduce_test_params{ "ReduceSum", true,{ 2, 19, 7, 13 },"FP32",{},{ 1, 3 },{ 2, 1, 7, 1 },{} },
+                reduce_test_params{ "ReduceMean", false,{ 3, 5, 17, 9 },"FP32",{},{ 0, 2 },{ 5, 9 },{} },
+                reduce_test_params{ "ReduceMax", true,{ 1, 1, 100, 33 },"FP32",{},{ 2 },{ 1, 1, 1, 33 },{} },
+                reduce_test_params{ "ReduceMin", false,{ 2, 3, 1, 67 },"FP32",{},{ 3 },{ 2, 3, 1 },{} },
+                reduce_test_params{ "ReduceL1", true,{ 2, 3, 4, 5, 18 },"FP32",{},{ 2, 4 },{ 2, 3, 1, 5, 1 },{} },
+                reduce_test_params{ "ReduceL2", true,{ 2, 3, 4, 5, 18 },"FP32",{},{ -1 },{ 2, 3, 4, 5, 1 },{} },
+                reduce_test_params{ "ReduceSumSquare", false,{ 1, 17, 3, 3, 3 },"FP32",{},{ 2, 3, 4 },{ 1, 17 },{} }
 ));
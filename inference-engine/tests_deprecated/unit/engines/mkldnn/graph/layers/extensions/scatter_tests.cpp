@@ -201,3 +201,269 @@ INSTANTIATE_TEST_CASE_P(
         scatterTF_test_params{"FP32", { 3,3 },{ 0,0,0,0,0,0,0,0,0 },{ 2,3 },{ 1,0,2,0,2,1 },{ 1.,1.1,1.2,2,2.1,2.2 }, 0,{ 2,1.1,0,1,0,2.2,0,2.1,1.2 }},
         scatterTF_test_params{"FP32", { 3,3 },{ 0,0,0,0,0,0,0,0,0 },{ 2,3 },{ 1,0,2,0,2,1 },{ 1.,1.1,1.2,2,2.1,2.2 }, 1,{ 1.1,1,1.2,2,2.2,2.1,0,0,0 }},
         scatterTF_test_params{"FP32", { 1,5 },{ 1,2,3,4,5 },{ 1,2 },{ 1,3 },{ 1.1,2.1 }, 1,{ 1,1.1,3,2.1,5 }}));
+
+
+struct scatter_update_test_params {
+    std::string layerType;
+    std::string inIdxPrecision;
+    InferenceEngine::SizeVector inDataDim;
+    InferenceEngine::SizeVector inIdxDim;
+    int axis;
+};
+
+class MKLDNNCPUExtScatterUpdateTests : public TestsCommon, public WithParamInterface<scatter_update_test_params> {
+    std::string model_t = R"V0G0N(
+<net Name="Scatter_net" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="InputData" type="Input" precision="FP32" id="1">
+            <output>
+                <port id="1">
+                    _IDATA_
+                </port>
+            </output>
+        </layer>
+        <layer name="InputIndexes" type="Input" precision="_IIDXP_" id="2">
+            <output>
+                <port id="2">
+                    _IIDX_
+                </port>
+            </output>
+        </layer>
+        <layer name="InputUpdates" type="Input" precision="FP32" id="3">
+            <output>
+                <port id="3">
+                    _IUPD_
+                </port>
+            </output>
+        </layer>
+        <layer name="InputAxis" type="Input" precision="I32" id="4">
+            <output>
+                <port id="4">
+                    <dim>1</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="scatter" type="_LT_" precision="FP32" id="5">
+            <input>
+                <port id="1">
+                    _IDATA_
+                </port>
+                <port id="2" precision="_IIDXP_">
+                    _IIDX_
+                </port>
+                <port id="3">
+                    _IUPD_
+                </port>
+                <port id="4" precision="I32">
+                    <dim>1</dim>
+                </port>
+            </input>
+            <output>
+                <port id="5">
+                    _IDATA_
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="1" from-port="1" to-layer="5" to-port="1"/>
+        <edge from-layer="2" from-port="2" to-layer="5" to-port="2"/>
+        <edge from-layer="3" from-port="3" to-layer="5" to-port="3"/>
+        <edge from-layer="4" from-port="4" to-layer="5" to-port="4"/>
+    </edges>
+</net>
+)V0G0N";
+
+    static std::string getDims(const InferenceEngine::SizeVector &dims) {
+        std::string result;
+        for (auto& dim : dims) {
+            result += "<dim>";
+            result += std::to_string(dim) + "</dim>\n";
+        }
+        return result;
+    }
+
+    std::string getModel(const scatter_update_test_params &p, const InferenceEngine::SizeVector &updDim) {
+        std::string model = model_t;
+        REPLACE_WITH_STR(model, "_LT_", p.layerType);
+        REPLACE_WITH_STR(model, "_IIDXP_", p.inIdxPrecision);
+        REPLACE_WITH_STR(model, "_IDATA_", getDims(p.inDataDim));
+        REPLACE_WITH_STR(model, "_IIDX_", getDims(p.inIdxDim));
+        REPLACE_WITH_STR(model, "_IUPD_", getDims(updDim));
+        return model;
+    }
+
+    template <typename data_t>
+    static InferenceEngine::Blob::Ptr makeIndexes(InferenceEngine::Precision precision, const InferenceEngine::SizeVector &dims,
+                                                  const std::vector<int64_t> &values) {
+        auto blob = InferenceEngine::make_shared_blob<data_t>({ precision, dims, InferenceEngine::TensorDesc::getLayoutByDims(dims) });
+        blob->allocate();
+        data_t *data = blob->buffer().template as<data_t*>();
+        for (size_t i = 0; i < values.size(); i++)
+            data[i] = static_cast<data_t>(values[i]);
+        return blob;
+    }
+
+    //  ScatterUpdate: indexes are unique and the ones past the index range are skipped
+    static void ref_scatter_update(const float *upd, const std::vector<int64_t> &idx, float *dst,
+                                   const InferenceEngine::SizeVector &dataDim, size_t axis) {
+        size_t outer = 1, inner = 1;
+        for (size_t i = 0; i < axis; i++)
+            outer *= dataDim[i];
+        for (size_t i = axis + 1; i < dataDim.size(); i++)
+            inner *= dataDim[i];
+        const size_t range = dataDim[axis];
+        for (size_t o = 0; o < outer; o++) {
+            for (size_t k = 0; k < idx.size(); k++) {
+                if (idx[k] < 0 || static_cast<size_t>(idx[k]) >= range)
+                    continue;
+                memcpy(&dst[(o * range + idx[k]) * inner], &upd[(o * idx.size() + k) * inner], sizeof(float) * inner);
+            }
+        }
+    }
+
+    //  ScatterElementsUpdate: every update goes to its own position with the axis coordinate replaced by the index
+    static void ref_scatter_elements(const float *upd, const std::vector<int64_t> &idx, float *dst,
+                                     const InferenceEngine::SizeVector &dataDim, const InferenceEngine::SizeVector &idxDim,
+                                     size_t axis) {
+        InferenceEngine::SizeVector counters(idxDim.size(), 0);
+        for (size_t i = 0; i < idx.size(); i++) {
+            if (idx[i] >= 0 && static_cast<size_t>(idx[i]) < dataDim[axis]) {
+                size_t offset = 0;
+                for (size_t d = 0; d < dataDim.size(); d++)
+                    offset = offset * dataDim[d] + (d == axis ? idx[i] : counters[d]);
+                dst[offset] = upd[i];
+            }
+            for (int d = static_cast<int>(idxDim.size()) - 1; d >= 0; d--) {
+                if (++counters[d] < idxDim[d])
+                    break;
+                counters[d] = 0;
+            }
+        }
+    }
+
+protected:
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            scatter_update_test_params p = ::testing::WithParamInterface<scatter_update_test_params>::GetParam();
+            const bool elementsUpdate = p.layerType == "ScatterElementsUpdate";
+            const size_t axis = p.axis < 0 ? p.axis + p.inDataDim.size() : p.axis;
+
+            InferenceEngine::SizeVector updDim = p.inIdxDim;
+            if (!elementsUpdate) {
+                updDim.assign(p.inDataDim.begin(), p.inDataDim.begin() + axis);
+                updDim.insert(updDim.end(), p.inIdxDim.begin(), p.inIdxDim.end());
+                updDim.insert(updDim.end(), p.inDataDim.begin() + axis + 1, p.inDataDim.end());
+            }
+
+            std::string model = getModel(p, updDim);
+            InferenceEngine::Core core;
+            InferenceEngine::CNNNetwork network;
+            ASSERT_NO_THROW(network = core.ReadNetwork(model, InferenceEngine::Blob::CPtr()));
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(network);
+
+            //  Indexes are written in reverse order to make the updated positions differ from the update positions,
+            //  the index past the range checks that it is skipped
+            size_t idxSize = 1;
+            for (auto dim : p.inIdxDim)
+                idxSize *= dim;
+            std::vector<int64_t> idx(idxSize);
+            if (elementsUpdate) {
+                InferenceEngine::SizeVector counters(p.inIdxDim.size(), 0);
+                for (size_t i = 0; i < idxSize; i++) {
+                    idx[i] = p.inDataDim[axis] - 1 - counters[axis];
+                    for (int d = static_cast<int>(p.inIdxDim.size()) - 1; d >= 0; d--) {
+                        if (++counters[d] < p.inIdxDim[d])
+                            break;
+                        counters[d] = 0;
+                    }
+                }
+            } else {
+                for (size_t i = 0; i < idxSize; i++)
+                    idx[i] = static_cast<int64_t>(p.inDataDim[axis]) - 1 - static_cast<int64_t>(i);
+            }
+            idx.back() = p.inDataDim[axis];
+
+            InferenceEngine::Blob::Ptr srcIdx;
+            if (p.inIdxPrecision == "I32")
+                srcIdx = makeIndexes<int32_t>(InferenceEngine::Precision::I32, p.inIdxDim, idx);
+            else if (p.inIdxPrecision == "I64")
+                srcIdx = makeIndexes<int64_t>(InferenceEngine::Precision::I64, p.inIdxDim, idx);
+            else
+                srcIdx = makeIndexes<float>(InferenceEngine::Precision::FP32, p.inIdxDim, idx);
+
+            InferenceEngine::Blob::Ptr srcData = InferenceEngine::make_shared_blob<float>({ InferenceEngine::Precision::FP32, p.inDataDim, InferenceEngine::TensorDesc::getLayoutByDims(p.inDataDim) });
+            srcData->allocate();
+            fill_data(srcData->buffer(), srcData->size());
+
+            InferenceEngine::Blob::Ptr srcUpd = InferenceEngine::make_shared_blob<float>({ InferenceEngine::Precision::FP32, updDim, InferenceEngine::TensorDesc::getLayoutByDims(updDim) });
+            srcUpd->allocate();
+            for (size_t i = 0; i < srcUpd->size(); i++)
+                srcUpd->buffer().as<float*>()[i] = 100.f + i;
+
+            InferenceEngine::Blob::Ptr srcAxis = InferenceEngine::make_shared_blob<int32_t>({ InferenceEngine::Precision::I32, { 1 }, InferenceEngine::Layout::C });
+            srcAxis->allocate();
+            srcAxis->buffer().as<int32_t*>()[0] = p.axis;
+
+            //  Output Data
+            InferenceEngine::OutputsDataMap out;
+            out = network.getOutputsInfo();
+            InferenceEngine::BlobMap outputBlobs;
+            std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+            InferenceEngine::TBlob<float>::Ptr output;
+            output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+
+            //  Output Reference
+            InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+            memcpy(dst_ref.data(), srcData->buffer().as<float*>(), srcData->byteSize());
+            if (elementsUpdate)
+                ref_scatter_elements(srcUpd->buffer().as<float*>(), idx, dst_ref.data(), p.inDataDim, p.inIdxDim, axis);
+            else
+                ref_scatter_update(srcUpd->buffer().as<float*>(), idx, dst_ref.data(), p.inDataDim, axis);
+
+            //  Infer
+            InferenceEngine::BlobMap srcs;
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("InputData", srcData));
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("InputIndexes", srcIdx));
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("InputUpdates", srcUpd));
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("InputAxis", srcAxis));
+            graph.Infer(srcs, outputBlobs);
+
+            compare(*output, dst_ref, 0.f);
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNCPUExtScatterUpdateTests, TestsScatterUpdate) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsScatterUpdate, MKLDNNCPUExtScatterUpdateTests,
+        ::testing::Values(
+// Params: layerType, inIdxPrecision, inDataDim, inIdxDim, axis
+                // rows of 4/8/16/32/64 elements use fixed size copies
+                scatter_update_test_params{ "ScatterUpdate", "I32", { 100, 4 }, { 3, 20 }, 0 },
+                scatter_update_test_params{ "ScatterUpdate", "I32", { 2, 100, 8 }, { 50 }, 1 },
+                scatter_update_test_params{ "ScatterUpdate", "I64", { 60, 16 }, { 2, 5 }, 0 },
+                scatter_update_test_params{ "ScatterUpdate", "I64", { 3, 40, 2, 32 }, { 7 }, -3 },
+                scatter_update_test_params{ "ScatterUpdate", "FP32", { 50, 64 }, { 10 }, 0 },
+                // rows of other sizes
+                scatter_update_test_params{ "ScatterUpdate", "I32", { 30, 3 }, { 2, 4 }, 0 },
+                scatter_update_test_params{ "ScatterUpdate", "I64", { 4, 10, 65 }, { 9 }, 1 },
+                scatter_update_test_params{ "ScatterUpdate", "I32", { 5, 6, 7 }, { 3 }, 2 },
+                scatter_update_test_params{ "ScatterElementsUpdate", "I32", { 10, 12 }, { 10, 12 }, 0 },
+                scatter_update_test_params{ "ScatterElementsUpdate", "I32", { 10, 12 }, { 7, 5 }, 1 },
+                scatter_update_test_params{ "ScatterElementsUpdate", "I64", { 3, 20, 6 }, { 2, 15, 6 }, 1 },
+                scatter_update_test_params{ "ScatterElementsUpdate", "I64", { 4, 5, 6, 7 }, { 4, 5, 6, 3 }, -1 },
+                scatter_update_test_params{ "ScatterElementsUpdate", "FP32", { 8, 9 }, { 8, 9 }, 1 }
+        ));
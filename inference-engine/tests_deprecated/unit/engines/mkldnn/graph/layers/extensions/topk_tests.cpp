@@ -337,7 +337,12 @@ INSTANTIATE_TEST_CASE_P(
                 topk_test_params{ { 1, 20, 129, 129 },{}, 1,{ 18 }, "index", "max",{ 1, 18, 129, 129 },{},{} },
                 topk_test_params{ { 1, 20, 32, 32 },{}, 1,{ 18 }, "index", "min",{ 1, 18, 32, 32 },{},{} },
                 topk_test_params{ { 1, 20, 129, 129 },{}, 1,{ 18 }, "index", "min",{ 1, 18, 129, 129 },{},{} },
-                topk_test_params{ { 1, 20, 129, 129 },{}, 1,{ 18 }, "none", "min",{ 1, 18, 129, 129 },{},{} }
+                topk_test_params{ { 1, 20, 129, 129 },{}, 1,{ 18 }, "none", "min",{ 1, 18, 129, 129 },{},{} },
+                topk_test_params{ { 1, 30000 },{}, -1,{ 10 }, "value", "max",{ 1, 10 },{},{} },
+                topk_test_params{ { 2, 50000 },{}, -1,{ 100 }, "index", "max",{ 2, 100 },{},{} },
+                topk_test_params{ { 2, 50000 },{}, -1,{ 100 }, "index", "min",{ 2, 100 },{},{} },
+                topk_test_params{ { 3, 1000 },{}, -1,{ 300 }, "value", "max",{ 3, 300 },{},{} },
+                topk_test_params{ { 1, 40, 9, 7 },{}, 1,{ 35 }, "value", "max",{ 1, 35, 9, 7 },{},{} }
             ));
 
 
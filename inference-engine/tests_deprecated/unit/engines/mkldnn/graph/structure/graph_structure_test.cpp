@@ -4,11 +4,15 @@
 
 #include "../test_graph.hpp"
 #include "mkldnn_exec_network.h"
+#include "mkldnn_plugin.h"
 
 #include "tests_common.hpp"
+#include <cmath>
 #include <ie_core.hpp>
+#include <convert_function_to_cnn_network.hpp>
 
 #include <ngraph/ngraph.hpp>
+#include <ngraph_ops/convolution_ie.hpp>
 
 using namespace ::testing;
 using namespace std;
@@ -6696,3 +6700,83 @@ TEST_F(MKLDNNGraphStructureTests, TestConcatWithFourInputs) {
 
     compare(*outputBlobs["concat"], *dstOut);
 }
+
+namespace {
+
+class MKLDNNAdoptingExecNetwork: public MKLDNNPlugin::MKLDNNExecNetwork {
+public:
+    using MKLDNNPlugin::MKLDNNExecNetwork::MKLDNNExecNetwork;
+
+    const InferenceEngine::details::CNNNetworkImplPtr& getNetwork() const {
+        return _clonedNetwork;
+    }
+};
+
+class MKLDNNAdoptingEngine: public MKLDNNPlugin::Engine {
+public:
+    const InferenceEngine::details::CNNNetworkImplPtr& getNetwork(InferenceEngine::IExecutableNetwork::Ptr execNetwork) {
+        auto * execNetworkInt =
+                dynamic_cast<InferenceEngine::ExecutableNetworkBase<InferenceEngine::ExecutableNetworkInternal> *>(execNetwork.get());
+        if (!execNetworkInt)
+            THROW_IE_EXCEPTION << "Cannot find loaded network!";
+
+        auto * network = reinterpret_cast<MKLDNNAdoptingExecNetwork *>(execNetworkInt->getImpl().get());
+        if (!network)
+            THROW_IE_EXCEPTION << "Cannot get executable network!";
+        return network->getNetwork();
+    }
+};
+
+std::shared_ptr<ngraph::Function> makeConvolutionFunction(std::shared_ptr<ngraph::op::Constant>& weights) {
+    auto input = std::make_shared<ngraph::op::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3, 8, 8});
+    input->set_friendly_name("input");
+    std::vector<float> weightsData(4 * 3 * 3 * 3);
+    for (size_t i = 0; i < weightsData.size(); i++)
+        weightsData[i] = std::sin(static_cast<float>(i));
+    weights = std::make_shared<ngraph::op::Constant>(ngraph::element::f32, ngraph::Shape{4, 3, 3, 3}, weightsData);
+    auto conv = std::make_shared<ngraph::op::ConvolutionIE>(input, weights, ngraph::Strides{1, 1}, ngraph::Strides{1, 1},
+                                                            ngraph::CoordinateDiff{1, 1}, ngraph::CoordinateDiff{1, 1});
+    conv->set_friendly_name("conv");
+    auto result = std::make_shared<ngraph::op::Result>(conv);
+    return std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{input});
+}
+
+const void* weightsBuffer(const InferenceEngine::details::CNNNetworkImplPtr& network) {
+    InferenceEngine::CNNLayerPtr conv;
+    if (network->getLayerByName("conv", conv, nullptr) != InferenceEngine::OK)
+        THROW_IE_EXCEPTION << "Cannot find convolution layer!";
+    return conv->blobs.at("weights")->cbuffer().as<const void*>();
+}
+
+}  // namespace
+
+TEST_F(MKLDNNGraphStructureTests, TestExecNetworkAdoptsConvertedNetwork) {
+    std::shared_ptr<ngraph::op::Constant> weights;
+    auto function = makeConvolutionFunction(weights);
+    InferenceEngine::CNNNetwork cnn(function);
+    auto converted = InferenceEngine::details::convertFunctionToICNNNetwork(function, cnn);
+    ASSERT_EQ(weights->get_data_ptr(), weightsBuffer(converted));
+
+    MKLDNNPlugin::Config config;
+    config.lpTransformsMode = MKLDNNPlugin::Config::LPTransformsMode::Off;
+
+    // the network owned by the caller is cloned, the network owned by the plugin is transformed in place
+    MKLDNNAdoptingExecNetwork clonedExecNetwork(*converted, config, {}, cache);
+    ASSERT_NE(converted.get(), clonedExecNetwork.getNetwork().get());
+
+    MKLDNNAdoptingExecNetwork adoptedExecNetwork(converted, config, {}, cache);
+    ASSERT_EQ(converted.get(), adoptedExecNetwork.getNetwork().get());
+    ASSERT_EQ(weights->get_data_ptr(), weightsBuffer(adoptedExecNetwork.getNetwork()));
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestLoadNetworkSharesConstantBuffers) {
+    std::shared_ptr<ngraph::op::Constant> weights;
+    InferenceEngine::CNNNetwork cnn(makeConvolutionFunction(weights));
+
+    // the function is cloned and converted by the plugin, the weights of the network it executes
+    // are still the buffer of the original constant
+    MKLDNNAdoptingEngine engine;
+    InferenceEngine::IExecutableNetwork::Ptr execNetwork;
+    ASSERT_NO_THROW(engine.LoadNetwork(execNetwork, cnn, {}));
+    ASSERT_EQ(weights->get_data_ptr(), weightsBuffer(engine.getNetwork(execNetwork)));
+}
@@ -5,12 +5,14 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock-spec-builders.h>
 #include <gmock/gmock-generated-actions.h>
+#include <gmock/gmock-more-actions.h>
 #include <ie_version.hpp>
 #include <cpp/ie_infer_request.hpp>
 #include <cpp_interfaces/exception2status.hpp>
 #include <cpp_interfaces/base/ie_infer_async_request_base.hpp>
 
 #include "unit_test_utils/mocks/mock_iinfer_request.hpp"
+#include "unit_test_utils/mocks/mock_ie_imemory_state.hpp"
 #include "unit_test_utils/mocks/mock_not_empty_icnn_network.hpp"
 #include "unit_test_utils/mocks/cpp_interfaces/impl/mock_async_infer_request_internal.hpp"
 
@@ -151,6 +153,23 @@ TEST_F(InferRequestTests, throwsIfGetPerformanceCountsReturnNotOK) {
     ASSERT_THROW(info = requestWrapper->GetPerformanceCounts(), InferenceEngineException);
 }
 
+// QueryState
+TEST_F(InferRequestTests, canForwardQueryState) {
+    auto mockIMemState_p = std::make_shared<MockIMemoryState>();
+    EXPECT_CALL(*mock_request.get(), QueryState(_, _, _))
+            .Times(2)
+            .WillOnce(DoAll(SetArgReferee<0>(mockIMemState_p), Return(OK)))
+            .WillOnce(Return(OUT_OF_BOUNDS));
+    std::vector<MemoryState> states;
+    ASSERT_NO_THROW(states = requestWrapper->QueryState());
+    ASSERT_EQ(states.size(), 1);
+}
+
+TEST_F(InferRequestTests, throwsIfQueryStateReturnNotOK) {
+    EXPECT_CALL(*mock_request.get(), QueryState(_, _, _)).WillOnce(Return(GENERAL_ERROR));
+    ASSERT_THROW(requestWrapper->QueryState(), InferenceEngineException);
+}
+
 MATCHER_P(blob_in_map_pointer_is_same, ref_blob, "") {
     auto a = arg.begin()->second.get();
     return (float *) (arg.begin()->second->buffer()) == (float *) (ref_blob->buffer());
@@ -344,6 +363,11 @@ TEST_F(InferRequestCPPTests, throwsOnUninitializedSetBatch) {
     ASSERT_THROW(req.SetBatch({}), InferenceEngine::details::InferenceEngineException);
 }
 
+TEST_F(InferRequestCPPTests, throwsOnUninitializedQueryState) {
+    InferRequest req;
+    ASSERT_THROW(req.QueryState(), InferenceEngine::details::InferenceEngineException);
+}
+
 TEST_F(InferRequestCPPTests, throwsOnUninitializedStartAsync) {
     InferRequest req;
     ASSERT_THROW(req.StartAsync(), InferenceEngine::details::InferenceEngineException);
@@ -37,6 +37,7 @@ void descriptor::Output::add_input(Input* input)
     if (find(m_inputs.begin(), m_inputs.end(), input) == m_inputs.end())
     {
         m_inputs.push_back(input);
+        Node::invalidate_topology();
     }
 }
 
@@ -46,6 +47,7 @@ void descriptor::Output::remove_input(Input* input)
     if (it != m_inputs.end())
     {
         m_inputs.erase(it);
+        Node::invalidate_topology();
     }
 }
 
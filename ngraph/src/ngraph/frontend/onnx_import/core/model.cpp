@@ -17,7 +17,9 @@
 #include <onnx/onnx_pb.h>
 
 #include "model.hpp"
+#include "ngraph/file_util.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "ops_bridge.hpp"
 
 namespace ngraph
@@ -45,6 +47,44 @@ namespace ngraph
             }
         }
 
+        Model::Model(const std::shared_ptr<const ONNX_NAMESPACE::ModelProto>& model_proto,
+                     const std::string& model_dir)
+            : Model(*model_proto)
+        {
+            m_model_proto_owner = model_proto;
+            m_model_dir = model_dir;
+        }
+
+        std::shared_ptr<runtime::AlignedBuffer>
+            Model::get_initializer_data(const ONNX_NAMESPACE::TensorProto& tensor)
+        {
+            if (tensor.data_type() == ONNX_NAMESPACE::TensorProto_DataType_STRING ||
+                tensor.has_segment())
+            {
+                return nullptr;
+            }
+            if (TensorExternalData::is_external(tensor))
+            {
+                TensorExternalData external_data{tensor};
+                auto& file = m_external_data_files[external_data.get_location()];
+                if (!file)
+                {
+                    file = std::make_shared<detail::MappedFile>(
+                        file_util::path_join(m_model_dir, external_data.get_location()));
+                }
+                return external_data.load(file);
+            }
+            if (m_model_proto_owner && tensor.has_raw_data())
+            {
+                // constants don't modify their data, so the buffer of the message is shared
+                auto& raw_data = tensor.raw_data();
+                return std::make_shared<
+                    runtime::SharedBuffer<std::shared_ptr<const ONNX_NAMESPACE::ModelProto>>>(
+                    const_cast<char*>(raw_data.data()), raw_data.size(), m_model_proto_owner);
+            }
+            return nullptr;
+        }
+
         const Operator& Model::get_operator(const std::string& name,
                                             const std::string& domain) const
         {
@@ -17,11 +17,15 @@
 #pragma once
 
 #include <onnx/onnx_pb.h>
+#include <map>
+#include <memory>
 #include <ostream>
 #include <string>
 #include <unordered_map>
 
+#include "ngraph/runtime/aligned_buffer.hpp"
 #include "operator_set.hpp"
+#include "utils/tensor_external_data.hpp"
 
 namespace ngraph
 {
@@ -33,6 +37,13 @@ namespace ngraph
             Model() = delete;
             explicit Model(const ONNX_NAMESPACE::ModelProto& model_proto);
 
+            /// \brief Creates a model sharing the ownership of the protobuf message, so the
+            ///        initializers can be used without copies
+            /// \param model_proto  the parsed model
+            /// \param model_dir    the directory the external data locations are relative to
+            Model(const std::shared_ptr<const ONNX_NAMESPACE::ModelProto>& model_proto,
+                  const std::string& model_dir);
+
             Model(const Model&) = default;
             Model(Model&&) = default;
 
@@ -72,8 +83,20 @@ namespace ngraph
             ///
             void enable_opset_domain(const std::string& domain);
 
+            /// \brief Returns a buffer sharing the data of the initializer without a copy: the
+            ///        raw data owned by the model protobuf message or a region of the memory
+            ///        mapped external data file. The buffer keeps its owner alive.
+            /// \return The buffer or nullptr if the data has to be converted or the ownership
+            ///         of the model protobuf message is not shared.
+            std::shared_ptr<runtime::AlignedBuffer>
+                get_initializer_data(const ONNX_NAMESPACE::TensorProto& tensor);
+
         private:
             const ONNX_NAMESPACE::ModelProto* m_model_proto;
+            std::shared_ptr<const ONNX_NAMESPACE::ModelProto> m_model_proto_owner;
+            std::string m_model_dir;
+            // external data files shared by the initializers
+            std::map<std::string, std::shared_ptr<detail::MappedFile>> m_external_data_files;
             std::unordered_map<std::string, OperatorSet> m_opset;
         };
 
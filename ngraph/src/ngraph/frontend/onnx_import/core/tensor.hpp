@@ -17,12 +17,15 @@
 #pragma once
 
 #include <onnx/onnx_pb.h>
+#include <memory>
 #include <utility>
 #include <vector>
 
 #include "ngraph/op/constant.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/type/element_type.hpp"
+#include "utils/tensor_external_data.hpp"
 
 namespace ngraph
 {
@@ -90,6 +93,22 @@ namespace ngraph
                     {
                     }
                 };
+
+                struct external_data_unsupported : ngraph_error
+                {
+                    external_data_unsupported()
+                        : ngraph_error{"external data is supported for graph initializers only"}
+                    {
+                    }
+                };
+
+                struct invalid_data_size : ngraph_error
+                {
+                    invalid_data_size()
+                        : ngraph_error{"tensor data size doesn't match its shape and type"}
+                    {
+                    }
+                };
             }
         }
 
@@ -397,6 +416,20 @@ namespace ngraph
                 }
             }
 
+            /// \brief Creates a tensor using the data shared with the buffer instead of the
+            ///        data stored in the protobuf message, e.g. the external data of an
+            ///        initializer, see Model::get_initializer_data
+            Tensor(const ONNX_NAMESPACE::TensorProto& tensor,
+                   const std::shared_ptr<runtime::AlignedBuffer>& data)
+                : Tensor(tensor)
+            {
+                m_data = data;
+                if (m_data && m_data->size() != shape_size(m_shape) * get_ng_type().size())
+                {
+                    throw error::tensor::invalid_data_size{};
+                }
+            }
+
             Tensor(const Tensor&) = default;
             Tensor(Tensor&&) = default;
 
@@ -411,6 +444,15 @@ namespace ngraph
                 {
                     throw error::tensor::segments_unsupported{};
                 }
+                if (m_data)
+                {
+                    const auto data = m_data->get_ptr<T>();
+                    return std::vector<T>(data, data + m_data->size() / sizeof(T));
+                }
+                if (TensorExternalData::is_external(*m_tensor_proto))
+                {
+                    throw error::tensor::external_data_unsupported{};
+                }
                 return detail::tensor::get_data<T>(*m_tensor_proto);
             }
 
@@ -507,8 +549,10 @@ namespace ngraph
             template <typename T>
             std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const
             {
+                // the shared data is used without a copy
                 auto constant =
-                    std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+                    m_data ? std::make_shared<ngraph::op::Constant>(type, m_shape, m_data)
+                           : std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
                 if (m_tensor_proto->has_name())
                 {
                     constant->set_friendly_name(get_name());
@@ -518,6 +562,7 @@ namespace ngraph
 
             const ONNX_NAMESPACE::TensorProto* m_tensor_proto;
             Shape m_shape;
+            std::shared_ptr<runtime::AlignedBuffer> m_data;
         };
 
         inline std::ostream& operator<<(std::ostream& outs, const Tensor& tensor)
@@ -50,34 +50,42 @@ namespace ngraph
                 };
 
             } // namespace error
-        }     // namespace detail
 
-        std::shared_ptr<Function> import_onnx_model(std::istream& stream)
-        {
-            ONNX_NAMESPACE::ModelProto model_proto;
-            // Try parsing input as a binary protobuf message
-            if (!model_proto.ParseFromIstream(&stream))
+            std::shared_ptr<Function> import_onnx_model(std::istream& stream,
+                                                        const std::string& model_dir)
             {
-                // Rewind to the beginning and clear stream state.
-                stream.clear();
-                stream.seekg(0);
-                google::protobuf::io::IstreamInputStream iistream(&stream);
-                // Try parsing input as a prototxt message
-                if (!google::protobuf::TextFormat::Parse(&iistream, &model_proto))
+                // the constants share the raw data of the initializers with the message
+                auto model_proto = std::make_shared<ONNX_NAMESPACE::ModelProto>();
+                // Try parsing input as a binary protobuf message
+                if (!model_proto->ParseFromIstream(&stream))
                 {
-                    throw detail::error::stream_parse{stream};
+                    // Rewind to the beginning and clear stream state.
+                    stream.clear();
+                    stream.seekg(0);
+                    google::protobuf::io::IstreamInputStream iistream(&stream);
+                    // Try parsing input as a prototxt message
+                    if (!google::protobuf::TextFormat::Parse(&iistream, model_proto.get()))
+                    {
+                        throw error::stream_parse{stream};
+                    }
                 }
-            }
 
-            Model model{model_proto};
-            Graph graph{model_proto.graph(), model};
-            auto function = std::make_shared<Function>(
-                graph.get_ng_outputs(), graph.get_ng_parameters(), graph.get_name());
-            for (std::size_t i{0}; i < function->get_output_size(); ++i)
-            {
-                function->get_output_op(i)->set_friendly_name(graph.get_outputs().at(i).get_name());
+                Model model{model_proto, model_dir};
+                Graph graph{model_proto->graph(), model};
+                auto function = std::make_shared<Function>(
+                    graph.get_ng_outputs(), graph.get_ng_parameters(), graph.get_name());
+                for (std::size_t i{0}; i < function->get_output_size(); ++i)
+                {
+                    function->get_output_op(i)->set_friendly_name(
+                        graph.get_outputs().at(i).get_name());
+                }
+                return function;
             }
-            return function;
+        } // namespace detail
+
+        std::shared_ptr<Function> import_onnx_model(std::istream& stream)
+        {
+            return detail::import_onnx_model(stream, "");
         }
 
         std::shared_ptr<Function> import_onnx_model(const std::string& file_path)
@@ -87,7 +95,11 @@ namespace ngraph
             {
                 throw detail::error::file_open{file_path};
             }
-            return import_onnx_model(ifs);
+            // external data locations are relative to the directory of the model
+            const auto separator = file_path.find_last_of("/\\");
+            const auto model_dir =
+                separator == std::string::npos ? std::string{} : file_path.substr(0, separator);
+            return detail::import_onnx_model(ifs, model_dir);
         }
 
         std::set<std::string> get_supported_operators(std::int64_t version,
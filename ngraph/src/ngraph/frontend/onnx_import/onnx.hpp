@@ -61,6 +61,8 @@ namespace ngraph
         ///
         /// \note       If stream parsing fails or the ONNX model contains unsupported ops,
         ///             the function throws an ngraph_error exception.
+        ///             The locations of the external data of the initializers are relative
+        ///             to the current working directory.
         ///
         /// \param[in]  stream    The input stream (e.g. file stream, memory stream, etc).
         ///
@@ -73,6 +75,8 @@ namespace ngraph
         ///
         /// \note      If file parsing fails or the ONNX model contains unsupported ops,
         ///            the function throws an ngraph_error exception.
+        ///            The external data of the initializers is memory mapped from the files
+        ///            located relative to the directory of the model.
         ///
         /// \param[in] file_path  The path to a file containing the ONNX model
         ///                       (relative or absolute).
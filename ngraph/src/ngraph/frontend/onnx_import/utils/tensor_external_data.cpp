@@ -0,0 +1,173 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "ngraph/check.hpp"
+#include "ngraph/except.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
+#include "tensor_external_data.hpp"
+
+namespace ngraph
+{
+    namespace onnx_import
+    {
+        namespace detail
+        {
+#ifdef _WIN32
+            MappedFile::MappedFile(const std::string& path)
+            {
+                m_file = CreateFileA(path.c_str(),
+                                     GENERIC_READ,
+                                     FILE_SHARE_READ,
+                                     nullptr,
+                                     OPEN_EXISTING,
+                                     FILE_ATTRIBUTE_NORMAL,
+                                     nullptr);
+                if (m_file == INVALID_HANDLE_VALUE)
+                {
+                    throw ngraph_error("Failure opening external data file: " + path);
+                }
+                LARGE_INTEGER file_size;
+                GetFileSizeEx(m_file, &file_size);
+                m_size = static_cast<size_t>(file_size.QuadPart);
+                if (m_size > 0)
+                {
+                    m_mapping = CreateFileMappingA(m_file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+                    m_data = m_mapping ? static_cast<char*>(
+                                             MapViewOfFile(m_mapping, FILE_MAP_COPY, 0, 0, 0))
+                                       : nullptr;
+                    if (m_data == nullptr)
+                    {
+                        if (m_mapping)
+                        {
+                            CloseHandle(m_mapping);
+                        }
+                        CloseHandle(m_file);
+                        throw ngraph_error("Failure mapping external data file: " + path);
+                    }
+                }
+            }
+
+            MappedFile::~MappedFile()
+            {
+                if (m_data != nullptr)
+                {
+                    UnmapViewOfFile(m_data);
+                }
+                if (m_mapping != nullptr)
+                {
+                    CloseHandle(m_mapping);
+                }
+                CloseHandle(m_file);
+            }
+#else
+            MappedFile::MappedFile(const std::string& path)
+            {
+                int fd = open(path.c_str(), O_RDONLY);
+                if (fd == -1)
+                {
+                    throw ngraph_error("Failure opening external data file: " + path);
+                }
+                struct stat file_stat;
+                if (fstat(fd, &file_stat) == -1)
+                {
+                    close(fd);
+                    throw ngraph_error("Failure reading size of external data file: " + path);
+                }
+                m_size = static_cast<size_t>(file_stat.st_size);
+                if (m_size > 0)
+                {
+                    // private mapping, so the constants can be modified without touching the file
+                    void* data =
+                        mmap(nullptr, m_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+                    if (data == MAP_FAILED)
+                    {
+                        close(fd);
+                        throw ngraph_error("Failure mapping external data file: " + path);
+                    }
+                    m_data = static_cast<char*>(data);
+                }
+                // the mapping stays valid after the descriptor is closed
+                close(fd);
+            }
+
+            MappedFile::~MappedFile()
+            {
+                if (m_data != nullptr)
+                {
+                    munmap(m_data, m_size);
+                }
+            }
+#endif
+        }
+
+        TensorExternalData::TensorExternalData(const ONNX_NAMESPACE::TensorProto& tensor)
+        {
+            for (const auto& entry : tensor.external_data())
+            {
+                if (entry.key() == "location")
+                {
+                    m_location = entry.value();
+                }
+                else if (entry.key() == "offset")
+                {
+                    m_offset = std::stoull(entry.value());
+                }
+                else if (entry.key() == "length")
+                {
+                    m_length = std::stoull(entry.value());
+                    m_has_length = true;
+                }
+            }
+            NGRAPH_CHECK(!m_location.empty(),
+                         "External data of tensor ",
+                         tensor.name(),
+                         " has no location specified");
+        }
+
+        bool TensorExternalData::is_external(const ONNX_NAMESPACE::TensorProto& tensor)
+        {
+            return tensor.has_data_location() &&
+                   tensor.data_location() ==
+                       ONNX_NAMESPACE::TensorProto_DataLocation::TensorProto_DataLocation_EXTERNAL;
+        }
+
+        std::shared_ptr<runtime::AlignedBuffer>
+            TensorExternalData::load(const std::shared_ptr<detail::MappedFile>& file) const
+        {
+            NGRAPH_CHECK(m_offset <= file->size(),
+                         "Offset of external data is out of the file ",
+                         m_location);
+            size_t length = m_has_length ? m_length : file->size() - m_offset;
+            NGRAPH_CHECK(length <= file->size() - m_offset,
+                         "Length of external data is out of the file ",
+                         m_location);
+            return std::make_shared<runtime::SharedBuffer<std::shared_ptr<detail::MappedFile>>>(
+                file->data() + m_offset, length, file);
+        }
+    }
+}
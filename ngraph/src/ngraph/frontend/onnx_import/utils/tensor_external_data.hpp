@@ -0,0 +1,77 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <onnx/onnx_pb.h>
+#include <memory>
+#include <string>
+
+#include "ngraph/runtime/aligned_buffer.hpp"
+
+namespace ngraph
+{
+    namespace onnx_import
+    {
+        namespace detail
+        {
+            /// \brief A read only file mapped to the memory. Written pages are private copies.
+            class MappedFile
+            {
+            public:
+                explicit MappedFile(const std::string& path);
+                ~MappedFile();
+
+                MappedFile(const MappedFile&) = delete;
+                MappedFile& operator=(const MappedFile&) = delete;
+
+                char* data() const { return m_data; }
+                size_t size() const { return m_size; }
+            private:
+                char* m_data = nullptr;
+                size_t m_size = 0;
+#ifdef _WIN32
+                void* m_file = nullptr;
+                void* m_mapping = nullptr;
+#endif
+            };
+        }
+
+        /// \brief Location of the data of a tensor stored outside of the ONNX model, described
+        ///        by the `external_data` field of the TensorProto.
+        class TensorExternalData
+        {
+        public:
+            explicit TensorExternalData(const ONNX_NAMESPACE::TensorProto& tensor);
+
+            /// \brief Returns true if the data of the tensor is stored in an external file
+            static bool is_external(const ONNX_NAMESPACE::TensorProto& tensor);
+
+            /// \brief The path of the data file relative to the model directory
+            const std::string& get_location() const { return m_location; }
+            /// \brief Returns the region of the mapped file with the data of the tensor, the file
+            ///        is kept mapped as long as the buffer is used
+            std::shared_ptr<runtime::AlignedBuffer>
+                load(const std::shared_ptr<detail::MappedFile>& file) const;
+
+        private:
+            std::string m_location;
+            size_t m_offset = 0;
+            size_t m_length = 0;
+            bool m_has_length = false;
+        };
+    }
+}
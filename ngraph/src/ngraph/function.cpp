@@ -101,6 +101,27 @@ void Function::init()
 
 std::vector<shared_ptr<Node>> Function::get_ordered_ops() const
 {
+    lock_guard<mutex> lock(m_ordered_ops_mutex);
+    size_t version = Node::get_topology_version();
+    if (m_cached_ordered_ops_valid && m_cached_ordered_ops_version == version)
+    {
+        vector<shared_ptr<Node>> cached_nodes;
+        cached_nodes.reserve(m_cached_ordered_ops.size());
+        for (auto& weak_node : m_cached_ordered_ops)
+        {
+            auto node = weak_node.lock();
+            if (!node)
+            {
+                break;
+            }
+            cached_nodes.push_back(node);
+        }
+        if (cached_nodes.size() == m_cached_ordered_ops.size())
+        {
+            return cached_nodes;
+        }
+    }
+
     vector<shared_ptr<Node>> nodes;
     for (auto& r : get_results())
     {
@@ -111,7 +132,18 @@ std::vector<shared_ptr<Node>> Function::get_ordered_ops() const
         nodes.push_back(param);
     }
 
-    return m_topological_sorter(nodes);
+    auto ordered_ops = m_topological_sorter(nodes);
+    m_cached_ordered_ops.assign(ordered_ops.begin(), ordered_ops.end());
+    m_cached_ordered_ops_version = version;
+    m_cached_ordered_ops_valid = true;
+    return ordered_ops;
+}
+
+void Function::invalidate_ordered_ops()
+{
+    lock_guard<mutex> lock(m_ordered_ops_mutex);
+    m_cached_ordered_ops_valid = false;
+    m_cached_ordered_ops.clear();
 }
 
 void Function::map_unordered_ops(std::function<void(Node*)> f) const
@@ -287,9 +319,11 @@ void Function::replace_parameter(size_t parameter_index, const shared_ptr<op::Pa
                  " parameters.");
     replace_node(m_parameters[parameter_index], parameter);
     m_parameters[parameter_index] = parameter;
+    invalidate_ordered_ops();
 }
 
 void Function::set_topological_sort(topological_sort_t sorter)
 {
     m_topological_sorter = sorter;
+    invalidate_ordered_ops();
 }
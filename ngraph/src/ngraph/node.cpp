@@ -35,6 +35,7 @@ using namespace std;
 using namespace ngraph;
 
 atomic<size_t> Node::m_next_instance_id(0);
+atomic<size_t> Node::m_topology_version(0);
 
 Node::Node(size_t output_size)
     : Node()
@@ -553,6 +554,7 @@ void Node::add_control_dependency(std::shared_ptr<Node> node)
         {
             node->m_control_dependents.push_back(this);
         }
+        invalidate_topology();
     }
 }
 
@@ -585,6 +587,7 @@ void Node::remove_control_dependency(std::shared_ptr<Node> node)
         if (it != m_control_dependencies.end())
         {
             m_control_dependencies.erase(it);
+            invalidate_topology();
         }
     }
     {
@@ -607,6 +610,17 @@ void Node::clear_control_dependencies()
         }
     }
     m_control_dependencies.clear();
+    invalidate_topology();
+}
+
+size_t Node::get_topology_version()
+{
+    return m_topology_version.load();
+}
+
+void Node::invalidate_topology()
+{
+    m_topology_version.fetch_add(1);
 }
 
 void Node::clear_control_dependents()
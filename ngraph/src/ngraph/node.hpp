@@ -349,6 +349,15 @@ namespace ngraph
         /// This node absorbs the control dependencies of source_node
         void add_node_control_dependencies(std::shared_ptr<Node> source_node);
 
+        /// \brief Returns a counter of the changes of data and control edges of all nodes. A
+        ///        Function compares it with the value its ordered ops were cached at.
+        static size_t get_topology_version();
+
+        /// \brief Invalidates the ordered ops cached by functions. Called on every change of
+        ///        data and control edges, nodes modifying the graph in some other way have to
+        ///        call it as well.
+        static void invalidate_topology();
+
         /// This node becomes a dependent of every node dependent on source_node
         void add_node_control_dependents(std::shared_ptr<Node> source_node);
 
@@ -584,6 +593,7 @@ namespace ngraph
         std::string m_friendly_name;
         std::string m_unique_name;
         static std::atomic<size_t> m_next_instance_id;
+        static std::atomic<size_t> m_topology_version;
         std::unordered_set<std::string> m_provenance_tags;
         std::set<std::shared_ptr<Node>> m_provenance_group;
         std::deque<descriptor::Input> m_inputs;
@@ -316,11 +316,28 @@ op::Constant::Constant(const element::Type& type, const Shape& shape, const void
     m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
 }
 
+op::Constant::Constant(const element::Type& type,
+                       const Shape& shape,
+                       const shared_ptr<runtime::AlignedBuffer>& data)
+    : m_element_type(type)
+    , m_shape(shape)
+    , m_data(data)
+{
+    NGRAPH_CHECK(m_data && m_data->size() >= shape_size(m_shape) * m_element_type.size(),
+                 "Buffer of a constant is smaller than its shape ",
+                 m_shape,
+                 " requires");
+    constructor_validate_and_infer_types();
+    m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
+}
+
 op::Constant::Constant(const Constant& other)
-    : Constant(other.m_element_type, other.m_shape)
+    : m_element_type(other.m_element_type)
+    , m_shape(other.m_shape)
+    , m_data(other.m_data)
+    , m_all_elements_bitwise_identical(other.m_all_elements_bitwise_identical)
 {
-    m_data = other.m_data;
-    m_all_elements_bitwise_identical = other.m_all_elements_bitwise_identical;
+    // The data is shared with the copied constant, no buffer is allocated for the copy
     constructor_validate_and_infer_types();
 }
 
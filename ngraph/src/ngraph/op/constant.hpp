@@ -233,6 +233,17 @@ namespace ngraph
                 /// \param data A void* to constant data.
                 Constant(const element::Type& type, const Shape& shape, const void* data);
 
+                /// \brief Constructs a tensor constant sharing the supplied buffer, the data is
+                ///        not copied
+                ///
+                /// \param type The element type of the tensor constant.
+                /// \param shape The shape of the tensor constant.
+                /// \param data A buffer of at least the size of the tensor, e.g. a SharedBuffer
+                ///             wrapping memory owned by some other object.
+                Constant(const element::Type& type,
+                         const Shape& shape,
+                         const std::shared_ptr<runtime::AlignedBuffer>& data);
+
                 Constant(const Constant& other);
                 Constant& operator=(const Constant&) = delete;
 
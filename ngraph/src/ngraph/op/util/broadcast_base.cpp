@@ -21,6 +21,7 @@
 #include "ngraph/op/sum.hpp"
 #include "ngraph/partial_shape.hpp"
 
+#include "ngraph/runtime/opt_kernel/broadcast.hpp"
 #include "ngraph/runtime/reference/broadcast.hpp"
 
 #include <numeric>
@@ -315,11 +316,32 @@ bool op::util::BroadcastBase::evaluate(const HostTensorPtr& arg0,
                                        const AxisSet& broadcast_axes)
 {
     using T = typename element_type_traits<ET>::value_type;
-    runtime::reference::broadcast<T>((arg0->get_data_ptr<ET>()),
-                                     (out->get_data_ptr<ET>()),
-                                     arg0->get_shape(),
-                                     out->get_shape(),
-                                     broadcast_axes);
+    // the optimized kernel requires the input shape to be the output one without broadcast axes,
+    // while numpy and bidirectional modes may keep the broadcasted axes of size 1 in the input
+    Shape reduced_out_shape;
+    for (size_t axis = 0; axis < out->get_shape().size(); axis++)
+    {
+        if (broadcast_axes.count(axis) == 0)
+        {
+            reduced_out_shape.push_back(out->get_shape()[axis]);
+        }
+    }
+    if (reduced_out_shape == arg0->get_shape())
+    {
+        runtime::opt_kernel::broadcast<T>((arg0->get_data_ptr<ET>()),
+                                          (out->get_data_ptr<ET>()),
+                                          arg0->get_shape(),
+                                          out->get_shape(),
+                                          broadcast_axes);
+    }
+    else
+    {
+        runtime::reference::broadcast<T>((arg0->get_data_ptr<ET>()),
+                                         (out->get_data_ptr<ET>()),
+                                         arg0->get_shape(),
+                                         out->get_shape(),
+                                         broadcast_axes);
+    }
     return true;
 }
 
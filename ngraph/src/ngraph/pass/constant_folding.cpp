@@ -14,7 +14,20 @@
 // limitations under the License.
 //*****************************************************************************
 
+
+#include <algorithm>
+#include <atomic>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+
 #include "constant_folding.hpp"
+#include "ngraph/env_util.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/shape_of.hpp"
+#include "ngraph/runtime/host_tensor.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -32,20 +45,348 @@ bool ngraph::pass::revalidate_and_ensure_static(shared_ptr<Node> n)
     return true;
 }
 
+namespace
+{
+    const string s_default_handler_name = "Constant folding defaults";
+
+    using FoldingStatistics = pass::ConstantFolding::FoldingStatistics;
+
+    void record_folding(map<string, FoldingStatistics>& statistics,
+                        const Node* node,
+                        size_t bytes,
+                        chrono::nanoseconds time)
+    {
+        auto& op_statistics = statistics[node->get_type_info().name];
+        op_statistics.count++;
+        op_statistics.bytes += bytes;
+        op_statistics.time += time;
+    }
+
+    // Connected ops with constant inputs, evaluated together in a topological order
+    struct ConstantSubgraph
+    {
+        vector<shared_ptr<Node>> ops;
+        // outputs of the ops consumed outside of the subgraph and their constants
+        vector<pair<Output<Node>, shared_ptr<op::Constant>>> replacements;
+        map<string, FoldingStatistics> statistics;
+    };
+
+    bool is_constant(const Output<Node>& value)
+    {
+        return is_type<op::Constant>(value.get_node());
+    }
+
+    // The intermediate results are kept as host tensors and released when their last consumer in
+    // the subgraph is evaluated, only the outputs used by other ops become constants.
+    void evaluate_subgraph(ConstantSubgraph& subgraph)
+    {
+        unordered_set<const Node*> subgraph_ops;
+        for (auto& op : subgraph.ops)
+        {
+            subgraph_ops.insert(op.get());
+        }
+
+        map<Output<Node>, size_t> remaining_uses;
+        map<Output<Node>, HostTensorPtr> tensors;
+        set<Output<Node>> materialized;
+        auto materialize = [&](const Output<Node>& value) {
+            if (materialized.insert(value).second)
+            {
+                subgraph.replacements.emplace_back(
+                    value, make_shared<op::Constant>(tensors.at(value)));
+            }
+        };
+
+        for (auto& op : subgraph.ops)
+        {
+            for (auto output : op->outputs())
+            {
+                for (auto& target : output.get_target_inputs())
+                {
+                    if (subgraph_ops.count(target.get_node()))
+                    {
+                        remaining_uses[output]++;
+                    }
+                }
+            }
+        }
+
+        for (auto& op : subgraph.ops)
+        {
+            HostTensorVector input_tensors;
+            bool inputs_evaluated = true;
+            for (auto input_value : op->input_values())
+            {
+                if (is_constant(input_value))
+                {
+                    // constants are read only, so their data is used without a copy
+                    auto constant =
+                        static_pointer_cast<op::Constant>(input_value.get_node_shared_ptr());
+                    input_tensors.push_back(make_shared<runtime::HostTensor>(
+                        constant->get_element_type(),
+                        constant->get_shape(),
+                        const_cast<void*>(constant->get_data_ptr())));
+                }
+                else if (tensors.count(input_value))
+                {
+                    input_tensors.push_back(tensors.at(input_value));
+                }
+                else
+                {
+                    inputs_evaluated = false;
+                }
+            }
+
+            HostTensorVector output_tensors;
+            for (auto output : op->outputs())
+            {
+                output_tensors.push_back(make_shared<runtime::HostTensor>(
+                    output.get_element_type(), output.get_partial_shape()));
+            }
+
+            bool evaluated = false;
+            if (inputs_evaluated)
+            {
+                stopwatch timer;
+                timer.start();
+                try
+                {
+                    evaluated = op->evaluate(output_tensors, input_tensors);
+                }
+                catch (...)
+                {
+                    // left for the matchers, which report the error the usual way
+                    evaluated = false;
+                }
+                timer.stop();
+
+                if (evaluated)
+                {
+                    size_t bytes = 0;
+                    for (auto& tensor : output_tensors)
+                    {
+                        bytes += tensor->get_size_in_bytes();
+                    }
+                    record_folding(subgraph.statistics, op.get(), bytes, timer.get_timer_value());
+                }
+            }
+
+            if (evaluated)
+            {
+                for (auto output : op->outputs())
+                {
+                    tensors[output] = output_tensors.at(output.get_index());
+                    for (auto& target : output.get_target_inputs())
+                    {
+                        if (!subgraph_ops.count(target.get_node()))
+                        {
+                            materialize(output);
+                            break;
+                        }
+                    }
+                }
+            }
+            else
+            {
+                // the op is folded by the matchers, so its evaluated inputs have to be constants
+                for (auto input_value : op->input_values())
+                {
+                    if (tensors.count(input_value))
+                    {
+                        materialize(input_value);
+                    }
+                }
+            }
+
+            for (auto input_value : op->input_values())
+            {
+                auto uses = remaining_uses.find(input_value);
+                if (uses != remaining_uses.end() && --uses->second == 0)
+                {
+                    tensors.erase(input_value);
+                }
+            }
+            for (auto output : op->outputs())
+            {
+                if (remaining_uses[output] == 0)
+                {
+                    tensors.erase(output);
+                }
+            }
+        }
+    }
+}
+
+bool ngraph::pass::ConstantFolding::fold_constant_subgraphs(const shared_ptr<Function>& f)
+{
+    // the subgraphs are folded the same way as the default handler does, so nothing is folded
+    // if it is disabled; the ops with dedicated handlers are folded by them
+    bool default_enabled = false;
+    unordered_set<NodeTypeInfo> handled_types;
+    for (auto& closure : m_matchers)
+    {
+        if (closure.name == s_default_handler_name)
+        {
+            default_enabled = true;
+        }
+        else if (closure.root_type != nullptr)
+        {
+            handled_types.insert(*closure.root_type);
+        }
+    }
+    if (!default_enabled)
+    {
+        return false;
+    }
+
+    // union-find of the ops which inputs are constants or the ops of the same subgraph
+    unordered_map<Node*, size_t> subgraph_ids;
+    vector<size_t> parents;
+    function<size_t(size_t)> find_root = [&](size_t id) {
+        while (parents[id] != id)
+        {
+            parents[id] = parents[parents[id]];
+            id = parents[id];
+        }
+        return id;
+    };
+
+    auto ordered_ops = f->get_ordered_ops();
+    vector<shared_ptr<Node>> candidates;
+    for (auto& op : ordered_ops)
+    {
+        if (op->is_constant() || op->is_parameter() || op->is_output() ||
+            op->get_output_size() == 0 || handled_types.count(op->get_type_info()) ||
+            is_type<op::v0::ShapeOf>(op) || is_type<op::v3::ShapeOf>(op))
+        {
+            continue;
+        }
+
+        bool constant_inputs = op->get_input_size() > 0;
+        for (auto input_value : op->input_values())
+        {
+            if (!is_constant(input_value) && !subgraph_ids.count(input_value.get_node()))
+            {
+                constant_inputs = false;
+                break;
+            }
+        }
+        if (!constant_inputs || !revalidate_and_ensure_static(op))
+        {
+            continue;
+        }
+
+        size_t id = parents.size();
+        parents.push_back(id);
+        for (auto input_value : op->input_values())
+        {
+            auto it = subgraph_ids.find(input_value.get_node());
+            if (it != subgraph_ids.end())
+            {
+                parents[find_root(it->second)] = id;
+            }
+        }
+        subgraph_ids[op.get()] = id;
+        candidates.push_back(op);
+    }
+
+    if (candidates.empty())
+    {
+        return false;
+    }
+
+    vector<ConstantSubgraph> subgraphs;
+    unordered_map<size_t, size_t> subgraph_indices;
+    for (auto& op : candidates)
+    {
+        size_t root = find_root(subgraph_ids.at(op.get()));
+        auto it = subgraph_indices.find(root);
+        if (it == subgraph_indices.end())
+        {
+            it = subgraph_indices.emplace(root, subgraphs.size()).first;
+            subgraphs.emplace_back();
+        }
+        subgraphs[it->second].ops.push_back(op);
+    }
+
+    // the subgraphs are independent of each other, the graph is only read while evaluating
+    atomic<size_t> next_subgraph{0};
+    auto worker = [&]() {
+        for (size_t i = next_subgraph++; i < subgraphs.size(); i = next_subgraph++)
+        {
+            evaluate_subgraph(subgraphs[i]);
+        }
+    };
+    size_t threads_count =
+        min<size_t>(subgraphs.size(), max<size_t>(thread::hardware_concurrency(), 1));
+    vector<thread> threads;
+    for (size_t i = 1; i < threads_count; i++)
+    {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    bool replaced = false;
+    for (auto& subgraph : subgraphs)
+    {
+        for (auto& replacement : subgraph.replacements)
+        {
+            replacement.first.replace(replacement.second->output(0));
+            replaced = true;
+        }
+        for (auto& op_statistics : subgraph.statistics)
+        {
+            auto& statistics = m_folding_statistics[op_statistics.first];
+            statistics.count += op_statistics.second.count;
+            statistics.bytes += op_statistics.second.bytes;
+            statistics.time += op_statistics.second.time;
+        }
+    }
+    return replaced;
+}
+
+bool ngraph::pass::ConstantFolding::run_on_function(shared_ptr<Function> f)
+{
+    static bool profile_enabled = getenv_bool("NGRAPH_PROFILE_PASS_ENABLE");
+
+    bool rewritten = fold_constant_subgraphs(f);
+    rewritten = GraphRewrite::run_on_function(f) || rewritten;
+
+    if (profile_enabled)
+    {
+        for (auto& op_statistics : m_folding_statistics)
+        {
+            auto& statistics = op_statistics.second;
+            cout << setw(7) << chrono::duration_cast<chrono::milliseconds>(statistics.time).count()
+                 << "ms " << statistics.count << " " << op_statistics.first << " folded to "
+                 << statistics.bytes << " bytes\n";
+        }
+    }
+    return rewritten;
+}
+
 void ngraph::pass::ConstantFolding::construct_constant_default()
 {
-    add_handler("Constant folding defaults",
-                [](const std::shared_ptr<Node>& node) -> bool {
+    add_handler(s_default_handler_name,
+                [this](const std::shared_ptr<Node>& node) -> bool {
+                    stopwatch timer;
+                    timer.start();
                     OutputVector replacements(node->get_output_size());
                     if (!node->constant_fold(replacements, node->input_values()))
                     {
                         return false;
                     }
+                    timer.stop();
                     NGRAPH_CHECK(
                         replacements.size() == node->get_output_size(),
                         "constant_fold_default returned incorrect number of replacements for ",
                         node);
                     bool result{false};
+                    size_t bytes = 0;
                     for (size_t i = 0; i < replacements.size(); ++i)
                     {
                         auto node_output = node->output(i);
@@ -53,9 +394,16 @@ void ngraph::pass::ConstantFolding::construct_constant_default()
                         if (replacement.get_node_shared_ptr() && (node_output != replacement))
                         {
                             node_output.replace(replacement);
+                            bytes += shape_size(replacement.get_shape()) *
+                                     replacement.get_element_type().size();
                             result = true;
                         }
                     }
+                    if (result)
+                    {
+                        record_folding(
+                            m_folding_statistics, node.get(), bytes, timer.get_timer_value());
+                    }
                     return result;
                 },
                 PassProperty::CHANGE_DYNAMIC_STATE);
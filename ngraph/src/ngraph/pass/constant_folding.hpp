@@ -16,6 +16,10 @@
 
 #pragma once
 
+#include <chrono>
+#include <map>
+#include <string>
+
 #include "ngraph/log.hpp"
 #include "ngraph/pass/graph_rewrite.hpp"
 #include "ngraph/runtime/aligned_buffer.hpp"
@@ -94,7 +98,27 @@ public:
         construct_constant_default();
     }
 
+    /// \brief Number, size of the outputs and time of the ops folded by the default evaluation
+    struct FoldingStatistics
+    {
+        size_t count = 0;
+        size_t bytes = 0;
+        std::chrono::nanoseconds time{0};
+    };
+
+    /// \brief Returns the statistics of the folded ops by the op type name
+    const std::map<std::string, FoldingStatistics>& get_folding_statistics() const
+    {
+        return m_folding_statistics;
+    }
+
+    /// \brief Folds the constant subgraphs of the ops without dedicated handlers first, the
+    ///        independent subgraphs are evaluated in parallel and only their outputs become
+    ///        constants. The rest is folded by the matchers.
+    bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+
 private:
+    bool fold_constant_subgraphs(const std::shared_ptr<ngraph::Function>& f);
     void construct_constant_dyn_broadcast();
     void construct_constant_pad();
     void construct_constant_quantize();
@@ -117,4 +141,5 @@ private:
     void construct_constant_default();
 
     ngraph::BuildNodeExecutorMap m_cfmap;
+    std::map<std::string, FoldingStatistics> m_folding_statistics;
 };
@@ -23,6 +23,7 @@
 #include "graph_rewrite.hpp"
 #include "ngraph/env_util.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/pattern/op/pattern.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -60,6 +61,21 @@ using namespace ngraph;
 // c) there's no linear order of fusions which will give
 //    the correct final fusion. i.e. the same fusion needs to occur before and after some other
 //    fusion
+// A matcher can match only the nodes of the same type as the root node of its pattern, unless the
+// root is a pattern op like Label or Any. So the matchers are indexed by the root type and a node
+// is tried only with the matchers of its type and the generic ones, in the order of registration.
+// The nodes replaced by the previous rewrites of the same pass are not visited, they are not a
+// part of the function anymore.
+
+namespace
+{
+    // A node replaced by a rewrite has no users left, while the nodes of the function which have
+    // no users are Results and unused Parameters
+    bool is_replaced(const shared_ptr<Node>& node)
+    {
+        return !node->is_output() && !node->is_parameter() && node->get_users().empty();
+    }
+}
 
 bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
 {
@@ -78,15 +94,38 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
         // that need multiple passes. See comments above.
         vector<MatchClosure> matchers_to_run{m_matchers};
         m_matchers.clear();
+
+        map<NodeTypeInfo, vector<MatchClosure*>> matchers_by_type;
+        auto get_matchers = [&](const NodeTypeInfo& type) -> const vector<MatchClosure*>& {
+            auto it = matchers_by_type.find(type);
+            if (it == matchers_by_type.end())
+            {
+                vector<MatchClosure*> applicable;
+                for (auto& closure : matchers_to_run)
+                {
+                    if (closure.root_type == nullptr || *closure.root_type == type)
+                    {
+                        applicable.push_back(&closure);
+                    }
+                }
+                it = matchers_by_type.emplace(type, move(applicable)).first;
+            }
+            return it->second;
+        };
+
         for (auto node : f->get_ordered_ops())
         {
+            if (is_replaced(node))
+            {
+                continue;
+            }
             if (m_enable_shape_inference)
             {
                 node->revalidate_and_infer_types();
             }
-            for (auto& closure : matchers_to_run)
+            for (auto closure : get_matchers(node->get_type_info()))
             {
-                if (is_dyn_func && closure.property[PassProperty::REQUIRE_STATIC_SHAPE])
+                if (is_dyn_func && closure->property[PassProperty::REQUIRE_STATIC_SHAPE])
                 {
                     NGRAPH_DEBUG << "matcher callback requires static shape but the "
                                     "function is dynamic, skipping this "
@@ -94,12 +133,12 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
                                     "materialized";
                     continue;
                 }
-                if (closure.handler(node))
+                if (apply(*closure, node))
                 {
                     rewritten = true;
                     // If call back may change function's is_dynamic state, we need to
                     // update the cached value.
-                    if (closure.property.is_set(PassProperty::CHANGE_DYNAMIC_STATE))
+                    if (closure->property.is_set(PassProperty::CHANGE_DYNAMIC_STATE))
                     {
                         is_dyn_func = s_rerun_dynamic_check && f->is_dynamic();
                     }
@@ -150,10 +189,23 @@ bool pass::GraphRewriteBase::is_enabled(const std::string& name) const
 void pass::GraphRewriteBase::add_handler(const std::string& name,
                                          function<bool(const std::shared_ptr<Node>&)> handler,
                                          const PassPropertyMask& property)
+{
+    add_handler(name, handler, property, nullptr);
+}
+
+void pass::GraphRewriteBase::add_handler(const std::string& name,
+                                         function<bool(const std::shared_ptr<Node>&)> handler,
+                                         const PassPropertyMask& property,
+                                         const NodeTypeInfo* root_type)
 {
     if (is_enabled(name))
     {
-        m_matchers.push_back({name, handler, property});
+        auto& statistics = m_statistics[name];
+        if (!statistics)
+        {
+            statistics = make_shared<MatcherStatistics>();
+        }
+        m_matchers.push_back({name, handler, property, root_type, statistics});
         // If any matcher call back may change dynamic state, we need to
         // update the pass property.
         if (property.is_set(PassProperty::CHANGE_DYNAMIC_STATE))
@@ -163,10 +215,53 @@ void pass::GraphRewriteBase::add_handler(const std::string& name,
     }
 }
 
+bool pass::GraphRewriteBase::apply(MatchClosure& closure, const std::shared_ptr<Node>& node)
+{
+    static bool profile_enabled = getenv_bool("NGRAPH_PROFILE_PASS_ENABLE");
+
+    auto& statistics = *closure.statistics;
+    statistics.calls++;
+    bool result = false;
+    if (profile_enabled)
+    {
+        stopwatch timer;
+        timer.start();
+        result = closure.handler(node);
+        timer.stop();
+        statistics.time += timer.get_timer_value();
+    }
+    else
+    {
+        result = closure.handler(node);
+    }
+    if (result)
+    {
+        statistics.hits++;
+    }
+    return result;
+}
+
+map<string, pass::GraphRewriteBase::MatcherStatistics>
+    pass::GraphRewriteBase::get_matcher_statistics() const
+{
+    map<string, MatcherStatistics> result;
+    for (const auto& statistics : m_statistics)
+    {
+        result[statistics.first] = *statistics.second;
+    }
+    return result;
+}
+
 void pass::GraphRewrite::add_matcher(const shared_ptr<pattern::Matcher>& m,
                                      const graph_rewrite_callback& callback,
                                      const PassPropertyMask& property)
 {
+    // only pattern ops can match nodes of a type different from their own one
+    auto pattern_root = m->get_pattern_value().get_node_shared_ptr();
+    const NodeTypeInfo* root_type = dynamic_pointer_cast<pattern::op::Pattern>(pattern_root)
+                                        ? nullptr
+                                        : &pattern_root->get_type_info();
+
     add_handler(m->get_name(),
                 [m, callback](const std::shared_ptr<Node>& node) -> bool {
                     NGRAPH_DEBUG << "Running matcher " << m->get_name() << " on " << node;
@@ -177,7 +272,8 @@ void pass::GraphRewrite::add_matcher(const shared_ptr<pattern::Matcher>& m,
                     }
                     return false;
                 },
-                property);
+                property,
+                root_type);
 }
 
 void pass::GraphRewrite::add_matcher(const shared_ptr<pattern::Matcher>& m,
@@ -238,7 +334,7 @@ bool pass::RecurrentGraphRewrite::run_on_function(shared_ptr<Function> f)
                                     "materialized";
                     continue;
                 }
-                if (closure.handler(node))
+                if (apply(closure, node))
                 {
                     // If call back may change function's is_dynamic state, we need to
                     // update the cached value.
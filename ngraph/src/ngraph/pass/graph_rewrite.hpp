@@ -16,7 +16,9 @@
 
 #pragma once
 
+#include <chrono>
 #include <functional>
+#include <map>
 #include <memory>
 #include <set>
 
@@ -48,6 +50,19 @@ public:
                      std::function<bool(const std::shared_ptr<Node>& node)> handler,
                      const PassPropertyMask& property);
 
+    /// \brief Number of calls and successful rewrites of a handler, the time is measured only if
+    /// NGRAPH_PROFILE_PASS_ENABLE is set
+    struct MatcherStatistics
+    {
+        size_t calls = 0;
+        size_t hits = 0;
+        std::chrono::nanoseconds time{0};
+    };
+
+    /// \brief Returns the statistics of the handlers collected by all runs of the pass, the
+    /// handlers with the same name are accumulated together
+    std::map<std::string, MatcherStatistics> get_matcher_statistics() const;
+
 protected:
     GraphRewriteBase()
         : FunctionPass()
@@ -65,8 +80,22 @@ protected:
         std::string name;
         std::function<bool(const std::shared_ptr<Node>& node)> handler;
         PassPropertyMask property;
+        /// The type of the nodes the handler can match, nullptr if the handler accepts any node
+        const NodeTypeInfo* root_type;
+        std::shared_ptr<MatcherStatistics> statistics;
     };
+
+    /// \brief Registers a handler which is called only for the nodes of \p root_type
+    void add_handler(const std::string& name,
+                     std::function<bool(const std::shared_ptr<Node>& node)> handler,
+                     const PassPropertyMask& property,
+                     const NodeTypeInfo* root_type);
+
+    /// \brief Calls the handler of the closure on the node and updates the statistics
+    static bool apply(MatchClosure& closure, const std::shared_ptr<Node>& node);
+
     std::vector<MatchClosure> m_matchers;
+    std::map<std::string, std::shared_ptr<MatcherStatistics>> m_statistics;
 };
 
 /// \brief GraphRewrite (in tandem with \sa Matcher) performs transformations on specified patterns
@@ -78,6 +107,8 @@ protected:
 /// the existing ops by providing a callback to \p Matcher object
 /// Patterns can be added by using \sa add_matcher
 /// Callbacks should use \sa replace_node to transform matched sub graphs
+/// Matchers are indexed by the type of the root node of their patterns, so a node is tried only
+/// with the matchers of its type and the matchers with a generic root (e.g. a Label)
 
 class NGRAPH_API ngraph::pass::GraphRewrite : public ngraph::pass::GraphRewriteBase
 {
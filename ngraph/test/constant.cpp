@@ -1020,6 +1020,7 @@ TEST(constant, shared_data)
     const int16_t* p1 = c1->get_data_ptr<int16_t>();
     const int16_t* p2 = c2->get_data_ptr<int16_t>();
     EXPECT_EQ(p1, p2);
+    EXPECT_TRUE(c2->get_all_data_elements_bitwise_identical());
 }
 
 template <typename T1, typename T2>
@@ -534,6 +534,36 @@ TEST(constant_folding, constant_unary_binary)
     ASSERT_NO_THROW(pass_manager.run_passes(func_error));
 }
 
+TEST(constant_folding, constant_subgraphs)
+{
+    vector<int> values_a{1, 2, 3, 4};
+    vector<int> values_b{1, 1, 1, 1};
+    vector<int> values_c{-5, 6};
+    auto a = make_shared<op::Constant>(element::i32, Shape{2, 2}, values_a);
+    auto b = make_shared<op::Constant>(element::i32, Shape{2, 2}, values_b);
+    auto c = make_shared<op::Constant>(element::i32, Shape{2}, values_c);
+
+    // independent subgraphs, only their outputs become constants
+    auto neg = make_shared<op::Negative>(a + b);
+    auto broadcast = make_shared<op::Broadcast>(make_shared<op::Abs>(c), Shape{2, 2}, AxisSet{0});
+    auto func = make_shared<Function>(NodeVector{neg, broadcast}, ParameterVector{});
+
+    pass::ConstantFolding constant_folding;
+    ASSERT_TRUE(constant_folding.run_on_function(func));
+
+    ASSERT_EQ(count_ops_of_type<op::Constant>(func), 2);
+    ASSERT_EQ(get_result_constant<int>(func, 0), vector<int>({-2, -3, -4, -5}));
+    ASSERT_EQ(get_result_constant<int>(func, 1), vector<int>({5, 6, 5, 6}));
+
+    auto statistics = constant_folding.get_folding_statistics();
+    for (auto type : {"Add", "Negative", "Abs", "Broadcast"})
+    {
+        ASSERT_EQ(statistics[type].count, 1);
+    }
+    ASSERT_EQ(statistics["Add"].bytes, 4 * sizeof(int));
+    ASSERT_EQ(statistics["Abs"].bytes, 2 * sizeof(int));
+}
+
 TEST(constant_folding, const_dequantize)
 {
     Shape input_shape{12};
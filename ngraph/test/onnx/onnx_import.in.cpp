@@ -188,6 +188,26 @@ NGRAPH_TEST(${BACKEND_NAME}, onnx_model_add_abc_initializers)
     test_case.run();
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, onnx_model_external_data)
+{
+    // the initializer is read from a region of a file next to the model
+    auto function = onnx_import::import_onnx_model(
+        file_util::path_join(SERIALIZED_ZOO, "onnx/external_data/external_data.prototxt"));
+
+    auto test_case = ngraph::test::NgraphTestCase(function, "${BACKEND_NAME}");
+    test_case.add_input<float>({1, 2, 3, 4});
+    test_case.add_expected_output<float>({3, 6, 9, 12});
+    test_case.run();
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, onnx_model_external_data_from_stream)
+{
+    // the locations of a model read from a stream are relative to the working directory
+    std::ifstream model_stream{
+        file_util::path_join(SERIALIZED_ZOO, "onnx/external_data/external_data.prototxt")};
+    EXPECT_THROW(onnx_import::import_onnx_model(model_stream), ngraph_error);
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, onnx_model_override_op)
 {
     onnx_import::register_operator(
@@ -290,6 +290,45 @@ TEST(pattern, graph_rewrite)
     }
 }
 
+TEST(pattern, graph_rewrite_matchers_by_root_type)
+{
+    Shape shape{};
+    auto a = make_shared<op::Parameter>(element::i32, shape);
+    auto b = make_shared<op::Parameter>(element::i32, shape);
+    auto iconst0 = construct_constant_node(0);
+    auto iconst1 = construct_constant_node(1);
+    auto graph = b + (iconst0 + ((a + iconst0) * iconst1));
+    auto f = make_shared<Function>(graph, ParameterVector{a, b});
+
+    auto pattern = std::make_shared<pattern::op::Label>(element::i32, shape);
+    auto callback = [pattern](pattern::Matcher& m) {
+        auto pattern_map = m.get_pattern_map();
+        ngraph::replace_node(m.get_match_root(), pattern_map[pattern]);
+        return true;
+    };
+    auto any_node = std::make_shared<pattern::op::Label>(element::i32, shape);
+    auto count_nodes = [](pattern::Matcher&) { return false; };
+
+    pass::GraphRewrite rewrite;
+    rewrite.add_matcher(make_shared<pattern::Matcher>(pattern + iconst0, "add_zero"), callback);
+    rewrite.add_matcher(make_shared<pattern::Matcher>(pattern * iconst1, "multiply_by_one"),
+                        callback);
+    rewrite.add_matcher(make_shared<pattern::Matcher>(any_node, "any_node"), count_nodes);
+    rewrite.run_on_function(f);
+
+    ASSERT_EQ(graph->get_arguments().at(1), a);
+    auto statistics = rewrite.get_matcher_statistics();
+    // the matchers with typed roots are called only for Add and Multiply nodes, the replaced
+    // ones are not visited anymore
+    EXPECT_EQ(statistics["add_zero"].calls, 3);
+    EXPECT_EQ(statistics["add_zero"].hits, 2);
+    EXPECT_EQ(statistics["multiply_by_one"].calls, 1);
+    EXPECT_EQ(statistics["multiply_by_one"].hits, 1);
+    // a, b, the constants, the last Add and the Result
+    EXPECT_EQ(statistics["any_node"].calls, 6);
+    EXPECT_EQ(statistics["any_node"].hits, 0);
+}
+
 TEST(pattern, matcher)
 {
     Shape shape{};
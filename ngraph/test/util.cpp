@@ -713,6 +713,43 @@ TEST(util, topological_sort_replace)
     EXPECT_TRUE(custom_sorter_used);
 }
 
+TEST(util, topological_sort_cached)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    auto sum = A + B;
+    auto f = make_shared<Function>(sum + C, ParameterVector{A, B, C});
+    size_t sorter_calls = 0;
+
+    f->set_topological_sort([&sorter_calls](const std::vector<std::shared_ptr<Node>>& root_nodes) {
+        sorter_calls++;
+        return topological_sort(root_nodes);
+    });
+
+    auto ordered_ops = f->get_ordered_ops();
+    EXPECT_EQ(f->get_ordered_ops(), ordered_ops);
+    EXPECT_EQ(sorter_calls, 1);
+
+    // replacing a node changes the edges, so the order is sorted again
+    auto mul = make_shared<op::Multiply>(A, B);
+    replace_node(sum, mul);
+    ordered_ops = f->get_ordered_ops();
+    EXPECT_EQ(sorter_calls, 2);
+    EXPECT_NE(find(ordered_ops.begin(), ordered_ops.end(), mul), ordered_ops.end());
+    EXPECT_EQ(find(ordered_ops.begin(), ordered_ops.end(), sum), ordered_ops.end());
+
+    f->get_ordered_ops();
+    EXPECT_EQ(sorter_calls, 2);
+
+    auto D = make_shared<op::Parameter>(element::f32, shape);
+    mul->add_control_dependency(D);
+    ordered_ops = f->get_ordered_ops();
+    EXPECT_EQ(sorter_calls, 3);
+    EXPECT_NE(find(ordered_ops.begin(), ordered_ops.end(), D), ordered_ops.end());
+}
+
 TEST(util, double_to_int_limits)
 {
     auto round_func = [](double x) { return std::round(x); };